@@ -0,0 +1,115 @@
+//============================================================================
+// Name        : mwisd.h
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : C API to mwisd_fp and histogroup fingerprints and indexes,
+//               for linking from other languages through their FFIs:
+//               opaque handles, buffers supplied by the caller, and return
+//               codes in place of exceptions.
+//============================================================================
+
+#ifndef MWISD_H_
+#define MWISD_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bumped whenever a declaration below changes incompatibly; compare with
+// mwisd_abi_version() to detect a mismatched library at run time.
+#define MWISD_ABI_VERSION 1
+
+// Return codes.  Functions returning int give MWISD_OK (or, where noted, a
+// count or size) on success and one of the negative codes on failure.
+#define MWISD_OK                1
+#define MWISD_ERROR_ARGUMENT    -1  // Null handle or buffer, or bad size.
+#define MWISD_ERROR_IMAGE       -2  // Image unreadable, unsupported, or too large.
+#define MWISD_ERROR_BUFFER      -3  // Buffer too small for the result.
+#define MWISD_ERROR_MEMORY      -4
+#define MWISD_ERROR_INTERNAL    -5
+
+int mwisd_abi_version(void);
+const char *mwisd_error_message(int code);      // Static string; never NULL.
+
+typedef struct mwisd_fingerprint mwisd_fingerprint;  // mwisd_fp fingerprint.
+typedef struct mwisd_batch mwisd_batch;              // Packed mwisd_fp fingerprints.
+typedef struct mwisd_histogram mwisd_histogram;      // histogroup fingerprint.
+typedef struct mwisd_index mwisd_index;              // histogroup index.
+
+
+// mwisd_fp fingerprints of size_in_bytes (a power of two; 128 is the
+// classic size), compared by similarity (1.0:  identical).  Bytes are as
+// Mwisd_fp::Fingerprint#to_bytes gives them:  each 16-bit member
+// little-endian.
+int mwisd_fingerprint_create(int size_in_bytes, mwisd_fingerprint **fingerprint);
+void mwisd_fingerprint_destroy(mwisd_fingerprint *fingerprint);
+int mwisd_fingerprint_size(const mwisd_fingerprint *fingerprint);  // In bytes.
+// Recommended:  wavelet_scale_base=2, wavelet_scale_exponent=1
+int mwisd_fingerprint_compute(mwisd_fingerprint *fingerprint, \
+        const char *filename, int wavelet_scale_base, int wavelet_scale_exponent);
+int mwisd_fingerprint_to_bytes(const mwisd_fingerprint *fingerprint, \
+        unsigned char *bytes, size_t capacity);
+int mwisd_fingerprint_from_bytes(mwisd_fingerprint *fingerprint, \
+        const unsigned char *bytes, size_t length);
+int mwisd_fingerprint_compare(const mwisd_fingerprint *fingerprint_1, \
+        const mwisd_fingerprint *fingerprint_2, double *similarity);
+int mwisd_compare_bytes(const unsigned char *bytes_1, \
+        const unsigned char *bytes_2, size_t length, double *similarity);
+
+// Batches hold fingerprints of one size packed back to back, numbered 0, 1,
+// ... as added, to compare with a query in one call.
+int mwisd_batch_create(int size_in_bytes, mwisd_batch **batch);
+void mwisd_batch_destroy(mwisd_batch *batch);
+int mwisd_batch_size(const mwisd_batch *batch);     // Fingerprints held.
+int mwisd_batch_add(mwisd_batch *batch, const mwisd_fingerprint *fingerprint, \
+        int *index);
+int mwisd_batch_add_bytes(mwisd_batch *batch, const unsigned char *bytes, \
+        size_t length, int *index);
+// Similarity of query to each fingerprint, capacity >= mwisd_batch_size().
+int mwisd_batch_compare(const mwisd_batch *batch, \
+        const mwisd_fingerprint *query, float *similarities, size_t capacity);
+// The (up to) capacity fingerprints most similar to query of those at least
+// threshold similar, most similar first (ties by index); count is set to how
+// many were at least threshold similar, which may exceed capacity.
+int mwisd_batch_match(const mwisd_batch *batch, \
+        const mwisd_fingerprint *query, double threshold, int *indices, \
+        float *similarities, size_t capacity, size_t *count);
+
+
+// histogroup fingerprints:  color histograms of bins_per_dimension cubed
+// bins (4 is the default), compared by chi-square distance (0.0:
+// identical).
+int mwisd_histogram_create(int bins_per_dimension, mwisd_histogram **histogram);
+void mwisd_histogram_destroy(mwisd_histogram *histogram);
+int mwisd_histogram_bins(const mwisd_histogram *histogram);  // Values held.
+int mwisd_histogram_compute(mwisd_histogram *histogram, const char *filename);
+int mwisd_histogram_values(const mwisd_histogram *histogram, float *values, \
+        size_t capacity);
+int mwisd_histogram_set_values(mwisd_histogram *histogram, \
+        const float *values, size_t count);
+int mwisd_histogram_compare(const mwisd_histogram *histogram_1, \
+        const mwisd_histogram *histogram_2, double *distance);
+
+// Indexes of histograms, numbered 0, 1, ... as added (see
+// Histogroup::Index); pivots may be 0.  Searches may run on several threads
+// at once, and alongside adds.
+int mwisd_index_create(int bins_per_dimension, int pivots, mwisd_index **index);
+void mwisd_index_destroy(mwisd_index *index);
+int mwisd_index_size(const mwisd_index *index);
+int mwisd_index_add(mwisd_index *index, const mwisd_histogram *histogram, \
+        int *id);
+// Ids, in order, of the (up to) capacity histograms within cutoff of query,
+// with their distances (distances may be NULL); count is set to how many
+// were within cutoff, which may exceed capacity.
+int mwisd_index_search(mwisd_index *index, const mwisd_histogram *query, \
+        double cutoff, int *ids, double *distances, size_t capacity, \
+        size_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MWISD_H_ */
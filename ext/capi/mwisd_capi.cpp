@@ -0,0 +1,488 @@
+//============================================================================
+// Name        : mwisd_capi.cpp
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : C API to mwisd_fp and histogroup (see mwisd.h).  Exceptions
+//               from the C++ API are caught here and returned as codes;
+//               compares work in place, without allocating.
+//============================================================================
+
+#include "mwisd.h"
+#include "mwisd_fp.h"
+#include "histogroup.h"
+#include "CImg.h"
+#include <string.h>
+#include <new>
+#include <vector>
+
+using namespace cimg_library;
+
+
+struct mwisd_fingerprint {
+    mwisd_fp::Fingerprint fingerprint;
+    mwisd_fingerprint(int size_in_bytes) : fingerprint(size_in_bytes) {}
+};
+
+struct mwisd_batch {
+    int size_in_bytes;
+    std::vector<uint16_t> contents;     // Fingerprints' contents, back to back.
+};
+
+struct mwisd_histogram {
+    histogroup::Fingerprint fingerprint;
+    mwisd_histogram(int bins_per_dimension) : fingerprint(bins_per_dimension) {}
+};
+
+struct mwisd_index {
+    histogroup::Index index;
+    mwisd_index(int bins_per_dimension, int pivots) : \
+        index(bins_per_dimension, true, pivots) {}
+};
+
+
+// Return code for the exception caught last, from within a catch block.
+static int caught_code() {
+    try {
+        throw;
+    }
+    catch(CImgIOException &cioe) {
+        return MWISD_ERROR_IMAGE;
+    }
+    catch(CImgArgumentException &cae) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    catch(std::bad_alloc &ba) {
+        return MWISD_ERROR_MEMORY;
+    }
+    catch(...) {
+        return MWISD_ERROR_INTERNAL;
+    }
+}
+
+
+// Writes a fingerprint's 16-bit members little-endian, as
+// Fingerprint::to_bytes().
+static void pack_fingerprint(const mwisd_fp::Fingerprint &fingerprint, \
+        unsigned char *bytes) {
+    for( int index=0; index < fingerprint.size_in_bytes/2; index++ ) {
+        bytes[2*index] = fingerprint.contents[index] & 0xFF;
+        bytes[2*index+1] = fingerprint.contents[index] >> 8;
+    }
+}
+
+
+int mwisd_abi_version(void) {
+    return MWISD_ABI_VERSION;
+}
+
+
+const char *mwisd_error_message(int code) {
+    switch( code ) {
+    case MWISD_OK:
+        return "ok";
+    case MWISD_ERROR_ARGUMENT:
+        return "invalid argument";
+    case MWISD_ERROR_IMAGE:
+        return "image unreadable, unsupported, or too large";
+    case MWISD_ERROR_BUFFER:
+        return "buffer too small";
+    case MWISD_ERROR_MEMORY:
+        return "out of memory";
+    case MWISD_ERROR_INTERNAL:
+        return "internal error";
+    }
+    return "unknown error";
+}
+
+
+int mwisd_fingerprint_create(int size_in_bytes, mwisd_fingerprint **fingerprint) {
+    int width, height;
+    if( fingerprint == NULL || mwisd_fp::hash_layout(size_in_bytes, width, height) < 1 ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    *fingerprint = new(std::nothrow) mwisd_fingerprint(size_in_bytes);
+    if( *fingerprint == NULL ) {
+        return MWISD_ERROR_MEMORY;
+    }
+    if( (*fingerprint)->fingerprint.contents == NULL ) {
+        delete *fingerprint;
+        *fingerprint = NULL;
+        return MWISD_ERROR_MEMORY;
+    }
+    memset((*fingerprint)->fingerprint.contents, 0, size_in_bytes);
+    return MWISD_OK;
+}
+
+
+void mwisd_fingerprint_destroy(mwisd_fingerprint *fingerprint) {
+    delete fingerprint;
+}
+
+
+int mwisd_fingerprint_size(const mwisd_fingerprint *fingerprint) {
+    if( fingerprint == NULL ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    return fingerprint->fingerprint.size_in_bytes;
+}
+
+
+int mwisd_fingerprint_compute(mwisd_fingerprint *fingerprint, \
+        const char *filename, int wavelet_scale_base, int wavelet_scale_exponent) {
+    if( fingerprint == NULL || filename == NULL ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    try {
+        fingerprint->fingerprint.compute_from_image_file(filename, \
+            wavelet_scale_base, wavelet_scale_exponent);
+    }
+    catch(...) {
+        return caught_code();
+    }
+    return MWISD_OK;
+}
+
+
+int mwisd_fingerprint_to_bytes(const mwisd_fingerprint *fingerprint, \
+        unsigned char *bytes, size_t capacity) {
+    if( fingerprint == NULL || bytes == NULL ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    if( capacity < (size_t)fingerprint->fingerprint.size_in_bytes ) {
+        return MWISD_ERROR_BUFFER;
+    }
+    pack_fingerprint(fingerprint->fingerprint, bytes);
+    return MWISD_OK;
+}
+
+
+int mwisd_fingerprint_from_bytes(mwisd_fingerprint *fingerprint, \
+        const unsigned char *bytes, size_t length) {
+    if( fingerprint == NULL || bytes == NULL || \
+            length != (size_t)fingerprint->fingerprint.size_in_bytes ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    for( size_t index=0; index < length/2; index++ ) {
+        fingerprint->fingerprint.contents[index] = \
+            bytes[2*index] | (bytes[2*index+1] << 8);
+    }
+    return MWISD_OK;
+}
+
+
+int mwisd_fingerprint_compare(const mwisd_fingerprint *fingerprint_1, \
+        const mwisd_fingerprint *fingerprint_2, double *similarity) {
+    if( fingerprint_1 == NULL || fingerprint_2 == NULL || similarity == NULL || \
+            fingerprint_1->fingerprint.size_in_bytes != \
+            fingerprint_2->fingerprint.size_in_bytes ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    *similarity = 1.0 - mwisd_fp::hamming_distance( \
+        fingerprint_1->fingerprint.contents, fingerprint_2->fingerprint.contents, \
+        fingerprint_1->fingerprint.size_in_bytes);
+    return MWISD_OK;
+}
+
+
+int mwisd_compare_bytes(const unsigned char *bytes_1, \
+        const unsigned char *bytes_2, size_t length, double *similarity) {
+    if( bytes_1 == NULL || bytes_2 == NULL || similarity == NULL || length == 0 ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    *similarity = 1.0 - mwisd_fp::hamming_distance_bytes((const char*)bytes_1, \
+        (const char*)bytes_2, (int)length);
+    return MWISD_OK;
+}
+
+
+int mwisd_batch_create(int size_in_bytes, mwisd_batch **batch) {
+    int width, height;
+    if( batch == NULL || mwisd_fp::hash_layout(size_in_bytes, width, height) < 1 ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    *batch = new(std::nothrow) mwisd_batch;
+    if( *batch == NULL ) {
+        return MWISD_ERROR_MEMORY;
+    }
+    (*batch)->size_in_bytes = size_in_bytes;
+    return MWISD_OK;
+}
+
+
+void mwisd_batch_destroy(mwisd_batch *batch) {
+    delete batch;
+}
+
+
+int mwisd_batch_size(const mwisd_batch *batch) {
+    if( batch == NULL ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    return (int)(batch->contents.size() / (batch->size_in_bytes/2));
+}
+
+
+int mwisd_batch_add(mwisd_batch *batch, const mwisd_fingerprint *fingerprint, \
+        int *index) {
+    if( batch == NULL || fingerprint == NULL || \
+            fingerprint->fingerprint.size_in_bytes != batch->size_in_bytes ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    const uint16_t *contents = fingerprint->fingerprint.contents;
+    try {
+        batch->contents.insert(batch->contents.end(), contents, \
+            contents + batch->size_in_bytes/2);
+    }
+    catch(...) {
+        return caught_code();
+    }
+    if( index != NULL ) {
+        *index = mwisd_batch_size(batch) - 1;
+    }
+    return MWISD_OK;
+}
+
+
+int mwisd_batch_add_bytes(mwisd_batch *batch, const unsigned char *bytes, \
+        size_t length, int *index) {
+    if( batch == NULL || bytes == NULL || length != (size_t)batch->size_in_bytes ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    try {
+        batch->contents.reserve(batch->contents.size() + length/2);
+        for( size_t index=0; index < length/2; index++ ) {
+            batch->contents.push_back(bytes[2*index] | (bytes[2*index+1] << 8));
+        }
+    }
+    catch(...) {
+        return caught_code();
+    }
+    if( index != NULL ) {
+        *index = mwisd_batch_size(batch) - 1;
+    }
+    return MWISD_OK;
+}
+
+
+int mwisd_batch_compare(const mwisd_batch *batch, \
+        const mwisd_fingerprint *query, float *similarities, size_t capacity) {
+    if( batch == NULL || query == NULL || similarities == NULL || \
+            query->fingerprint.size_in_bytes != batch->size_in_bytes ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    const int count = mwisd_batch_size(batch);
+    if( capacity < (size_t)count ) {
+        return MWISD_ERROR_BUFFER;
+    }
+    const int size = batch->size_in_bytes;
+    for( int index=0; index < count; index++ ) {
+        similarities[index] = (float)(1.0 - mwisd_fp::hamming_distance( \
+            query->fingerprint.contents, \
+            const_cast<uint16_t*>(&batch->contents[(size_t)index * size/2]), size));
+    }
+    return MWISD_OK;
+}
+
+
+int mwisd_batch_match(const mwisd_batch *batch, \
+        const mwisd_fingerprint *query, double threshold, int *indices, \
+        float *similarities, size_t capacity, size_t *count) {
+    if( batch == NULL || query == NULL || count == NULL || \
+            (capacity > 0 && (indices == NULL || similarities == NULL)) || \
+            query->fingerprint.size_in_bytes != batch->size_in_bytes ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+
+    // Keeps the best capacity matches sorted in the caller's buffers, each
+    // new one inserted after those at least as similar.
+    const int size = batch->size_in_bytes;
+    const int batch_size = mwisd_batch_size(batch);
+    size_t kept = 0;
+    *count = 0;
+    for( int index=0; index < batch_size; index++ ) {
+        const float similarity = (float)(1.0 - mwisd_fp::hamming_distance( \
+            query->fingerprint.contents, \
+            const_cast<uint16_t*>(&batch->contents[(size_t)index * size/2]), size));
+        if( similarity < threshold ) {
+            continue;
+        }
+        ++*count;
+        if( kept == capacity && (kept == 0 || similarity <= similarities[kept-1]) ) {
+            continue;
+        }
+        size_t slot = (kept < capacity) ? kept++ : kept - 1;
+        for( ; slot > 0 && similarities[slot-1] < similarity; slot-- ) {
+            indices[slot] = indices[slot-1];
+            similarities[slot] = similarities[slot-1];
+        }
+        indices[slot] = index;
+        similarities[slot] = similarity;
+    }
+    return MWISD_OK;
+}
+
+
+int mwisd_histogram_create(int bins_per_dimension, mwisd_histogram **histogram) {
+    if( histogram == NULL || bins_per_dimension < 2 ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    *histogram = new(std::nothrow) mwisd_histogram(bins_per_dimension);
+    if( *histogram == NULL ) {
+        return MWISD_ERROR_MEMORY;
+    }
+    if( (*histogram)->fingerprint.contents == NULL ) {
+        delete *histogram;
+        *histogram = NULL;
+        return MWISD_ERROR_MEMORY;
+    }
+    const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    std::fill((*histogram)->fingerprint.contents, \
+        (*histogram)->fingerprint.contents + bins, 0.0f);
+    return MWISD_OK;
+}
+
+
+void mwisd_histogram_destroy(mwisd_histogram *histogram) {
+    delete histogram;
+}
+
+
+int mwisd_histogram_bins(const mwisd_histogram *histogram) {
+    if( histogram == NULL ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    const int bins_per_band = histogram->fingerprint.bins_per_band;
+    return bins_per_band * bins_per_band * bins_per_band;
+}
+
+
+int mwisd_histogram_compute(mwisd_histogram *histogram, const char *filename) {
+    if( histogram == NULL || filename == NULL ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    try {
+        histogram->fingerprint.compute_from_image_file(filename);
+    }
+    catch(...) {
+        return caught_code();
+    }
+    return MWISD_OK;
+}
+
+
+int mwisd_histogram_values(const mwisd_histogram *histogram, float *values, \
+        size_t capacity) {
+    if( histogram == NULL || values == NULL ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    const int bins = mwisd_histogram_bins(histogram);
+    if( capacity < (size_t)bins ) {
+        return MWISD_ERROR_BUFFER;
+    }
+    std::copy(histogram->fingerprint.contents, \
+        histogram->fingerprint.contents + bins, values);
+    return MWISD_OK;
+}
+
+
+int mwisd_histogram_set_values(mwisd_histogram *histogram, \
+        const float *values, size_t count) {
+    if( histogram == NULL || values == NULL || \
+            count != (size_t)mwisd_histogram_bins(histogram) ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    std::copy(values, values + count, histogram->fingerprint.contents);
+    return MWISD_OK;
+}
+
+
+int mwisd_histogram_compare(const mwisd_histogram *histogram_1, \
+        const mwisd_histogram *histogram_2, double *distance) {
+    if( histogram_1 == NULL || histogram_2 == NULL || distance == NULL || \
+            histogram_1->fingerprint.bins_per_band != \
+            histogram_2->fingerprint.bins_per_band ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    *distance = histogroup::compare_chisquare(histogram_1->fingerprint.contents, \
+        histogram_2->fingerprint.contents, histogram_1->fingerprint.bins_per_band);
+    return MWISD_OK;
+}
+
+
+int mwisd_index_create(int bins_per_dimension, int pivots, mwisd_index **index) {
+    if( index == NULL || bins_per_dimension < 2 || pivots < 0 ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    try {
+        *index = new mwisd_index(bins_per_dimension, pivots);
+    }
+    catch(...) {
+        *index = NULL;
+        return caught_code();
+    }
+    return MWISD_OK;
+}
+
+
+void mwisd_index_destroy(mwisd_index *index) {
+    delete index;
+}
+
+
+int mwisd_index_size(const mwisd_index *index) {
+    if( index == NULL ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    return index->index.size();
+}
+
+
+int mwisd_index_add(mwisd_index *index, const mwisd_histogram *histogram, \
+        int *id) {
+    if( index == NULL || histogram == NULL || \
+            histogram->fingerprint.bins_per_band != index->index.bins_per_band ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    try {
+        const int added = index->index.add_hash(histogram->fingerprint.contents);
+        if( id != NULL ) {
+            *id = added;
+        }
+    }
+    catch(...) {
+        return caught_code();
+    }
+    return MWISD_OK;
+}
+
+
+int mwisd_index_search(mwisd_index *index, const mwisd_histogram *query, \
+        double cutoff, int *ids, double *distances, size_t capacity, \
+        size_t *count) {
+    if( index == NULL || query == NULL || count == NULL || \
+            (capacity > 0 && ids == NULL) || \
+            query->fingerprint.bins_per_band != index->index.bins_per_band ) {
+        return MWISD_ERROR_ARGUMENT;
+    }
+    try {
+        // find() rather than search_hash(), to leave Index::verified alone
+        // for searches on several threads at once.
+        std::vector<int> found;
+        std::vector<double> found_distances;
+        index->index.prepare();
+        index->index.find(query->fingerprint.contents, cutoff, found, \
+            found_distances);
+        *count = found.size();
+        for( size_t match=0; match < found.size() && match < capacity; match++ ) {
+            ids[match] = found[match];
+            if( distances != NULL ) {
+                distances[match] = found_distances[match];
+            }
+        }
+    }
+    catch(...) {
+        return caught_code();
+    }
+    return MWISD_OK;
+}
@@ -0,0 +1,265 @@
+//============================================================================
+// Name        : capi_test.c
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : Exercises the C API (mwisd.h) from C99 against the spec
+//               fixtures:  the version check, creating and destroying each
+//               kind of handle, results, and the error codes returned for
+//               bad arguments, short buffers, and unreadable images.
+//============================================================================
+
+#include "mwisd.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if( !(condition) ) { \
+            fprintf(stderr, "capi_test.c:%d: failed:  %s\n", __LINE__, #condition); \
+            ++failures; \
+        } \
+    } while( 0 )
+
+static const char *fixtures = "../../spec/fixtures";
+
+// fixtures/name, in a static buffer.
+static const char *fixture(const char *name) {
+    static char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", fixtures, name);
+    return path;
+}
+
+
+static void test_version(void) {
+    CHECK(mwisd_abi_version() == MWISD_ABI_VERSION);
+    const int codes[] = { MWISD_OK, MWISD_ERROR_ARGUMENT, MWISD_ERROR_IMAGE, \
+        MWISD_ERROR_BUFFER, MWISD_ERROR_MEMORY, MWISD_ERROR_INTERNAL };
+    const int count = (int)(sizeof(codes) / sizeof(codes[0]));
+    for( int i = 0; i < count; i++ ) {
+        CHECK(mwisd_error_message(codes[i]) != NULL);
+        CHECK(strcmp(mwisd_error_message(codes[i]), "unknown error") != 0);
+        for( int j = 0; j < i; j++ ) {
+            CHECK(strcmp(mwisd_error_message(codes[i]), \
+                mwisd_error_message(codes[j])) != 0);
+        }
+    }
+    CHECK(strcmp(mwisd_error_message(-99), "unknown error") == 0);
+}
+
+
+static void test_fingerprint(void) {
+    mwisd_fingerprint *fingerprint = NULL, *other = NULL, *larger = NULL;
+    CHECK(mwisd_fingerprint_create(0, &fingerprint) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_fingerprint_create(-128, &fingerprint) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_fingerprint_create(100, &fingerprint) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_fingerprint_create(128, NULL) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_fingerprint_size(NULL) == MWISD_ERROR_ARGUMENT);
+    mwisd_fingerprint_destroy(NULL);
+
+    CHECK(mwisd_fingerprint_create(128, &fingerprint) == MWISD_OK);
+    CHECK(mwisd_fingerprint_create(128, &other) == MWISD_OK);
+    CHECK(mwisd_fingerprint_create(256, &larger) == MWISD_OK);
+    if( fingerprint == NULL || other == NULL || larger == NULL ) {
+        ++failures;
+        return;
+    }
+    CHECK(mwisd_fingerprint_size(fingerprint) == 128);
+    CHECK(mwisd_fingerprint_size(larger) == 256);
+
+    CHECK(mwisd_fingerprint_compute(fingerprint, NULL, 2, 1) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_fingerprint_compute(fingerprint, fixture("missing.jpg"), 2, 1) == \
+        MWISD_ERROR_IMAGE);
+    CHECK(mwisd_fingerprint_compute(fingerprint, fixture("gray_alpha.png"), 2, 1) == \
+        MWISD_ERROR_IMAGE);
+    CHECK(mwisd_fingerprint_compute(fingerprint, fixture("grandpa_0401.jpg"), 2, 1) == \
+        MWISD_OK);
+    CHECK(mwisd_fingerprint_compute(larger, fixture("grandpa_0401.jpg"), 2, 1) == \
+        MWISD_OK);
+
+    unsigned char bytes[256];
+    CHECK(mwisd_fingerprint_to_bytes(fingerprint, bytes, 64) == MWISD_ERROR_BUFFER);
+    CHECK(mwisd_fingerprint_to_bytes(fingerprint, NULL, 128) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_fingerprint_to_bytes(fingerprint, bytes, sizeof(bytes)) == MWISD_OK);
+    CHECK(mwisd_fingerprint_from_bytes(other, bytes, 127) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_fingerprint_from_bytes(other, bytes, 256) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_fingerprint_from_bytes(other, bytes, 128) == MWISD_OK);
+
+    double similarity = -1.0;
+    CHECK(mwisd_fingerprint_compare(fingerprint, other, &similarity) == MWISD_OK);
+    CHECK(similarity == 1.0);
+    CHECK(mwisd_fingerprint_compare(fingerprint, larger, &similarity) == \
+        MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_fingerprint_compare(fingerprint, other, NULL) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_fingerprint_compute(other, fixture("grandpa_0401a.jpg"), 2, 1) == \
+        MWISD_OK);
+    CHECK(mwisd_fingerprint_compare(fingerprint, other, &similarity) == MWISD_OK);
+    CHECK(similarity > 0.93 && similarity < 1.0);
+
+    unsigned char other_bytes[128];
+    double bytes_similarity = -1.0;
+    CHECK(mwisd_fingerprint_to_bytes(other, other_bytes, sizeof(other_bytes)) == \
+        MWISD_OK);
+    CHECK(mwisd_compare_bytes(bytes, other_bytes, 128, &bytes_similarity) == MWISD_OK);
+    CHECK(bytes_similarity == similarity);
+    CHECK(mwisd_compare_bytes(bytes, other_bytes, 0, &bytes_similarity) == \
+        MWISD_ERROR_ARGUMENT);
+
+    mwisd_fingerprint_destroy(fingerprint);
+    mwisd_fingerprint_destroy(other);
+    mwisd_fingerprint_destroy(larger);
+}
+
+
+static void test_batch(void) {
+    mwisd_batch *batch = NULL;
+    mwisd_fingerprint *query = NULL, *other = NULL, *larger = NULL;
+    CHECK(mwisd_batch_create(100, &batch) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_batch_create(128, NULL) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_batch_size(NULL) == MWISD_ERROR_ARGUMENT);
+    mwisd_batch_destroy(NULL);
+
+    CHECK(mwisd_batch_create(128, &batch) == MWISD_OK);
+    CHECK(mwisd_fingerprint_create(128, &query) == MWISD_OK);
+    CHECK(mwisd_fingerprint_create(128, &other) == MWISD_OK);
+    CHECK(mwisd_fingerprint_create(256, &larger) == MWISD_OK);
+    if( batch == NULL || query == NULL || other == NULL || larger == NULL ) {
+        ++failures;
+        return;
+    }
+    CHECK(mwisd_fingerprint_compute(query, fixture("grandpa_0401.jpg"), 2, 1) == \
+        MWISD_OK);
+    CHECK(mwisd_fingerprint_compute(other, fixture("flag.jpg"), 2, 1) == MWISD_OK);
+    CHECK(mwisd_batch_size(batch) == 0);
+
+    int index = -1;
+    CHECK(mwisd_batch_add(batch, other, &index) == MWISD_OK);
+    CHECK(index == 0);
+    unsigned char bytes[128];
+    CHECK(mwisd_fingerprint_to_bytes(query, bytes, sizeof(bytes)) == MWISD_OK);
+    CHECK(mwisd_batch_add_bytes(batch, bytes, sizeof(bytes), &index) == MWISD_OK);
+    CHECK(index == 1);
+    CHECK(mwisd_batch_add_bytes(batch, bytes, 64, &index) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_batch_add(batch, larger, &index) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_batch_size(batch) == 2);
+
+    float similarities[2];
+    CHECK(mwisd_batch_compare(batch, query, similarities, 1) == MWISD_ERROR_BUFFER);
+    CHECK(mwisd_batch_compare(batch, larger, similarities, 2) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_batch_compare(batch, query, similarities, 2) == MWISD_OK);
+    CHECK(similarities[1] == 1.0f);
+    CHECK(similarities[0] < 1.0f);
+
+    int indices[2] = { -1, -1 };
+    size_t count = 0;
+    CHECK(mwisd_batch_match(batch, query, 0.0, indices, similarities, 1, &count) == \
+        MWISD_OK);
+    CHECK(count == 2);
+    CHECK(indices[0] == 1 && similarities[0] == 1.0f);
+    CHECK(mwisd_batch_match(batch, query, 0.0, NULL, NULL, 0, &count) == MWISD_OK);
+    CHECK(count == 2);
+    CHECK(mwisd_batch_match(batch, query, 0.0, NULL, NULL, 1, &count) == \
+        MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_batch_match(batch, query, 0.0, indices, similarities, 2, NULL) == \
+        MWISD_ERROR_ARGUMENT);
+
+    mwisd_batch_destroy(batch);
+    mwisd_fingerprint_destroy(query);
+    mwisd_fingerprint_destroy(other);
+    mwisd_fingerprint_destroy(larger);
+}
+
+
+static void test_histogram_and_index(void) {
+    mwisd_histogram *histogram = NULL, *other = NULL, *smaller = NULL;
+    mwisd_index *index = NULL;
+    CHECK(mwisd_histogram_create(1, &histogram) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_histogram_create(4, NULL) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_histogram_bins(NULL) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_index_create(4, -1, &index) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_index_create(1, 0, &index) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_index_size(NULL) == MWISD_ERROR_ARGUMENT);
+    mwisd_histogram_destroy(NULL);
+    mwisd_index_destroy(NULL);
+
+    CHECK(mwisd_histogram_create(4, &histogram) == MWISD_OK);
+    CHECK(mwisd_histogram_create(4, &other) == MWISD_OK);
+    CHECK(mwisd_histogram_create(2, &smaller) == MWISD_OK);
+    CHECK(mwisd_index_create(4, 0, &index) == MWISD_OK);
+    if( histogram == NULL || other == NULL || smaller == NULL || index == NULL ) {
+        ++failures;
+        return;
+    }
+    CHECK(mwisd_histogram_bins(histogram) == 64);
+    CHECK(mwisd_histogram_bins(smaller) == 8);
+
+    CHECK(mwisd_histogram_compute(histogram, NULL) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_histogram_compute(histogram, fixture("missing.jpg")) < MWISD_OK);
+    CHECK(mwisd_histogram_compute(histogram, fixture("gray_alpha.png")) < MWISD_OK);
+    CHECK(mwisd_histogram_compute(histogram, fixture("grandpa_0401.jpg")) == MWISD_OK);
+    CHECK(mwisd_histogram_compute(other, fixture("flag.jpg")) == MWISD_OK);
+
+    float values[64];
+    CHECK(mwisd_histogram_values(histogram, values, 63) == MWISD_ERROR_BUFFER);
+    CHECK(mwisd_histogram_values(histogram, values, 64) == MWISD_OK);
+    CHECK(mwisd_histogram_set_values(smaller, values, 64) == MWISD_ERROR_ARGUMENT);
+    double distance = -1.0;
+    CHECK(mwisd_histogram_compare(histogram, other, &distance) == MWISD_OK);
+    CHECK(distance > 0.0);
+    CHECK(mwisd_histogram_set_values(other, values, 64) == MWISD_OK);
+    CHECK(mwisd_histogram_compare(histogram, other, &distance) == MWISD_OK);
+    CHECK(distance == 0.0);
+    CHECK(mwisd_histogram_compare(histogram, smaller, &distance) == \
+        MWISD_ERROR_ARGUMENT);
+
+    int id = -1;
+    CHECK(mwisd_index_add(index, smaller, &id) == MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_index_add(index, histogram, &id) == MWISD_OK);
+    CHECK(id == 0);
+    CHECK(mwisd_histogram_compute(other, fixture("flag.jpg")) == MWISD_OK);
+    CHECK(mwisd_index_add(index, other, &id) == MWISD_OK);
+    CHECK(id == 1);
+    CHECK(mwisd_index_size(index) == 2);
+
+    int ids[2] = { -1, -1 };
+    double distances[2];
+    size_t count = 0;
+    CHECK(mwisd_index_search(index, histogram, 0.001, ids, distances, 2, &count) == \
+        MWISD_OK);
+    CHECK(count == 1 && ids[0] == 0 && distances[0] == 0.0);
+    CHECK(mwisd_index_search(index, histogram, 1000.0, NULL, NULL, 0, &count) == \
+        MWISD_OK);
+    CHECK(count == 2);
+    CHECK(mwisd_index_search(index, histogram, 1000.0, NULL, NULL, 1, &count) == \
+        MWISD_ERROR_ARGUMENT);
+    CHECK(mwisd_index_search(index, smaller, 1000.0, ids, NULL, 2, &count) == \
+        MWISD_ERROR_ARGUMENT);
+
+    mwisd_index_destroy(index);
+    mwisd_histogram_destroy(histogram);
+    mwisd_histogram_destroy(other);
+    mwisd_histogram_destroy(smaller);
+}
+
+
+int main(int argc, char** argv) {
+    if( argc > 2 ) {
+        puts("Expected:  \"capi_test [fixtures_directory]\"");
+        return EXIT_FAILURE;
+    }
+    if( argc == 2 ) {
+        fixtures = argv[1];
+    }
+    test_version();
+    test_fingerprint();
+    test_batch();
+    test_histogram_and_index();
+    if( failures > 0 ) {
+        fprintf(stderr, "capi_test:  %d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
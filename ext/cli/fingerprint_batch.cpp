@@ -0,0 +1,317 @@
+//============================================================================
+// Name        : fingerprint_batch.cpp
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : Fingerprints many images at once through image_io::Pipeline:
+//               files are read into memory (through io_uring, where the
+//               kernel has it) while threads decode and fingerprint others,
+//               and results are printed in input order.
+//============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "mwisd_fp.h"
+#include "histogroup.h"
+#include "image_io.h"
+#include "pipeline.h"
+#include "CImg.h"
+
+using namespace cimg_library;
+
+
+// A batch run's settings and inputs, shared by all stages.
+struct BatchJob {
+    bool mwisd, histogroup;
+    int mwisd_size, heat_map_dim, histogroup_size;
+    image_io::DecodeOptions options;
+    bool stop_on_error;
+    image_io::Pipeline *pipeline;
+    char **filenames;       // From the command line; NULL:  read stdin.
+    int next_filename, filename_count;
+    uint64_t bytes;
+    int failures;
+};
+
+
+// Buffers of one pipeline item, kept from one image to the next.
+struct BatchState {
+    CImg<uint8_t> grayscale;
+    std::vector<float> heat_map;
+    std::vector<uint16_t> mwisd_hash;
+    std::vector<float> histogroup_hash;
+    uint64_t bytes;
+};
+
+
+static bool next_filename(void *job, std::string &filename) {
+    BatchJob *batch = (BatchJob*)job;
+    if( batch->filenames != NULL ) {
+        if( batch->next_filename == batch->filename_count ) {
+            return false;
+        }
+        filename = batch->filenames[batch->next_filename++];
+        return true;
+    }
+    char line[4096];
+    while( fgets(line, sizeof(line), stdin) != NULL ) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if( line[0] != '\0' ) {
+            filename = line;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+static void *create_state(void *job) {
+    BatchJob *batch = (BatchJob*)job;
+    BatchState *state = new BatchState;
+    state->heat_map.resize(batch->heat_map_dim * batch->heat_map_dim);
+    state->mwisd_hash.resize(batch->mwisd_size / sizeof(uint16_t));
+    state->histogroup_hash.resize(batch->histogroup_size / sizeof(float));
+    state->bytes = 0;
+    return state;
+}
+
+
+static void destroy_state(void *, void *state) {
+    delete (BatchState*)state;
+}
+
+
+// The pipeline has read the file already, unless only prefetching.
+static int read_stage(void *, image_io::PipelineItem &item) {
+    BatchState *state = (BatchState*)item.state;
+    if( item.data != NULL ) {
+        state->bytes = item.length;
+        return 1;
+    }
+    state->bytes = 0;
+    return image_io::prefetch_file(item.filename.c_str(), &state->bytes);
+}
+
+
+// Decoding through the standardized grayscale image for mwisd_fp; all of
+// histogroup, whose histogram is counted as (or right after) it decodes.
+// Both decode the contents read in, where they can.
+static int decode_stage(void *job, image_io::PipelineItem &item) {
+    BatchJob *batch = (BatchJob*)job;
+    BatchState *state = (BatchState*)item.state;
+    int retval = 1;
+    if( batch->mwisd ) {
+        retval = mwisd_fp::prepare_grayscale(item.filename.c_str(), \
+            item.data, item.length, state->grayscale, batch->heat_map_dim, \
+            batch->options);
+    }
+    if( retval == 1 && batch->histogroup ) {
+        float *hash = &state->histogroup_hash[0];
+        // One thread per image:  the pipeline already runs images in parallel.
+        retval = histogroup::compute_image_hash(item.filename.c_str(), \
+            item.data, item.length, hash, batch->histogroup_size, 4, \
+            batch->options, 1, 0, NULL);
+    }
+    return retval;
+}
+
+
+static int compute_stage(void *job, image_io::PipelineItem &item) {
+    BatchJob *batch = (BatchJob*)job;
+    BatchState *state = (BatchState*)item.state;
+    if( not batch->mwisd ) {
+        return 1;
+    }
+    int retval = mwisd_fp::heat_map_from_grayscale(state->grayscale, \
+        &state->heat_map[0], batch->heat_map_dim, 2, 1);
+    if( retval == 1 ) {
+        uint16_t *hash = &state->mwisd_hash[0];
+        retval = mwisd_fp::hash_from_heat_map(&state->heat_map[0], \
+            batch->heat_map_dim, hash, batch->mwisd_size);
+    }
+    return retval;
+}
+
+
+static int emit_stage(void *job, image_io::PipelineItem &item) {
+    static const char *stage_names[image_io::pipeline_stages] = \
+        { "read", "decode", "compute", "emit" };
+    BatchJob *batch = (BatchJob*)job;
+    BatchState *state = (BatchState*)item.state;
+    batch->bytes += state->bytes;
+    printf("%s", item.filename.c_str());
+    if( item.status < 1 ) {
+        printf("\tError: %s returned %d\n", stage_names[item.failed_stage], \
+            item.status);
+        batch->failures++;
+        if( batch->stop_on_error ) {
+            batch->pipeline->cancel();
+        }
+        return 1;
+    }
+    if( batch->mwisd ) {
+        printf("\t");
+        for( size_t index=0; index < state->mwisd_hash.size(); index++ ) {
+            printf("%5u ", state->mwisd_hash[index]);
+        }
+    }
+    if( batch->histogroup ) {
+        printf("\t");
+        for( size_t index=0; index < state->histogroup_hash.size(); index++ ) {
+            printf("%9.7f ", state->histogroup_hash[index]);
+        }
+    }
+    printf("\n");
+    return 1;
+}
+
+
+static void print_stats(const image_io::Pipeline &pipeline, const BatchJob &batch) {
+    static const char *stage_names[image_io::pipeline_stages] = \
+        { "read", "decode", "compute", "emit" };
+    const double elapsed = pipeline.elapsed_seconds();
+    const image_io::PipelineStats &emitted = pipeline.stats(image_io::stage_emit);
+    fprintf(stderr, "# %llu images, %d failed, %.1f MB read in %.2f s:  %.1f images/s, %.1f MB/s\n", \
+        (unsigned long long)emitted.items, batch.failures, batch.bytes / 1e6, \
+        elapsed, emitted.items / elapsed, batch.bytes / 1e6 / elapsed);
+    if( pipeline.io_uring() ) {
+        fprintf(stderr, "# files read through io_uring, %d of %d buffers registered\n", \
+            pipeline.registered_buffers(), pipeline.in_flight());
+    } else {
+        fprintf(stderr, "# files read by threads\n");
+    }
+    fprintf(stderr, "# stage    threads  utilization  busy (s)  starved (s)  blocked (s)\n");
+    for( int stage = 0; stage < image_io::pipeline_stages; stage++ ) {
+        const image_io::PipelineStats &stats = pipeline.stats(stage);
+        const double capacity = stats.threads * elapsed;
+        fprintf(stderr, "# %-8s %7d  %10.1f%%  %8.2f  %11.2f  %11.2f\n", \
+            stage_names[stage], stats.threads, \
+            (capacity > 0.0) ? 100.0 * stats.busy_seconds / capacity : 0.0, \
+            stats.busy_seconds, stats.starved_seconds, stats.blocked_seconds);
+    }
+}
+
+
+static void usage() {
+    puts("Expected:  \"fingerprint_batch [options] [image_file ...]\"");
+    puts("     image_file:  images to fingerprint (default:  one per line on stdin)");
+    puts("     -t type:  mwisd, histogroup, or both (default)");
+    puts("     -b hash_size_in_bits:  mwisd power of two, e.g. 256, 1024 (default), 2048");
+    puts("     -r threads:  reader threads without io_uring (default 1; more for NFS and SSDs)");
+    puts("     -i depth:  files being read at once (default 0, 32)");
+    puts("     -u:  read by threads and posix_fadvise, even where io_uring is available");
+    puts("     -f:  only prefetch files into the page cache, for decoding from there");
+    puts("     -B buffer_size_in_kb:  read buffer per file in flight (default 0, 256 KB; larger files get their own)");
+    puts("     -d threads:  decoding threads (default 0, one per CPU)");
+    puts("     -c threads:  fingerprinting threads (default 0, one per CPU)");
+    puts("     -q length:  items queued between stages (default 0, twice their threads)");
+    puts("     -m memory_cap_in_kb:  stream larger images (default 0, no cap)");
+    puts("     -p preview_min_dim:  use an embedded JPEG preview at least this large (default 0, never)");
+    puts("     -x:  stop at the first image that fails");
+    puts("     -s:  print throughput and per-stage utilization to stderr");
+    puts("");
+    puts("Prints a line per image, in input order:  its name, then its mwisd_fp");
+    puts("and/or histogroup fingerprint as mwisd_fp_gen and histogroup_gen do");
+    puts("(tab separated), or the stage that failed and its error code.");
+}
+
+
+int main(int argc, char** argv) {
+    BatchJob batch;
+    batch.mwisd = batch.histogroup = true;
+    batch.mwisd_size = mwisd_fp::default_hash_size_in_bytes;
+    batch.histogroup_size = histogroup::default_hash_size_in_bytes;
+    batch.stop_on_error = false;
+    batch.bytes = 0;
+    batch.failures = 0;
+    image_io::PipelineOptions pipeline_options;
+    pipeline_options.read_contents = true;
+    bool show_stats = false;
+
+    int option;
+    while( (option = getopt(argc, argv, "t:b:r:i:ufB:d:c:q:m:p:xsh")) != -1 ) {
+        switch( option ) {
+        case 't':
+            batch.mwisd = (strcmp(optarg, "histogroup") != 0);
+            batch.histogroup = (strcmp(optarg, "mwisd") != 0);
+            break;
+        case 'b':
+            batch.mwisd_size = atoi(optarg) / 8;
+            break;
+        case 'r':
+            pipeline_options.reader_threads = atoi(optarg);
+            break;
+        case 'i':
+            pipeline_options.io_depth = atoi(optarg);
+            break;
+        case 'u':
+            pipeline_options.use_io_uring = false;
+            break;
+        case 'f':
+            pipeline_options.read_contents = false;
+            break;
+        case 'B':
+            pipeline_options.buffer_size = (size_t)atol(optarg) * 1024;
+            break;
+        case 'd':
+            pipeline_options.decoder_threads = atoi(optarg);
+            break;
+        case 'c':
+            pipeline_options.compute_threads = atoi(optarg);
+            break;
+        case 'q':
+            pipeline_options.queue_length = atoi(optarg);
+            break;
+        case 'm':
+            batch.options.memory_cap = (uint64_t)atol(optarg) * 1024;
+            break;
+        case 'p':
+            batch.options.preview_min_dim = atoi(optarg);
+            break;
+        case 'x':
+            batch.stop_on_error = true;
+            break;
+        case 's':
+            show_stats = true;
+            break;
+        default:
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+    int heat_map_height;
+    if( mwisd_fp::hash_layout(batch.mwisd_size, batch.heat_map_dim, \
+            heat_map_height) < 1 ) {
+        printf("Error:  unsupported hash_size_in_bits.\n");
+        return EXIT_FAILURE;
+    }
+    batch.filenames = (optind < argc) ? argv + optind : NULL;
+    batch.next_filename = 0;
+    batch.filename_count = argc - optind;
+
+    image_io::PipelineFunctions functions;
+    functions.source = next_filename;
+    functions.stages[image_io::stage_read] = read_stage;
+    functions.stages[image_io::stage_decode] = decode_stage;
+    functions.stages[image_io::stage_compute] = batch.mwisd ? compute_stage : NULL;
+    functions.stages[image_io::stage_emit] = emit_stage;
+    functions.create_state = create_state;
+    functions.destroy_state = destroy_state;
+    image_io::Pipeline pipeline(functions, &batch, pipeline_options);
+    batch.pipeline = &pipeline;
+
+    int ret = pipeline.run();
+    fflush(stdout);
+    if( show_stats ) {
+        print_stats(pipeline, batch);
+    }
+    if( ret < 1 && ret != image_io::error_pipeline_cancelled ) {
+        printf("Error: Pipeline::run returned %d\n", ret);
+    }
+    return (ret == image_io::pipeline_ok && batch.failures == 0) ? \
+        EXIT_SUCCESS : EXIT_FAILURE;
+}
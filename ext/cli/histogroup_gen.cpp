@@ -17,14 +17,24 @@ int main(int argc, char** argv) {
 
     if( argc < 2 ) {
         puts("No input arguments!");
-        puts("Expected:  \"histogroup_gen image_file\"");
+        puts("Expected:  \"histogroup_gen image_file [memory_cap_in_kb] [preview_min_dim]\"");
+        puts("     memory_cap_in_kb:  stream larger images (default 0, no cap)");
+        puts("     preview_min_dim:  use an embedded JPEG preview at least this large (default 0, never)");
         return EXIT_FAILURE;
     }
 
     int hash_size_in_bytes = default_hash_size_in_bytes;
     float* image_hash = (float*)malloc(hash_size_in_bytes*sizeof(uint8_t));
+    image_io::DecodeOptions options;
+    if( argc > 2 ) {
+        options.memory_cap = (uint64_t)atol(argv[2]) * 1024;
+    }
+    if( argc > 3 ) {
+        options.preview_min_dim = atoi(argv[3]);
+    }
 
-    int ret = compute_image_hash(argv[1], image_hash, hash_size_in_bytes, 4);
+    int ret = compute_image_hash(argv[1], image_hash, hash_size_in_bytes, 4, \
+            options);
 
     if( ret < 1 ) {
         printf("Error: compute_image_hash returned %d\n", ret);
@@ -13,18 +13,46 @@
 
 using namespace mwisd_fp;
 
+static void usage() {
+    puts("Expected:  \"mwisd_fp_gen image_file [hash_size_in_bits] [memory_cap_in_kb] [preview_min_dim]\"");
+    puts("     hash_size_in_bits:  power of two from 16, e.g. 256, 1024 (default), 2048");
+    puts("     memory_cap_in_kb:  stream larger images (default 0, no cap)");
+    puts("     preview_min_dim:  use an embedded JPEG preview at least this large (default 0, never)");
+}
+
+
 int main(int argc, char** argv) {
 
     if( argc < 2 ) {
         puts("No input arguments!");
-        puts("Expected:  \"mwisd_fp_gen image_file\"");
+        usage();
         return EXIT_FAILURE;
     }
 
     int hash_size_in_bytes = default_hash_size_in_bytes;
+    if( argc > 2 ) {
+        // Whole bytes, and a layout hash_layout() supports.
+        const int bits = atoi(argv[2]);
+        int heat_map_width, heat_map_height;
+        if( bits <= 0 || bits % 8 != 0 || \
+                hash_layout(bits / 8, heat_map_width, heat_map_height) < 1 ) {
+            printf("Error:  unsupported hash_size_in_bits %s.\n", argv[2]);
+            usage();
+            return EXIT_FAILURE;
+        }
+        hash_size_in_bytes = bits / 8;
+    }
+    image_io::DecodeOptions options;
+    if( argc > 3 ) {
+        options.memory_cap = (uint64_t)atol(argv[3]) * 1024;
+    }
+    if( argc > 4 ) {
+        options.preview_min_dim = atoi(argv[4]);
+    }
     uint16_t* image_hash = (uint16_t*)malloc(hash_size_in_bytes*sizeof(uint8_t));
 
-    int ret = compute_image_hash(argv[1], image_hash, hash_size_in_bytes, 2, 1);
+    int ret = compute_image_hash(argv[1], image_hash, hash_size_in_bytes, 2, 1, \
+            options);
 
     if( ret < 1 ) {
         printf("Error: compute_image_hash returned %d\n", ret);
@@ -0,0 +1,125 @@
+//============================================================================
+// Name        : preview_drift.cpp
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : Measures how far fingerprints computed from embedded JPEG
+//               previews (DecodeOptions::preview_min_dim) drift from those
+//               of the full images, over a corpus of files.
+//============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "mwisd_fp.h"
+#include "histogroup.h"
+#include "image_io.h"
+
+
+// Value at fraction (0..1) of the way through sorted values.
+static double percentile(std::vector<double> values, double fraction) {
+    std::sort(values.begin(), values.end());
+    size_t index = (size_t)(fraction * (values.size() - 1) + 0.5);
+    return values[index];
+}
+
+
+static double mean(const std::vector<double> &values) {
+    double sum = 0.0;
+    for( size_t i = 0; i < values.size(); i++ ) {
+        sum += values[i];
+    }
+    return sum / values.size();
+}
+
+
+int main(int argc, char** argv) {
+
+    if( argc < 2 ) {
+        puts("No input arguments!");
+        puts("Expected:  \"preview_drift preview_min_dim [image_file ...]\"");
+        puts("     preview_min_dim:  smallest preview side to accept, e.g. 120");
+        puts("     image_file:  JPEGs to measure (default:  one per line on stdin)");
+        puts("");
+        puts("Prints, per image with a qualifying preview, the mwisd_fp similarity");
+        puts("and histogroup chi-square distance between preview and full image");
+        puts("fingerprints, then a summary of both.");
+        return EXIT_FAILURE;
+    }
+
+    image_io::DecodeOptions full_options, preview_options;
+    preview_options.preview_min_dim = atoi(argv[1]);
+    if( preview_options.preview_min_dim < 1 ) {
+        printf("Error:  preview_min_dim must be positive.\n");
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> filenames(argv + 2, argv + argc);
+    if( filenames.empty() ) {
+        char line[4096];
+        while( fgets(line, sizeof(line), stdin) != NULL ) {
+            line[strcspn(line, "\r\n")] = '\0';
+            if( line[0] != '\0' ) {
+                filenames.push_back(line);
+            }
+        }
+    }
+
+    const int mw_size = mwisd_fp::default_hash_size_in_bytes;
+    const int hg_size = histogroup::default_hash_size_in_bytes;
+    std::vector<uint16_t> mw_full(mw_size / sizeof(uint16_t));
+    std::vector<uint16_t> mw_preview(mw_full.size());
+    std::vector<float> hg_full(hg_size / sizeof(float));
+    std::vector<float> hg_preview(hg_full.size());
+    std::vector<double> similarities, distances;
+    int without_preview = 0, failed = 0;
+
+    for( size_t i = 0; i < filenames.size(); i++ ) {
+        const char *filename = filenames[i].c_str();
+        image_io::EmbeddedPreview preview;
+        int retval = image_io::find_preview(filename, \
+            preview_options.preview_min_dim, preview);
+        if( retval == 0 ) {
+            without_preview++;
+            continue;
+        }
+
+        uint16_t *mw_1 = &mw_full[0], *mw_2 = &mw_preview[0];
+        float *hg_1 = &hg_full[0], *hg_2 = &hg_preview[0];
+        if( retval < 1 || \
+                mwisd_fp::compute_image_hash(filename, mw_1, mw_size, 2, 1, \
+                    full_options) < 1 || \
+                mwisd_fp::compute_image_hash(filename, mw_2, mw_size, 2, 1, \
+                    preview_options) < 1 || \
+                histogroup::compute_image_hash(filename, hg_1, hg_size, 4, \
+                    full_options) < 1 || \
+                histogroup::compute_image_hash(filename, hg_2, hg_size, 4, \
+                    preview_options) < 1 ) {
+            printf("# failed:  %s\n", filename);
+            failed++;
+            continue;
+        }
+
+        double similarity = 1.0 - mwisd_fp::hamming_distance(mw_1, mw_2, mw_size);
+        double distance = histogroup::compare_chisquare(hg_1, hg_2, 4);
+        similarities.push_back(similarity);
+        distances.push_back(distance);
+        printf("%1.5f %1.7f %dx%d %s\n", similarity, distance, \
+            preview.info.width, preview.info.height, filename);
+    }
+
+    printf("# images:  %d measured, %d without a qualifying preview, %d failed\n", \
+        (int)similarities.size(), without_preview, failed);
+    if( not similarities.empty() ) {
+        printf("# mwisd_fp similarity:  mean %1.5f  5th percentile %1.5f  min %1.5f\n", \
+            mean(similarities), percentile(similarities, 0.05), \
+            percentile(similarities, 0.0));
+        printf("# histogroup distance:  mean %1.7f  95th percentile %1.7f  max %1.7f\n", \
+            mean(distances), percentile(distances, 0.95), \
+            percentile(distances, 1.0));
+    }
+    return EXIT_SUCCESS;
+}
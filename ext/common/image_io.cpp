@@ -0,0 +1,879 @@
+//============================================================================
+// Name        : image_io.cpp
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : Image loading shared by all fingerprint types:  detects the
+//               format from the file's content (not its name) and decodes it
+//               in-process via libjpeg, libpng, or libtiff.
+//============================================================================
+
+#include "image_io.h"
+#include "scanline_reader.h"
+#include "CImg.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace cimg_library;
+
+
+// Random access to the leading part of a file or memory buffer, for header
+// parsing.
+struct ByteSource {
+    FILE *file;
+    const unsigned char *data;
+    size_t length;
+
+    bool read_at(uint64_t offset, unsigned char *buffer, size_t count) const {
+        if( file != NULL ) {
+            return fseek(file, (long)offset, SEEK_SET) == 0 && \
+                fread(buffer, 1, count, file) == count;
+        }
+        if( offset > length || count > length - offset ) {
+            return false;
+        }
+        memcpy(buffer, data + offset, count);
+        return true;
+    }
+};
+
+
+static uint32_t get_be(const unsigned char *p, int bytes) {
+    uint32_t value = 0;
+    for( int i = 0; i < bytes; i++ ) {
+        value = (value << 8) | p[i];
+    }
+    return value;
+}
+
+
+static uint64_t get_tiff(const unsigned char *p, int bytes, bool little) {
+    uint64_t value = 0;
+    for( int i = 0; i < bytes; i++ ) {
+        value = (value << 8) | p[little ? bytes - 1 - i : i];
+    }
+    return value;
+}
+
+
+image_io::image_format image_io::sniff_format(const unsigned char *header, \
+        size_t length) {
+    static const unsigned char png_signature[8] = \
+        { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+
+    if( header == NULL ) {
+        return format_unknown;
+    }
+    if( length >= 3 && header[0] == 0xFF && header[1] == 0xD8 && \
+            header[2] == 0xFF ) {
+        return format_jpeg;
+    }
+    if( length >= 8 && memcmp(header, png_signature, 8) == 0 ) {
+        return format_png;
+    }
+    // Classic (42) and BigTIFF (43), either byte order.
+    if( length >= 4 && \
+            ((header[0] == 'I' && header[1] == 'I' && \
+              (header[2] == 42 || header[2] == 43) && header[3] == 0) || \
+             (header[0] == 'M' && header[1] == 'M' && header[2] == 0 && \
+              (header[3] == 42 || header[3] == 43))) ) {
+        return format_tiff;
+    }
+    return format_unknown;
+}
+
+
+int image_io::sniff_file_format(const char *filename, image_format &format) {
+    format = format_unknown;
+    if( filename == NULL ) {
+        return error_arguments;
+    }
+
+    FILE *file = fopen(filename, "rb");
+    if( file == NULL ) {
+        return error_open;
+    }
+    unsigned char header[sniff_length];
+    size_t length = fread(header, 1, sizeof(header), file);
+    fclose(file);
+
+    format = sniff_format(header, length);
+    return (format == format_unknown) ? error_unknown_format : load_ok;
+}
+
+
+// Channels and depth follow CImg's PNG decoder:  palettes expand to RGB,
+// tRNS adds alpha, and depths below 8 bits are widened to 8.
+static int probe_png(const ByteSource &source, image_io::ImageInfo &info) {
+    unsigned char chunk[8 + 13];
+    if( not source.read_at(8, chunk, sizeof(chunk)) || \
+            memcmp(chunk + 4, "IHDR", 4) != 0 ) {
+        return image_io::error_decode;
+    }
+    const unsigned char *ihdr = chunk + 8;
+    info.width = (int)get_be(ihdr, 4);
+    info.height = (int)get_be(ihdr + 4, 4);
+    int depth = ihdr[8], color_type = ihdr[9];
+    info.progressive = (ihdr[12] != 0);
+    info.bit_depth = (depth == 16) ? 16 : 8;
+    bool color = (color_type & 2) != 0;
+    bool alpha = (color_type & 4) != 0;
+
+    // Transparency is only signalled by a tRNS chunk ahead of the image data.
+    uint64_t offset = 8 + 8 + 13 + 4;
+    while( not alpha ) {
+        if( not source.read_at(offset, chunk, 8) || \
+                memcmp(chunk + 4, "IDAT", 4) == 0 || \
+                memcmp(chunk + 4, "IEND", 4) == 0 ) {
+            break;
+        }
+        alpha = (memcmp(chunk + 4, "tRNS", 4) == 0);
+        offset += 12 + (uint64_t)get_be(chunk, 4);
+    }
+    info.channels = (color ? 3 : 1) + (alpha ? 1 : 0);
+    return image_io::load_ok;
+}
+
+
+static int probe_jpeg(const ByteSource &source, image_io::ImageInfo &info) {
+    unsigned char segment[8];
+    uint64_t offset = 2;
+    for( ;; ) {
+        if( not source.read_at(offset, segment, 2) || segment[0] != 0xFF ) {
+            return image_io::error_decode;
+        }
+        int marker = segment[1];
+        if( marker == 0xFF ) {          // Fill byte
+            offset += 1;
+            continue;
+        }
+        offset += 2;
+        if( marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7) ) {
+            continue;                   // Standalone markers
+        }
+        if( marker == 0xD9 || marker == 0xDA ) {
+            return image_io::error_decode;  // EOI / SOS before any frame
+        }
+        if( not source.read_at(offset, segment, 2) ) {
+            return image_io::error_decode;
+        }
+        uint32_t length = get_be(segment, 2);
+        // SOF0-SOF15, except DHT (C4), JPG (C8), and DAC (CC).
+        if( marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && \
+                marker != 0xC8 && marker != 0xCC ) {
+            if( length < 8 || not source.read_at(offset + 2, segment, 6) ) {
+                return image_io::error_decode;
+            }
+            info.bit_depth = segment[0];
+            info.height = (int)get_be(segment + 1, 2);
+            info.width = (int)get_be(segment + 3, 2);
+            info.channels = segment[5];
+            info.progressive = ((marker & 0x03) == 0x02);
+            return (info.height > 0) ? image_io::load_ok : image_io::error_decode;
+        }
+        offset += length;
+    }
+}
+
+
+// Reads the first IFD, which is the one CImg decodes.  Palette images expand
+// to RGB; everything libtiff's RGBA reader handles comes out 8 bits deep.
+static int probe_tiff(const ByteSource &source, image_io::ImageInfo &info) {
+    unsigned char header[16];
+    if( not source.read_at(0, header, 8) ) {
+        return image_io::error_decode;
+    }
+    bool little = (header[0] == 'I');
+    bool big_tiff = (get_tiff(header + 2, 2, little) == 43);
+    if( big_tiff && not source.read_at(8, header + 8, 8) ) {
+        return image_io::error_decode;
+    }
+    int offset_size = big_tiff ? 8 : 4;
+    int count_size = big_tiff ? 8 : 2;
+    int entry_size = big_tiff ? 20 : 12;
+    uint64_t ifd = big_tiff ? get_tiff(header + 8, 8, little) : \
+        get_tiff(header + 4, 4, little);
+
+    unsigned char entry[20];
+    if( not source.read_at(ifd, entry, count_size) ) {
+        return image_io::error_decode;
+    }
+    uint64_t entries = get_tiff(entry, count_size, little);
+    int samples = 1, bits = 1, photometric = -1;
+    info.width = info.height = 0;
+    for( uint64_t i = 0; i < entries; i++ ) {
+        if( not source.read_at(ifd + count_size + i * entry_size, entry, \
+                entry_size) ) {
+            return image_io::error_decode;
+        }
+        int tag = (int)get_tiff(entry, 2, little);
+        int type = (int)get_tiff(entry + 2, 2, little);
+        const unsigned char *value = entry + 4 + offset_size;
+        // SHORT, LONG, or LONG8; only the first value of BitsPerSample is
+        // needed, and it is inline whenever all samples share one depth.
+        int size = (type == 3) ? 2 : (type == 16) ? 8 : 4;
+        uint64_t first = get_tiff(value, size, little);
+        if( tag == 258 && get_tiff(entry + 4, offset_size, little) * 2 > \
+                (uint64_t)offset_size ) {
+            unsigned char depth[2];
+            if( not source.read_at(get_tiff(value, offset_size, little), \
+                    depth, 2) ) {
+                return image_io::error_decode;
+            }
+            first = get_tiff(depth, 2, little);
+        }
+        switch( tag ) {
+        case 256: info.width = (int)first; break;
+        case 257: info.height = (int)first; break;
+        case 258: bits = (int)first; break;
+        case 262: photometric = (int)first; break;
+        case 277: samples = (int)first; break;
+        }
+    }
+    if( info.width <= 0 || info.height <= 0 ) {
+        return image_io::error_decode;
+    }
+    info.channels = (photometric == 3) ? 3 : samples;
+    bool rgba_reader = (photometric >= 3) || \
+        (bits == 8 && (samples == 3 || samples == 4));
+    info.bit_depth = rgba_reader ? 8 : bits;
+    return image_io::load_ok;
+}
+
+
+static int probe_source(const ByteSource &source, image_io::ImageInfo &info) {
+    info = image_io::ImageInfo();
+    unsigned char header[image_io::sniff_length];
+    size_t length;
+    if( source.file != NULL ) {
+        rewind(source.file);
+        length = fread(header, 1, sizeof(header), source.file);
+    } else {
+        length = (source.length < sizeof(header)) ? source.length : \
+            sizeof(header);
+        memcpy(header, source.data, length);
+    }
+
+    image_io::image_format format = image_io::sniff_format(header, length);
+    int retval = image_io::error_unknown_format;
+    if( format == image_io::format_jpeg ) {
+        retval = probe_jpeg(source, info);
+    } else if( format == image_io::format_png ) {
+        retval = probe_png(source, info);
+    } else if( format == image_io::format_tiff ) {
+        retval = probe_tiff(source, info);
+    }
+    if( retval == image_io::load_ok ) {
+        info.format = format;
+        if( info.width <= 0 || info.height <= 0 || info.channels <= 0 ) {
+            retval = image_io::error_decode;
+        }
+    }
+    return retval;
+}
+
+
+int image_io::probe_image(const char *filename, ImageInfo &info) {
+    if( filename == NULL ) {
+        info = ImageInfo();
+        return error_arguments;
+    }
+    FILE *file = fopen(filename, "rb");
+    if( file == NULL ) {
+        info = ImageInfo();
+        return error_open;
+    }
+    ByteSource source = { file, NULL, 0 };
+    int retval = probe_source(source, info);
+    fclose(file);
+    return retval;
+}
+
+
+int image_io::probe_image(const char *data, size_t length, ImageInfo &info) {
+    if( data == NULL ) {
+        info = ImageInfo();
+        return error_arguments;
+    }
+    ByteSource source = { NULL, (const unsigned char *)data, length };
+    return probe_source(source, info);
+}
+
+
+// First value of tag in the IFD at ifd of a TIFF structure (as embedded in
+// EXIF and MPF segments); for counts too large to fit, the value's offset.
+static bool find_tiff_tag(const ByteSource &tiff, bool little, uint64_t ifd, \
+        int tag, uint64_t &value) {
+    unsigned char entry[12];
+    if( not tiff.read_at(ifd, entry, 2) ) {
+        return false;
+    }
+    uint64_t entries = get_tiff(entry, 2, little);
+    for( uint64_t i = 0; i < entries; i++ ) {
+        if( not tiff.read_at(ifd + 2 + i * 12, entry, 12) ) {
+            return false;
+        }
+        if( (int)get_tiff(entry, 2, little) == tag ) {
+            int type = (int)get_tiff(entry + 2, 2, little);
+            value = get_tiff(entry + 8, (type == 3) ? 2 : 4, little);
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// Keeps the candidate at offset in preview if it qualifies and is smaller
+// than the one already there.
+static void consider_preview(FILE *file, uint64_t offset, uint64_t length, \
+        const image_io::ImageInfo &image, int min_dim, \
+        image_io::EmbeddedPreview &preview) {
+    // The headers of an embedded JPEG fit well within its first 64 KB.
+    std::vector<unsigned char> header((size_t)std::min<uint64_t>(length, 65536));
+    image_io::ImageInfo info;
+    ByteSource source = { file, NULL, 0 };
+    if( header.empty() || \
+            not source.read_at(offset, &header[0], header.size()) || \
+            image_io::probe_image((const char *)&header[0], header.size(), \
+                info) != image_io::load_ok || \
+            info.format != image_io::format_jpeg ) {
+        return;
+    }
+    int64_t skew = (int64_t)info.width * image.height - \
+        (int64_t)info.height * image.width;
+    if( info.width < min_dim || info.height < min_dim || \
+            info.width >= image.width || \
+            (skew < 0 ? -skew : skew) > (int64_t)image.width + image.height ) {
+        return;
+    }
+    if( preview.length == 0 || (uint64_t)info.width * info.height < \
+            (uint64_t)preview.info.width * preview.info.height ) {
+        preview.offset = offset;
+        preview.length = length;
+        preview.info = info;
+    }
+}
+
+
+// The EXIF thumbnail is IFD1's JPEGInterchangeFormat; offsets are relative
+// to the TIFF header following "Exif\0\0".
+static void find_exif_preview(FILE *file, const std::vector<unsigned char> &segment, \
+        uint64_t segment_offset, const image_io::ImageInfo &image, int min_dim, \
+        image_io::EmbeddedPreview &preview) {
+    ByteSource tiff = { NULL, &segment[0] + 6, segment.size() - 6 };
+    unsigned char header[8];
+    if( not tiff.read_at(0, header, 8) ) {
+        return;
+    }
+    bool little = (header[0] == 'I');
+    uint64_t ifd0 = get_tiff(header + 4, 4, little);
+    unsigned char count[2], next[4];
+    if( not tiff.read_at(ifd0, count, 2) || not tiff.read_at(ifd0 + 2 + \
+            get_tiff(count, 2, little) * 12, next, 4) ) {
+        return;
+    }
+    uint64_t ifd1 = get_tiff(next, 4, little);
+    uint64_t thumbnail = 0, length = 0;
+    if( ifd1 != 0 && \
+            find_tiff_tag(tiff, little, ifd1, 0x0201, thumbnail) && \
+            find_tiff_tag(tiff, little, ifd1, 0x0202, length) && \
+            thumbnail + length <= tiff.length ) {
+        consider_preview(file, segment_offset + 6 + thumbnail, length, image, \
+            min_dim, preview);
+    }
+}
+
+
+// MPF's MP Entry table (tag 0xB002) lists each image's type, size, and
+// offset relative to the TIFF header following "MPF\0"; large thumbnails
+// (types 0x010001 and 0x010002) are usually appended after the image.
+static void find_mpf_preview(FILE *file, const std::vector<unsigned char> &segment, \
+        uint64_t segment_offset, const image_io::ImageInfo &image, int min_dim, \
+        image_io::EmbeddedPreview &preview) {
+    ByteSource tiff = { NULL, &segment[0] + 4, segment.size() - 4 };
+    unsigned char header[8];
+    if( not tiff.read_at(0, header, 8) ) {
+        return;
+    }
+    bool little = (header[0] == 'I');
+    uint64_t ifd0 = get_tiff(header + 4, 4, little);
+    uint64_t images = 0, entries = 0;
+    if( not find_tiff_tag(tiff, little, ifd0, 0xB001, images) || \
+            not find_tiff_tag(tiff, little, ifd0, 0xB002, entries) ) {
+        return;
+    }
+    for( uint64_t i = 1; i < images; i++ ) {
+        unsigned char entry[16];
+        if( not tiff.read_at(entries + i * 16, entry, 16) ) {
+            return;
+        }
+        uint32_t type = (uint32_t)get_tiff(entry, 4, little) & 0xFFFFFF;
+        if( type == 0x010001 || type == 0x010002 ) {
+            consider_preview(file, segment_offset + 4 + \
+                get_tiff(entry + 8, 4, little), get_tiff(entry + 4, 4, little), \
+                image, min_dim, preview);
+        }
+    }
+}
+
+
+int image_io::find_preview(const char *filename, int min_dim, \
+        EmbeddedPreview &preview) {
+    preview = EmbeddedPreview();
+    if( filename == NULL ) {
+        return error_arguments;
+    }
+    FILE *file = fopen(filename, "rb");
+    if( file == NULL ) {
+        return error_open;
+    }
+    ImageInfo image;
+    ByteSource source = { file, NULL, 0 };
+    int retval = probe_source(source, image);
+
+    // Metadata segments all precede the first scan.
+    uint64_t offset = 2;
+    while( retval == load_ok && image.format == format_jpeg ) {
+        unsigned char marker[4];
+        if( not source.read_at(offset, marker, 4) || marker[0] != 0xFF || \
+                marker[1] == 0xD9 || marker[1] == 0xDA ) {
+            break;
+        }
+        if( marker[1] == 0xFF ) {       // Fill byte
+            offset += 1;
+            continue;
+        }
+        if( marker[1] == 0x01 || (marker[1] >= 0xD0 && marker[1] <= 0xD7) ) {
+            offset += 2;                // Standalone markers
+            continue;
+        }
+        uint32_t length = get_be(marker + 2, 2);
+        if( (marker[1] == 0xE1 || marker[1] == 0xE2) && length > 2 + 8 ) {
+            std::vector<unsigned char> segment(length - 2);
+            if( not source.read_at(offset + 4, &segment[0], segment.size()) ) {
+                break;
+            }
+            if( marker[1] == 0xE1 && memcmp(&segment[0], "Exif\0\0", 6) == 0 ) {
+                find_exif_preview(file, segment, offset + 4, image, min_dim, \
+                    preview);
+            } else if( marker[1] == 0xE2 && memcmp(&segment[0], "MPF\0", 4) == 0 ) {
+                find_mpf_preview(file, segment, offset + 4, image, min_dim, \
+                    preview);
+            }
+        }
+        offset += 2 + length;
+    }
+    fclose(file);
+    if( retval != load_ok ) {
+        return retval;
+    }
+    return (preview.length > 0) ? load_ok : 0;
+}
+
+
+int image_io::probe_decoded(const char *filename, const DecodeOptions &options, \
+        ImageInfo &info) {
+    EmbeddedPreview preview;
+    if( options.preview_min_dim > 0 && \
+            find_preview(filename, options.preview_min_dim, preview) == load_ok ) {
+        info = preview.info;
+        return load_ok;
+    }
+    return probe_image(filename, info);
+}
+
+
+// Largest libjpeg DCT scaling denominator (1, 2, 4, or 8) that still leaves
+// both dimensions at or above min_dim.
+int image_io::jpeg_scale_denom(const ImageInfo &info, int min_dim) {
+    if( info.format != format_jpeg || min_dim <= 0 ) {
+        return 1;
+    }
+    int denom = 8;
+    while( denom > 1 && \
+            ((info.width + denom - 1) / denom < min_dim || \
+             (info.height + denom - 1) / denom < min_dim) ) {
+        denom /= 2;
+    }
+    return denom;
+}
+
+
+// Bytes needed to hold the fully decoded image as samples of sample_size.
+uint64_t image_io::decoded_size(const ImageInfo &info, size_t sample_size) {
+    return (uint64_t)info.width * info.height * info.channels * sample_size;
+}
+
+
+// Decoded rows land directly in the image; used when libjpeg's DCT scaling
+// or a TIFF's stored reduced-resolution copy can skip most of the work of a
+// full-size decode.
+template<typename T>
+static int load_scaled(const char *filename, CImg<T> &image, \
+        const image_io::DecodeOptions &options) {
+    image_io::ScanlineReader reader;
+    int retval = reader.open(filename, options);
+    if( retval != image_io::load_ok ) {
+        return retval;
+    }
+    if( options.memory_cap > 0 && \
+            image_io::decoded_size(reader.info, sizeof(T)) > options.memory_cap ) {
+        return image_io::error_too_large;
+    }
+    const int width = reader.info.width, channels = reader.info.channels;
+    image.assign(width, reader.info.height, 1, channels);
+    std::vector<uint16_t> row((size_t)width * channels);
+    for( int y = 0; (retval = reader.read_row(&row[0])) == 1; y++ ) {
+        const uint16_t *sample = &row[0];
+        for( int x = 0; x < width; x++ ) {
+            for( int c = 0; c < channels; c++ ) {
+                image(x, y, 0, c) = (T)*(sample++);
+            }
+        }
+    }
+    return (retval == 0) ? image_io::load_ok : retval;
+}
+
+
+template<typename T>
+static int load_image_as(const char *filename, CImg<T> &image, \
+        const image_io::DecodeOptions &options) {
+    if( filename == NULL ) {
+        return image_io::error_arguments;
+    }
+
+    FILE *file = fopen(filename, "rb");
+    if( file == NULL ) {
+        return image_io::error_open;
+    }
+    unsigned char header[image_io::sniff_length];
+    size_t length = fread(header, 1, sizeof(header), file);
+    image_io::image_format format = image_io::sniff_format(header, length);
+    if( format == image_io::format_unknown ) {
+        fclose(file);
+        return image_io::error_unknown_format;
+    }
+    rewind(file);
+
+    // Triage mode:  the embedded preview is a complete JPEG, which libjpeg
+    // reads from where the file is positioned.
+    image_io::EmbeddedPreview preview;
+    if( format == image_io::format_jpeg && options.preview_min_dim > 0 && \
+            image_io::find_preview(filename, options.preview_min_dim, \
+                preview) == image_io::load_ok ) {
+        int retval = image_io::load_ok;
+        try {
+            if( fseek(file, (long)preview.offset, SEEK_SET) != 0 ) {
+                retval = image_io::error_open;
+            } else {
+                image.load_jpeg(file);
+            }
+        }
+        catch( CImgException & ) {
+            retval = image_io::error_decode;
+        }
+        fclose(file);
+        if( retval == image_io::load_ok && image.is_empty() ) {
+            retval = image_io::error_decode;
+        }
+        return retval;
+    }
+
+    // The reader picks the smallest level of a pyramidal TIFF that covers
+    // min_dim (the first image otherwise); CImg is only needed for layouts
+    // it can't read.
+    if( format == image_io::format_tiff && options.min_dim > 0 ) {
+        int retval = load_scaled(filename, image, options);
+        if( retval != image_io::error_not_streamable ) {
+            fclose(file);
+            return retval;
+        }
+    }
+
+    int scale_denom = 1;
+    if( options.max_pixels > 0 || options.min_dim > 0 || \
+            options.memory_cap > 0 ) {
+        image_io::ImageInfo info;
+        ByteSource source = { file, NULL, 0 };
+        int retval = probe_source(source, info);
+        scale_denom = image_io::jpeg_scale_denom(info, options.min_dim);
+        uint64_t size = image_io::decoded_size(info, sizeof(T)) / \
+            (scale_denom * scale_denom);
+        if( retval == image_io::load_ok && ((options.max_pixels > 0 && \
+                (uint64_t)info.width * info.height > options.max_pixels) || \
+                (options.memory_cap > 0 && size > options.memory_cap)) ) {
+            retval = image_io::error_too_large;
+        }
+        if( retval != image_io::load_ok ) {
+            fclose(file);
+            return retval;
+        }
+        rewind(file);
+    }
+    if( scale_denom > 1 ) {
+        fclose(file);
+        return load_scaled(filename, image, options);
+    }
+
+    // CImg's FILE* loaders throw rather than fall back to load_other(), which
+    // would spawn an external converter; libtiff opens the file itself.
+    int retval = image_io::load_ok;
+    try {
+        if( format == image_io::format_jpeg ) {
+            image.load_jpeg(file);
+        } else if( format == image_io::format_png ) {
+            image.load_png(file);
+        } else {
+            fclose(file);
+            file = NULL;
+            image.load_tiff(filename);
+        }
+    }
+    catch( CImgException & ) {
+        retval = image_io::error_decode;
+    }
+    if( file != NULL ) {
+        fclose(file);
+    }
+
+    if( retval == image_io::load_ok && image.is_empty() ) {
+        retval = image_io::error_decode;
+    }
+    return retval;
+}
+
+
+// Decodes JPEG and PNG data through a FILE* on the memory, with the same
+// checks as load_image_as() makes of the file.  The decodes that substitute
+// or scale (previews, min_dim) need the file, as do TIFFs.
+template<typename T>
+static int load_data_as(const char *data, size_t length, CImg<T> &image, \
+        const image_io::DecodeOptions &options) {
+    if( data == NULL ) {
+        return image_io::error_arguments;
+    }
+    image_io::image_format format = \
+        image_io::sniff_format((const unsigned char*)data, length);
+    if( format == image_io::format_unknown ) {
+        return image_io::error_unknown_format;
+    }
+    if( format == image_io::format_tiff || options.preview_min_dim > 0 ) {
+        return image_io::error_needs_file;
+    }
+
+    if( options.max_pixels > 0 || options.min_dim > 0 || \
+            options.memory_cap > 0 ) {
+        image_io::ImageInfo info;
+        int retval = image_io::probe_image(data, length, info);
+        if( retval != image_io::load_ok ) {
+            return retval;
+        }
+        if( image_io::jpeg_scale_denom(info, options.min_dim) > 1 ) {
+            return image_io::error_needs_file;
+        }
+        if( (options.max_pixels > 0 && \
+                (uint64_t)info.width * info.height > options.max_pixels) || \
+                (options.memory_cap > 0 && \
+                image_io::decoded_size(info, sizeof(T)) > options.memory_cap) ) {
+            return image_io::error_too_large;
+        }
+    }
+
+    FILE *file = fmemopen((void*)data, length, "rb");
+    if( file == NULL ) {
+        return image_io::error_open;
+    }
+    int retval = image_io::load_ok;
+    try {
+        if( format == image_io::format_jpeg ) {
+            image.load_jpeg(file);
+        } else {
+            image.load_png(file);
+        }
+    }
+    catch( CImgException & ) {
+        retval = image_io::error_decode;
+    }
+    fclose(file);
+
+    if( retval == image_io::load_ok && image.is_empty() ) {
+        retval = image_io::error_decode;
+    }
+    return retval;
+}
+
+
+int image_io::load_image(const char *filename, CImg<uint8_t> &image, \
+        const DecodeOptions &options) {
+    return load_image_as(filename, image, options);
+}
+
+
+int image_io::load_image(const char *filename, CImg<uint16_t> &image, \
+        const DecodeOptions &options) {
+    return load_image_as(filename, image, options);
+}
+
+
+int image_io::load_image(const char *filename, CImg<float> &image, \
+        const DecodeOptions &options) {
+    return load_image_as(filename, image, options);
+}
+
+
+int image_io::load_image(const char *data, size_t length, \
+        CImg<uint8_t> &image, const DecodeOptions &options) {
+    return load_data_as(data, length, image, options);
+}
+
+
+int image_io::load_image(const char *data, size_t length, \
+        CImg<uint16_t> &image, const DecodeOptions &options) {
+    return load_data_as(data, length, image, options);
+}
+
+
+int image_io::load_image(const char *data, size_t length, \
+        CImg<float> &image, const DecodeOptions &options) {
+    return load_data_as(data, length, image, options);
+}
+
+
+struct image_io::ComputeContext::Buffers {
+    CImg<uint8_t> bytes[slots];
+    CImg<uint16_t> words[slots];
+    CImg<float> floats[slots];
+};
+
+
+image_io::ComputeContext::ComputeContext() : buffers(new Buffers) {
+}
+
+
+image_io::ComputeContext::~ComputeContext() {
+    delete buffers;
+}
+
+
+CImg<uint8_t> &image_io::ComputeContext::bytes(int slot) {
+    return buffers->bytes[slot];
+}
+
+
+CImg<uint16_t> &image_io::ComputeContext::words(int slot) {
+    return buffers->words[slot];
+}
+
+
+CImg<float> &image_io::ComputeContext::floats(int slot) {
+    return buffers->floats[slot];
+}
+
+
+void image_io::ComputeContext::release() {
+    for( int slot = 0; slot < slots; slot++ ) {
+        buffers->bytes[slot].assign();
+        buffers->words[slot].assign();
+        buffers->floats[slot].assign();
+    }
+    std::vector<uint32_t>().swap(counts);
+    std::vector<uint16_t>().swap(table);
+}
+
+
+void image_io::ComputeContext::trim() {
+    for( int slot = 0; slot < slots; slot++ ) {
+        if( buffers->bytes[slot].size() * sizeof(uint8_t) > retained_bytes ) {
+            buffers->bytes[slot].assign();
+        }
+        if( buffers->words[slot].size() * sizeof(uint16_t) > retained_bytes ) {
+            buffers->words[slot].assign();
+        }
+        if( buffers->floats[slot].size() * sizeof(float) > retained_bytes ) {
+            buffers->floats[slot].assign();
+        }
+    }
+    if( counts.capacity() * sizeof(uint32_t) > retained_bytes ) {
+        std::vector<uint32_t>().swap(counts);
+    }
+    if( table.capacity() * sizeof(uint16_t) > retained_bytes ) {
+        std::vector<uint16_t>().swap(table);
+    }
+}
+
+
+static pthread_key_t compute_context_key;
+static pthread_once_t compute_context_once = PTHREAD_ONCE_INIT;
+
+static void destroy_compute_context(void *context) {
+    delete (image_io::ComputeContext*)context;
+}
+
+
+static void create_compute_context_key() {
+    pthread_key_create(&compute_context_key, destroy_compute_context);
+}
+
+
+image_io::ComputeContext &image_io::thread_compute_context() {
+    pthread_once(&compute_context_once, create_compute_context_key);
+    ComputeContext *context = \
+        (ComputeContext*)pthread_getspecific(compute_context_key);
+    if( context == NULL ) {
+        context = new ComputeContext;
+        pthread_setspecific(compute_context_key, context);
+    }
+    return *context;
+}
+
+
+static image_io::blocking_runner host_blocking_runner = NULL;
+
+void image_io::set_blocking_runner(blocking_runner runner) {
+    host_blocking_runner = runner;
+}
+
+
+// Work as run by a host's blocking runner, which exceptions mustn't cross.
+struct BlockingWork {
+    image_io::blocking_function work;
+    void *data;
+    bool failed;
+    std::string message;
+
+    static void *run(void *blocking) {
+        BlockingWork *self = (BlockingWork*)blocking;
+        try {
+            self->work(self->data);
+        }
+        catch( std::exception &e ) {
+            self->failed = true;
+            self->message = e.what();
+        }
+        catch( ... ) {
+            self->failed = true;
+            self->message = "image_io::run_blocking work failed.";
+        }
+        return NULL;
+    }
+};
+
+
+void image_io::run_blocking(blocking_function work, void *data) {
+    if( host_blocking_runner == NULL ) {
+        work(data);
+        return;
+    }
+    BlockingWork blocking;
+    blocking.work = work;
+    blocking.data = data;
+    blocking.failed = false;
+    host_blocking_runner(BlockingWork::run, &blocking);
+    if( blocking.failed ) {
+        throw CImgException("%s", blocking.message.c_str());
+    }
+}
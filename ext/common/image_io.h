@@ -0,0 +1,191 @@
+//============================================================================
+// Name        : image_io.h
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : Image loading shared by all fingerprint types:  detects the
+//               format from the file's content (not its name) and decodes it
+//               in-process via libjpeg, libpng, or libtiff.
+//============================================================================
+
+#ifndef IMAGE_IO_H_
+#define IMAGE_IO_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// CImg-related settings
+#define cimg_debug 0
+#define cimg_display 0
+#define cimg_verbosity 1
+// Reminder:  libjpeg, libpng, libtiff are not installed by default on OS X
+#define cimg_use_jpeg
+#define cimg_use_png
+#define cimg_use_tiff
+
+namespace cimg_library {
+template<typename T> struct CImg;
+}
+
+
+// Definition of image_io::namespace
+namespace image_io {
+
+// Number of leading bytes needed to recognize every supported format.
+const int sniff_length = 8;
+
+enum image_format {
+    format_unknown = 0,
+    format_jpeg = 1,
+    format_png = 2,
+    format_tiff = 3
+};
+
+// Image properties learned from headers alone (see probe_image).  channels
+// and bit_depth describe the image as load_image will decode it:  e.g. a
+// palette PNG decodes to 3 channels of 8 bits, or 4 if it has transparency.
+struct ImageInfo {
+    image_format format;
+    int width;
+    int height;
+    int channels;
+    int bit_depth;
+    bool progressive;   // Progressive JPEG or interlaced PNG.
+
+    ImageInfo() : format(format_unknown), width(0), height(0), channels(0), \
+        bit_depth(0), progressive(false) {}
+};
+
+// Limits and hints applied by load_image before and while decoding.
+struct DecodeOptions {
+    uint64_t max_pixels;    // Reject larger images unread (0: no limit).
+    int min_dim;            // Smallest width/height the caller needs; JPEGs
+                            // may be decoded at 1/2, 1/4, 1/8 scale and
+                            // pyramidal TIFFs from a reduced-resolution
+                            // copy down to it (0: always full size).
+    uint64_t memory_cap;    // Bytes of decoded image data allowed in memory;
+                            // larger images are streamed by the fingerprint
+                            // computations (0: no cap, never stream).
+    int preview_min_dim;    // Decode a JPEG's embedded preview instead of the
+                            // image itself when one has both sides at least
+                            // this large (0: never; see find_preview).
+
+    DecodeOptions() : max_pixels(0), min_dim(0), memory_cap(0), \
+        preview_min_dim(0) {}
+};
+
+// A complete JPEG embedded in another's metadata:  the EXIF thumbnail or an
+// MPF (multi-picture format) large preview, length bytes at offset.
+struct EmbeddedPreview {
+    uint64_t offset;
+    uint64_t length;
+    ImageInfo info;
+
+    EmbeddedPreview() : offset(0), length(0) {}
+};
+
+// Return values (negative values are failures; distinct from the codes used
+// by the fingerprint types' own compute_image_hash functions).
+const int load_ok = 1;
+const int error_arguments = -10;        // Invalid method call parameters.
+const int error_open = -11;             // File could not be opened or read.
+const int error_unknown_format = -12;   // Not a JPEG, PNG, or TIFF image.
+const int error_decode = -13;           // Decoder rejected the image data.
+const int error_too_large = -14;        // Exceeds max_pixels or memory_cap.
+const int error_not_streamable = -15;   // Layout ScanlineReader can't decode.
+const int error_needs_file = -16;       // Decodable from the file only (TIFF,
+                                        // previews, scaled JPEG decodes).
+
+
+image_format sniff_format(const unsigned char *header, size_t length);
+int sniff_file_format(const char *filename, image_format &format);
+
+// Reads only the headers (a few hundred bytes for typical files).
+int probe_image(const char *filename, ImageInfo &info);
+int probe_image(const char *data, size_t length, ImageInfo &info);
+// Finds the smallest embedded preview with both sides at least min_dim and
+// the image's own aspect ratio (letterboxed thumbnails don't qualify).
+// Returns load_ok, 0 when there is none, or a negative error code.
+int find_preview(const char *filename, int min_dim, EmbeddedPreview &preview);
+// Probes what load_image will decode given options:  the image itself, or
+// the embedded preview it substitutes.
+int probe_decoded(const char *filename, const DecodeOptions &options, \
+        ImageInfo &info);
+int jpeg_scale_denom(const ImageInfo &info, int min_dim);
+uint64_t decoded_size(const ImageInfo &info, size_t sample_size);
+
+// Never falls back to external converters (ImageMagick et al.), unlike
+// constructing a CImg from a filename.
+int load_image(const char *filename, cimg_library::CImg<uint8_t> &image, \
+        const DecodeOptions &options=DecodeOptions());
+int load_image(const char *filename, cimg_library::CImg<uint16_t> &image, \
+        const DecodeOptions &options=DecodeOptions());
+int load_image(const char *filename, cimg_library::CImg<float> &image, \
+        const DecodeOptions &options=DecodeOptions());
+// The same from a JPEG or PNG file's contents already in memory (e.g. read
+// by a Pipeline); error_needs_file when only the file will do.
+int load_image(const char *data, size_t length, \
+        cimg_library::CImg<uint8_t> &image, \
+        const DecodeOptions &options=DecodeOptions());
+int load_image(const char *data, size_t length, \
+        cimg_library::CImg<uint16_t> &image, \
+        const DecodeOptions &options=DecodeOptions());
+int load_image(const char *data, size_t length, \
+        cimg_library::CImg<float> &image, \
+        const DecodeOptions &options=DecodeOptions());
+
+// Buffers that fingerprint computations keep from one call to the next:
+// the decoded image, intermediates, and count tables.  CImg's assign() keeps
+// an image's buffer whenever its element count is unchanged, so once a thread
+// has fingerprinted an image, another of the same size (and any standardized
+// intermediates) costs no further heap allocations for these.  Which slot
+// holds what is up to each fingerprint type; contents only matter for the
+// duration of one computation, so the types can share a thread's context.
+class ComputeContext {
+public:
+    static const int slots = 4;
+    // Buffers above this many bytes are freed by trim().
+    static const uint64_t retained_bytes = (uint64_t)64 << 20;
+
+    ComputeContext();
+    ~ComputeContext();
+
+    cimg_library::CImg<uint8_t> &bytes(int slot);
+    cimg_library::CImg<uint16_t> &words(int slot);
+    cimg_library::CImg<float> &floats(int slot);
+    std::vector<uint32_t> counts;
+    std::vector<uint16_t> table;
+
+    // Frees everything held (e.g. after an unusually large image).
+    void release();
+    // Frees only the buffers above retained_bytes; computations call it once
+    // done with their decoded image, so one huge image doesn't stay resident
+    // for the rest of the thread's life.
+    void trim();
+
+private:
+    struct Buffers;
+    Buffers *buffers;
+
+    ComputeContext(const ComputeContext &);
+    ComputeContext &operator=(const ComputeContext &);
+};
+
+// The calling thread's context, created on first use and destroyed when the
+// thread exits.  Only that thread may use it.
+ComputeContext &thread_compute_context();
+
+// Long-running work (decoding, fingerprinting, index scans) is run through
+// run_blocking(), which a host may route around its interpreter lock with
+// set_blocking_runner() (the Ruby bindings let other Ruby threads run
+// meanwhile).  The runner calls function(data) once, on any thread; work
+// must not call back into the host.  Anything work throws is caught before
+// it reaches the runner and rethrown as a CImgException once back.
+typedef void *(*blocking_function)(void *data);
+typedef void (*blocking_runner)(blocking_function function, void *data);
+void set_blocking_runner(blocking_runner runner);   // NULL: call work directly.
+void run_blocking(blocking_function work, void *data);
+}
+
+#endif /* IMAGE_IO_H_ */
@@ -0,0 +1,822 @@
+//============================================================================
+// Name        : pipeline.cpp
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : Staged executor for batch fingerprinting:  files are read,
+//               decoded, fingerprinted and emitted by separate threads
+//               joined by bounded queues, so that disk and CPUs stay busy
+//               at once.
+//============================================================================
+
+#include "pipeline.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+
+// io_uring is used through its system calls (no liburing), where the
+// headers describe the 5.7 kernel's interface; Ring::setup() checks that the
+// running kernel has it.
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_FAST_POLL)
+#define PIPELINE_IO_URING
+#endif
+#endif
+#endif
+
+
+static double monotonic_seconds() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + 1e-9 * now.tv_nsec;
+}
+
+
+// A bounded FIFO of items.  Pops wait for an item (time starved), pushes for
+// room (time blocked).  Once closed, pops drain what is left and then return
+// NULL; once aborted, pops and pushes both give up at once.
+struct image_io::Pipeline::Queue {
+    std::vector<PipelineItem*> ring;
+    size_t head, count;
+    bool closed, aborted;
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty, not_full;
+
+    Queue(size_t capacity) : ring(capacity), head(0), count(0), \
+            closed(false), aborted(false) {
+        pthread_mutex_init(&mutex, NULL);
+        pthread_cond_init(&not_empty, NULL);
+        pthread_cond_init(&not_full, NULL);
+    }
+
+    ~Queue() {
+        pthread_cond_destroy(&not_full);
+        pthread_cond_destroy(&not_empty);
+        pthread_mutex_destroy(&mutex);
+    }
+
+    bool push(PipelineItem *item, double &blocked) {
+        pthread_mutex_lock(&mutex);
+        if( count == ring.size() && not aborted ) {
+            const double start = monotonic_seconds();
+            while( count == ring.size() && not aborted ) {
+                pthread_cond_wait(&not_full, &mutex);
+            }
+            blocked += monotonic_seconds() - start;
+        }
+        const bool pushed = not aborted;
+        if( pushed ) {
+            ring[(head + count) % ring.size()] = item;
+            ++count;
+            pthread_cond_signal(&not_empty);
+        }
+        pthread_mutex_unlock(&mutex);
+        return pushed;
+    }
+
+    PipelineItem *pop(double &starved) {
+        pthread_mutex_lock(&mutex);
+        if( count == 0 && not closed && not aborted ) {
+            const double start = monotonic_seconds();
+            while( count == 0 && not closed && not aborted ) {
+                pthread_cond_wait(&not_empty, &mutex);
+            }
+            starved += monotonic_seconds() - start;
+        }
+        PipelineItem *item = NULL;
+        if( count > 0 && not aborted ) {
+            item = ring[head];
+            head = (head + 1) % ring.size();
+            --count;
+            pthread_cond_signal(&not_full);
+        }
+        pthread_mutex_unlock(&mutex);
+        return item;
+    }
+
+    // As pop(), but NULL at once when there is nothing to take.
+    PipelineItem *try_pop() {
+        pthread_mutex_lock(&mutex);
+        PipelineItem *item = NULL;
+        if( count > 0 && not aborted ) {
+            item = ring[head];
+            head = (head + 1) % ring.size();
+            --count;
+            pthread_cond_signal(&not_full);
+        }
+        pthread_mutex_unlock(&mutex);
+        return item;
+    }
+
+    void close() {
+        pthread_mutex_lock(&mutex);
+        closed = true;
+        pthread_cond_broadcast(&not_empty);
+        pthread_mutex_unlock(&mutex);
+    }
+
+    void abort() {
+        pthread_mutex_lock(&mutex);
+        aborted = true;
+        pthread_cond_broadcast(&not_empty);
+        pthread_cond_broadcast(&not_full);
+        pthread_mutex_unlock(&mutex);
+    }
+};
+
+
+#ifdef PIPELINE_IO_URING
+// An io_uring instance:  its submission and completion rings, mapped from
+// the kernel, used by the one reader thread.  Each request's user_data is
+// its item; an item has at most one request (open, then reads) in flight.
+struct image_io::Pipeline::Ring {
+    int fd;
+    void *rings;
+    size_t rings_size;
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+    unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_cqe *cqes;
+    unsigned queued;        // Requests not yet submitted.
+    int registered;         // Items' buffers (the first this many) read by
+                            // IORING_OP_READ_FIXED.
+
+    Ring() : fd(-1), rings(MAP_FAILED), rings_size(0), sqes(NULL), \
+            sqes_size(0), queued(0), registered(0) {}
+
+    ~Ring() {
+        if( sqes != NULL ) {
+            munmap(sqes, sqes_size);
+        }
+        if( rings != MAP_FAILED ) {
+            munmap(rings, rings_size);
+        }
+        if( fd >= 0 ) {
+            close(fd);
+        }
+    }
+
+    // False where the kernel lacks io_uring (or its 5.7 operations) or
+    // forbids it.
+    bool setup(unsigned entries) {
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+        if( fd < 0 || not (params.features & IORING_FEAT_FAST_POLL) || \
+                not (params.features & IORING_FEAT_SINGLE_MMAP) ) {
+            return false;
+        }
+        rings_size = std::max(params.sq_off.array + \
+            params.sq_entries * sizeof(unsigned), params.cq_off.cqes + \
+            params.cq_entries * sizeof(struct io_uring_cqe));
+        rings = mmap(NULL, rings_size, PROT_READ | PROT_WRITE, \
+            MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if( rings == MAP_FAILED ) {
+            return false;
+        }
+        sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+        void *mapped = mmap(NULL, sqes_size, PROT_READ | PROT_WRITE, \
+            MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if( mapped == MAP_FAILED ) {
+            return false;
+        }
+        sqes = (struct io_uring_sqe*)mapped;
+        char *base = (char*)rings;
+        sq_head = (unsigned*)(base + params.sq_off.head);
+        sq_tail = (unsigned*)(base + params.sq_off.tail);
+        sq_mask = (unsigned*)(base + params.sq_off.ring_mask);
+        sq_array = (unsigned*)(base + params.sq_off.array);
+        cq_head = (unsigned*)(base + params.cq_off.head);
+        cq_tail = (unsigned*)(base + params.cq_off.tail);
+        cq_mask = (unsigned*)(base + params.cq_off.ring_mask);
+        cqes = (struct io_uring_cqe*)(base + params.cq_off.cqes);
+        return true;
+    }
+
+    // Registers as many of the buffers as RLIMIT_MEMLOCK has room for,
+    // beyond the rings (which older kernels count against it), fewer again
+    // while the kernel refuses; the rest are read into unregistered.
+    void register_buffers(const std::vector<struct iovec> &iovecs) {
+        size_t count = iovecs.size();
+        struct rlimit limit;
+        if( count > 0 && getrlimit(RLIMIT_MEMLOCK, &limit) == 0 && \
+                limit.rlim_cur != RLIM_INFINITY ) {
+            const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+            const size_t pinned = (iovecs[0].iov_len + page - 1) / page * page;
+            const size_t rings_pinned = rings_size + sqes_size;
+            count = std::min(count, (limit.rlim_cur > rings_pinned) ? \
+                (size_t)(limit.rlim_cur - rings_pinned) / pinned : 0);
+        }
+        for( ; count > 0; count /= 2 ) {
+            if( syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, \
+                    &iovecs[0], (unsigned)count) == 0 ) {
+                registered = (int)count;
+                return;
+            }
+        }
+    }
+
+    // Queues a copy of request; false if the ring is full.
+    bool push(const struct io_uring_sqe &request) {
+        const unsigned tail = *sq_tail;
+        if( tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) > *sq_mask ) {
+            return false;
+        }
+        const unsigned index = tail & *sq_mask;
+        sqes[index] = request;
+        sq_array[index] = index;
+        __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+        ++queued;
+        return true;
+    }
+
+    bool queue_open(PipelineItem &item) {
+        struct io_uring_sqe request;
+        memset(&request, 0, sizeof(request));
+        request.opcode = IORING_OP_OPENAT;
+        request.fd = AT_FDCWD;
+        request.addr = (uint64_t)(uintptr_t)item.filename.c_str();
+        request.open_flags = O_RDONLY | O_CLOEXEC;
+        request.user_data = (uint64_t)(uintptr_t)&item;
+        return push(request);
+    }
+
+    // The rest of item's file, after item.length bytes; buffer_index is the
+    // item's registered buffer.
+    bool queue_read(PipelineItem &item, int buffer_index) {
+        struct io_uring_sqe request;
+        memset(&request, 0, sizeof(request));
+        const bool fixed = buffer_index < registered && \
+            item.data == item.buffer;
+        request.opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        request.fd = item.fd;
+        request.addr = (uint64_t)(uintptr_t)(item.data + item.length);
+        request.len = (uint32_t)std::min(item.expected - item.length, \
+            (size_t)1 << 30);
+        request.off = item.length;
+        request.buf_index = fixed ? buffer_index : 0;
+        request.user_data = (uint64_t)(uintptr_t)&item;
+        return push(request);
+    }
+
+    // Submits the queued requests and waits for a completion:  0 when
+    // interrupted (or the kernel is short of resources) and worth retrying.
+    int enter() {
+        const int retval = (int)syscall(__NR_io_uring_enter, fd, queued, 1, \
+            IORING_ENTER_GETEVENTS, NULL, 0);
+        if( retval < 0 ) {
+            return (errno == EINTR || errno == EAGAIN || errno == EBUSY) ? 0 : -1;
+        }
+        queued -= std::min((unsigned)retval, queued);
+        return 1;
+    }
+
+    bool reap(PipelineItem *&item, int &result) {
+        const unsigned head = *cq_head;
+        if( head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE) ) {
+            return false;
+        }
+        const struct io_uring_cqe &completion = cqes[head & *cq_mask];
+        item = (PipelineItem*)(uintptr_t)completion.user_data;
+        result = completion.res;
+        __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+};
+#endif
+
+
+struct image_io::Pipeline::Worker {
+    Pipeline *pipeline;
+    int stage;
+};
+
+
+// Sizes up the file open on item.fd and points item.data at where to read
+// it:  the item's buffer, or its overflow for larger files.
+static int start_contents(image_io::PipelineItem &item, size_t buffer_size) {
+    struct stat status;
+    if( fstat(item.fd, &status) != 0 ) {
+        return image_io::error_open;
+    }
+    item.expected = (size_t)status.st_size;
+    item.length = 0;
+    if( item.buffer != NULL && item.expected <= buffer_size ) {
+        item.data = item.buffer;
+    } else {
+        item.overflow.resize(std::max(item.expected, (size_t)1));
+        item.data = &item.overflow[0];
+    }
+    return image_io::load_ok;
+}
+
+
+image_io::Pipeline::Pipeline(const PipelineFunctions &functions, void *job, \
+        const PipelineOptions &options) : functions(functions), job(job), \
+        elapsed(0.0), stopping(false), next_input(0), inputs_done(false), \
+        read_contents(options.read_contents), \
+        io_depth((options.io_depth > 0) ? options.io_depth : 32), \
+        buffer_size((options.buffer_size > 0) ? options.buffer_size : 1 << 18), \
+        buffers(NULL), ring(NULL) {
+    const int cpus = std::max((int)sysconf(_SC_NPROCESSORS_ONLN), 1);
+    threads[stage_read] = std::max(options.reader_threads, 1);
+#ifdef PIPELINE_IO_URING
+    if( read_contents && options.use_io_uring ) {
+        ring = new Ring;
+        if( ring->setup(io_depth) ) {
+            threads[stage_read] = 1;
+        } else {
+            delete ring;
+            ring = NULL;
+        }
+    }
+#endif
+    threads[stage_decode] = (options.decoder_threads > 0) ? \
+        options.decoder_threads : cpus;
+    threads[stage_compute] = (options.compute_threads > 0) ? \
+        options.compute_threads : cpus;
+    threads[stage_emit] = 1;
+
+    // Every item can be in a stage's hands or waiting in a queue at once, so
+    // that only running out of queue room (not of items) holds work back;
+    // the free items are the reading stage's queue.
+    size_t total = 0;
+    for( int stage = 0; stage < pipeline_stages; stage++ ) {
+        if( functions.stages[stage] == NULL ) {
+            threads[stage] = 1;     // Only passes items on.
+        }
+        total += threads[stage];
+        if( stage != stage_read ) {
+            const size_t capacity = (options.queue_length > 0) ? \
+                options.queue_length : 2 * threads[stage];
+            queues[stage] = new Queue(capacity);
+            total += capacity;
+        }
+        running[stage] = 0;
+    }
+    if( ring != NULL ) {
+        total += io_depth;      // Being read by the one reader thread.
+    }
+    items.resize(total);
+    queues[stage_read] = new Queue(total);
+    double unused = 0.0;
+    for( size_t i = 0; i < items.size(); i++ ) {
+        queues[stage_read]->push(&items[i], unused);
+    }
+
+    // Without the block (or past its size) files are read into overflow.
+    void *block;
+    if( read_contents && posix_memalign(&block, 4096, total * buffer_size) == 0 ) {
+        buffers = (char*)block;
+        for( size_t i = 0; i < items.size(); i++ ) {
+            items[i].buffer = buffers + i * buffer_size;
+        }
+    }
+#ifdef PIPELINE_IO_URING
+    if( ring != NULL && buffers != NULL ) {
+        std::vector<struct iovec> iovecs(items.size());
+        for( size_t i = 0; i < items.size(); i++ ) {
+            iovecs[i].iov_base = items[i].buffer;
+            iovecs[i].iov_len = buffer_size;
+        }
+        ring->register_buffers(iovecs);
+    }
+#endif
+    pthread_mutex_init(&mutex, NULL);
+}
+
+
+image_io::Pipeline::~Pipeline() {
+    for( size_t i = 0; i < items.size(); i++ ) {
+        if( items[i].state != NULL && functions.destroy_state != NULL ) {
+            functions.destroy_state(job, items[i].state);
+        }
+    }
+    for( int stage = 0; stage < pipeline_stages; stage++ ) {
+        delete queues[stage];
+    }
+    for( size_t i = 0; i < lookahead.size(); i++ ) {
+        if( lookahead[i].fd >= 0 ) {
+            close(lookahead[i].fd);
+        }
+    }
+#ifdef PIPELINE_IO_URING
+    delete ring;        // Before the buffers it may have registered.
+#endif
+    free(buffers);
+    pthread_mutex_destroy(&mutex);
+}
+
+
+int image_io::Pipeline::run() {
+    if( functions.source == NULL || functions.stages[stage_emit] == NULL ) {
+        return error_arguments;
+    }
+    const double start = monotonic_seconds();
+    for( size_t i = 0; i < items.size(); i++ ) {
+        if( items[i].state == NULL && functions.create_state != NULL ) {
+            items[i].state = functions.create_state(job);
+        }
+    }
+
+    std::vector<Worker> workers;
+    for( int stage = 0; stage < pipeline_stages; stage++ ) {
+        Worker worker = { this, stage };
+        workers.insert(workers.end(), threads[stage], worker);
+        running[stage] = threads[stage];
+    }
+    std::vector<pthread_t> ids(workers.size());
+    std::vector<bool> started(workers.size(), false);
+    int started_by_stage[pipeline_stages] = { 0 };
+    for( size_t w = 0; w < workers.size(); w++ ) {
+        started[w] = pthread_create(&ids[w], NULL, run_worker, &workers[w]) == 0;
+        if( started[w] ) {
+            ++started_by_stage[workers[w].stage];
+        } else {
+            // As if it had finished at once.
+            finish(workers[w].stage, PipelineStats());
+        }
+    }
+    bool all_stages = true;
+    for( int stage = 0; stage < pipeline_stages; stage++ ) {
+        stage_stats[stage].threads = started_by_stage[stage];
+        all_stages = all_stages && started_by_stage[stage] > 0;
+    }
+    if( not all_stages ) {
+        cancel();
+    }
+    for( size_t w = 0; w < workers.size(); w++ ) {
+        if( started[w] ) {
+            pthread_join(ids[w], NULL);
+        }
+    }
+    elapsed = monotonic_seconds() - start;
+
+    if( not all_stages ) {
+        return error_pipeline_threads;
+    }
+    return cancelled() ? error_pipeline_cancelled : pipeline_ok;
+}
+
+
+void image_io::Pipeline::cancel() {
+    pthread_mutex_lock(&mutex);
+    stopping = true;
+    pthread_mutex_unlock(&mutex);
+    for( int stage = 0; stage < pipeline_stages; stage++ ) {
+        queues[stage]->abort();
+    }
+}
+
+
+bool image_io::Pipeline::cancelled() const {
+    pthread_mutex_lock(&mutex);
+    const bool cancelled = stopping;
+    pthread_mutex_unlock(&mutex);
+    return cancelled;
+}
+
+
+int image_io::Pipeline::in_flight() const {
+    return (int)items.size();
+}
+
+
+bool image_io::Pipeline::io_uring() const {
+    return ring != NULL;
+}
+
+
+int image_io::Pipeline::registered_buffers() const {
+#ifdef PIPELINE_IO_URING
+    if( ring != NULL ) {
+        return ring->registered;
+    }
+#endif
+    return 0;
+}
+
+
+const image_io::PipelineStats &image_io::Pipeline::stats(int stage) const {
+    return stage_stats[stage];
+}
+
+
+double image_io::Pipeline::elapsed_seconds() const {
+    return elapsed;
+}
+
+
+void *image_io::Pipeline::run_worker(void *worker) {
+    Worker *self = (Worker*)worker;
+    self->pipeline->work(self->stage);
+    return NULL;
+}
+
+
+void image_io::Pipeline::work(int stage) {
+    PipelineStats mine;
+    if( stage == stage_read && ring != NULL ) {
+        read_ring(mine);
+        finish(stage, mine);
+        return;
+    }
+    // Emitting:  items that arrived ahead of their turn.
+    std::vector<PipelineItem*> pending;
+    uint64_t next_emit = 0;
+
+    PipelineItem *item;
+    while( (item = queues[stage]->pop(mine.starved_seconds)) != NULL ) {
+        if( stage == stage_read && not next_filename(*item) ) {
+            queues[stage_read]->push(item, mine.blocked_seconds);
+            break;
+        }
+        if( stage == stage_read && read_contents ) {
+            const double start = monotonic_seconds();
+            const int retval = read_file(*item);
+            mine.busy_seconds += monotonic_seconds() - start;
+            if( retval < 1 ) {
+                item->status = retval;
+                item->failed_stage = stage;
+                ++mine.failures;
+            }
+        }
+        if( stage == stage_emit ) {
+            pending.push_back(item);
+        }
+        // Items other than the next to emit pass straight on.
+        while( item != NULL ) {
+            if( stage == stage_emit ) {
+                std::vector<PipelineItem*>::iterator next = pending.begin();
+                while( next != pending.end() && (*next)->index != next_emit ) {
+                    ++next;
+                }
+                if( next == pending.end() ) {
+                    break;
+                }
+                item = *next;
+                pending.erase(next);
+            }
+            process(stage, *item, mine);
+            if( stage == stage_emit ) {
+                ++next_emit;
+                item->filename.clear();
+                item->status = 1;
+                item->failed_stage = -1;
+                item->data = NULL;
+                item->length = 0;
+                queues[stage_read]->push(item, mine.blocked_seconds);
+            } else {
+                queues[stage + 1]->push(item, mine.blocked_seconds);
+                item = NULL;
+            }
+        }
+    }
+    finish(stage, mine);
+}
+
+
+// Runs stage's function on item, unless an earlier stage failed it (emit
+// runs regardless).  An exception escaping the function fails the item with
+// error_decode rather than ending the process on the worker thread.
+void image_io::Pipeline::process(int stage, PipelineItem &item, \
+        PipelineStats &mine) {
+    const pipeline_function function = functions.stages[stage];
+    if( function != NULL && (item.status >= 1 || stage == stage_emit) ) {
+        const double start = monotonic_seconds();
+        int retval;
+        try {
+            retval = function(job, item);
+        }
+        catch( ... ) {
+            retval = error_decode;
+        }
+        mine.busy_seconds += monotonic_seconds() - start;
+        if( retval < 1 && item.status >= 1 ) {
+            item.status = retval;
+            item.failed_stage = stage;
+            ++mine.failures;
+        }
+    }
+    ++mine.items;
+}
+
+
+// The reading stage's one thread when reading through io_uring:  it keeps up
+// to io_depth items' opens and reads in flight, passing each item on (after
+// the read stage function) as its file is read in full.  Waiting on the
+// kernel counts as busy.
+void image_io::Pipeline::read_ring(PipelineStats &mine) {
+#ifdef PIPELINE_IO_URING
+    int reading = 0;        // Items with an open or read in flight.
+    bool more = true;
+    std::vector<PipelineItem*> done;
+    while( true ) {
+        while( more && reading < io_depth ) {
+            PipelineItem *item = (reading == 0) ? \
+                queues[stage_read]->pop(mine.starved_seconds) : \
+                queues[stage_read]->try_pop();
+            if( item == NULL ) {
+                more = not cancelled();
+                break;
+            }
+            if( not next_filename(*item) ) {
+                queues[stage_read]->push(item, mine.blocked_seconds);
+                more = false;
+                break;
+            }
+            if( ring->queue_open(*item) ) {
+                ++reading;
+            } else {
+                item->status = error_open;
+                item->failed_stage = stage_read;
+                ++mine.failures;
+                done.push_back(item);
+            }
+        }
+
+        const double start = monotonic_seconds();
+        if( reading > 0 && ring->enter() < 0 ) {
+            // Nothing was submitted, so nothing more will complete.
+            cancel();
+            break;
+        }
+        PipelineItem *item;
+        int result;
+        while( ring->reap(item, result) ) {
+            int retval = load_ok;
+            if( item->fd < 0 ) {
+                if( result >= 0 ) {
+                    item->fd = result;
+                    retval = start_contents(*item, buffer_size);
+                } else {
+                    retval = error_open;
+                }
+            } else if( result > 0 ) {
+                item->length += result;
+            } else if( result == 0 ) {
+                item->expected = item->length;      // Shorter than when opened.
+            } else if( result != -EINTR && result != -EAGAIN ) {
+                retval = error_open;
+            }
+            if( retval == load_ok && item->length < item->expected ) {
+                if( ring->queue_read(*item, (int)(item - &items[0])) ) {
+                    continue;
+                }
+                retval = error_open;
+            }
+
+            --reading;
+            if( item->fd >= 0 ) {
+                close(item->fd);
+                item->fd = -1;
+            }
+            if( retval < 1 ) {
+                item->data = NULL;
+                item->length = 0;
+                item->status = retval;
+                item->failed_stage = stage_read;
+                ++mine.failures;
+            }
+            done.push_back(item);
+        }
+        mine.busy_seconds += monotonic_seconds() - start;
+
+        for( size_t i = 0; i < done.size(); i++ ) {
+            process(stage_read, *done[i], mine);
+            queues[stage_read + 1]->push(done[i], mine.blocked_seconds);
+        }
+        done.clear();
+        if( reading == 0 && not more ) {
+            break;
+        }
+    }
+#else
+    (void)mine;
+#endif
+}
+
+
+// With read_contents and reader threads, the files after this one (up to
+// io_depth) are opened as it is taken, and posix_fadvise starts the kernel
+// reading them in.
+bool image_io::Pipeline::next_filename(PipelineItem &item) {
+    pthread_mutex_lock(&mutex);
+    const size_t ahead = (read_contents && ring == NULL) ? io_depth : 0;
+    while( not inputs_done && not stopping && lookahead.size() <= ahead ) {
+        Opened next;
+        if( not functions.source(job, next.filename) ) {
+            inputs_done = true;
+            break;
+        }
+        next.fd = -1;
+        if( ahead > 0 ) {
+            next.fd = open(next.filename.c_str(), O_RDONLY | O_CLOEXEC);
+#ifdef POSIX_FADV_WILLNEED
+            if( next.fd >= 0 ) {
+                posix_fadvise(next.fd, 0, 0, POSIX_FADV_WILLNEED);
+            }
+#endif
+        }
+        lookahead.push_back(next);
+    }
+    bool found = false;
+    if( not lookahead.empty() && not stopping ) {
+        item.filename.swap(lookahead.front().filename);
+        item.fd = lookahead.front().fd;
+        lookahead.pop_front();
+        item.index = next_input++;
+        found = true;
+    }
+    pthread_mutex_unlock(&mutex);
+    return found;
+}
+
+
+// Reads the file next_filename() opened into item (see start_contents()).
+int image_io::Pipeline::read_file(PipelineItem &item) {
+    if( item.fd < 0 ) {
+        return error_open;
+    }
+    int retval = start_contents(item, buffer_size);
+    while( retval == load_ok && item.length < item.expected ) {
+        const ssize_t count = pread(item.fd, (char*)item.data + item.length, \
+            item.expected - item.length, item.length);
+        if( count > 0 ) {
+            item.length += count;
+        } else if( count == 0 ) {
+            break;      // Shorter than when opened.
+        } else if( errno != EINTR ) {
+            retval = error_open;
+        }
+    }
+    close(item.fd);
+    item.fd = -1;
+    if( retval != load_ok ) {
+        item.data = NULL;
+        item.length = 0;
+    }
+    return retval;
+}
+
+
+// Records a stage thread's stats as it exits; the stage's last thread
+// closes the queue into the next stage.
+void image_io::Pipeline::finish(int stage, const PipelineStats &thread_stats) {
+    pthread_mutex_lock(&mutex);
+    PipelineStats &stats = stage_stats[stage];
+    stats.items += thread_stats.items;
+    stats.failures += thread_stats.failures;
+    stats.busy_seconds += thread_stats.busy_seconds;
+    stats.starved_seconds += thread_stats.starved_seconds;
+    stats.blocked_seconds += thread_stats.blocked_seconds;
+    const bool last = (--running[stage] == 0);
+    pthread_mutex_unlock(&mutex);
+    if( last && stage + 1 < pipeline_stages ) {
+        queues[stage + 1]->close();
+    }
+}
+
+
+int image_io::prefetch_file(const char *filename, uint64_t *bytes) {
+    if( filename == NULL ) {
+        return error_arguments;
+    }
+    const int fd = open(filename, O_RDONLY);
+    if( fd < 0 ) {
+        return error_open;
+    }
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    char buffer[65536];
+    uint64_t total = 0;
+    ssize_t count;
+    while( (count = read(fd, buffer, sizeof(buffer))) != 0 ) {
+        if( count > 0 ) {
+            total += count;
+        } else if( errno != EINTR ) {
+            break;
+        }
+    }
+    close(fd);
+    if( count < 0 ) {
+        return error_open;
+    }
+    if( bytes != NULL ) {
+        *bytes += total;
+    }
+    return load_ok;
+}
@@ -0,0 +1,200 @@
+//============================================================================
+// Name        : pipeline.h
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : Staged executor for batch fingerprinting:  files are read,
+//               decoded, fingerprinted and emitted by separate threads
+//               joined by bounded queues, so that disk and CPUs stay busy
+//               at once.
+//============================================================================
+
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <deque>
+#include <string>
+#include <vector>
+#include "image_io.h"
+
+
+namespace image_io {
+
+enum pipeline_stage {
+    stage_read = 0,     // I/O:  bring the file into memory (see prefetch_file
+                        // and PipelineOptions::read_contents).
+    stage_decode = 1,   // CPU:  decode it.
+    stage_compute = 2,  // CPU:  fingerprint the decoded image.
+    stage_emit = 3,     // One thread, in input order:  write the results.
+    pipeline_stages = 4
+};
+
+// One input's trip through a Pipeline.  Items are recycled:  state is the
+// job's own per-item buffers (decoded image, fingerprints), created by its
+// create_state function the first time the item is used and kept for the
+// next input the item carries.
+struct PipelineItem {
+    uint64_t index;         // Position in the input:  0, 1, ...
+    std::string filename;
+    int status;             // 1 until a stage fails; then its return value.
+    int failed_stage;       // Stage that set status (-1:  none).
+    void *state;
+    const char *data;       // With read_contents, the file's contents from
+    size_t length;          // the read stage function on (else NULL, 0).
+
+    // The pipeline's own:  where contents are read to.
+    char *buffer;                   // buffer_size bytes (may be NULL).
+    std::vector<char> overflow;     // Files larger than the buffer.
+    int fd;
+    size_t expected;                // The file's size when opened.
+
+    PipelineItem() : index(0), status(1), failed_stage(-1), state(NULL), \
+        data(NULL), length(0), buffer(NULL), fd(-1), expected(0) {}
+};
+
+// Stage functions return 1 on success; a value below 1 is recorded in the
+// item, whose remaining stages other than emit are then skipped.  Stages
+// may be NULL (nothing to do), except emit.
+typedef int (*pipeline_function)(void *job, PipelineItem &item);
+// The next input's filename; false once there are none left.  Called by one
+// reader thread at a time.
+typedef bool (*pipeline_source)(void *job, std::string &filename);
+typedef void *(*pipeline_create_state)(void *job);
+typedef void (*pipeline_destroy_state)(void *job, void *state);
+
+struct PipelineFunctions {
+    pipeline_source source;
+    pipeline_function stages[pipeline_stages];
+    pipeline_create_state create_state;     // May be NULL (state stays NULL).
+    pipeline_destroy_state destroy_state;
+
+    PipelineFunctions() : source(NULL), create_state(NULL), \
+        destroy_state(NULL) {
+        for( int stage = 0; stage < pipeline_stages; stage++ ) {
+            stages[stage] = NULL;
+        }
+    }
+};
+
+struct PipelineOptions {
+    int reader_threads;     // Reads in flight at once (default 1:  best for
+                            // a local disk; NFS and SSDs like more).
+    int decoder_threads;    // 0:  one per online CPU.
+    int compute_threads;    // 0:  one per online CPU.
+    int queue_length;       // Items waiting between two stages (0:  twice
+                            // the consuming stage's threads).
+    // Read each file into its item (data, length) before the read stage
+    // function runs, keeping io_depth reads in flight:  through io_uring,
+    // where the kernel has it (one reader thread, reading into as many
+    // registered buffers as the memlock limit allows), or else by reader_threads
+    // threads, with the next io_depth files opened and posix_fadvise'd
+    // ahead of them.
+    bool read_contents;
+    bool use_io_uring;      // false:  always the threads.
+    int io_depth;           // 0:  32.
+    size_t buffer_size;     // Each item's buffer (0:  256 KB); larger files
+                            // are read into memory of their own.
+
+    PipelineOptions() : reader_threads(1), decoder_threads(0), \
+        compute_threads(0), queue_length(0), read_contents(false), \
+        use_io_uring(true), io_depth(0), buffer_size(0) {}
+};
+
+// Where a stage's threads spent their time, summed over its threads.
+// busy / (threads * Pipeline::elapsed_seconds()) is its utilization; a
+// stage that is always starved (waiting for input) follows the bottleneck,
+// and one that is often blocked (waiting for room downstream) precedes it.
+struct PipelineStats {
+    int threads;
+    uint64_t items;
+    uint64_t failures;      // Items whose status this stage set below 1.
+    double busy_seconds;
+    double starved_seconds;
+    double blocked_seconds;
+
+    PipelineStats() : threads(0), items(0), failures(0), busy_seconds(0.0), \
+        starved_seconds(0.0), blocked_seconds(0.0) {}
+};
+
+// Return values of Pipeline::run (negative values are failures).
+const int pipeline_ok = 1;
+const int error_pipeline_cancelled = -20;
+const int error_pipeline_threads = -21;    // No thread could be started.
+
+class Pipeline {
+public:
+    struct Queue;       // See pipeline.cpp.
+
+    Pipeline(const PipelineFunctions &functions, void *job, \
+            const PipelineOptions &options=PipelineOptions());
+    ~Pipeline();
+
+    // Runs every input from functions.source through the stages and returns
+    // once the last has been emitted (or, if cancelled, abandoned).  Items
+    // are emitted in input order, each exactly once, whether or not it
+    // failed; at most in_flight() are held at any time.
+    int run();
+    // Stops taking inputs and abandons those not yet emitted; run() then
+    // returns error_pipeline_cancelled.  Safe from any thread, including a
+    // stage function's.
+    void cancel();
+    bool cancelled() const;
+
+    int in_flight() const;
+    // Whether files are read through io_uring (see read_contents).
+    bool io_uring() const;
+    // How many of the items' buffers io_uring reads into as registered ones.
+    int registered_buffers() const;
+    const PipelineStats &stats(int stage) const;
+    double elapsed_seconds() const;
+
+private:
+    PipelineFunctions functions;
+    void *job;
+    int threads[pipeline_stages];
+    std::vector<PipelineItem> items;
+    Queue *queues[pipeline_stages];     // Into each stage (reading:  free items).
+    PipelineStats stage_stats[pipeline_stages];
+    int running[pipeline_stages];       // Threads of each stage not finished.
+    double elapsed;
+    bool stopping;
+    mutable pthread_mutex_t mutex;  // Guards the source, stats, running, and
+                                    // stopping.
+    uint64_t next_input;
+    bool inputs_done;
+    // Reading contents (see PipelineOptions).
+    bool read_contents;
+    int io_depth;
+    size_t buffer_size;
+    char *buffers;          // The items' buffers, in one block.
+    struct Opened {
+        std::string filename;
+        int fd;
+    };
+    std::deque<Opened> lookahead;   // Opened ahead of the reader threads.
+    struct Ring;        // See pipeline.cpp.
+    Ring *ring;         // NULL:  no io_uring.
+
+    struct Worker;
+    static void *run_worker(void *worker);
+    void work(int stage);
+    void read_ring(PipelineStats &mine);
+    bool next_filename(PipelineItem &item);
+    int read_file(PipelineItem &item);
+    void process(int stage, PipelineItem &item, PipelineStats &mine);
+    void finish(int stage, const PipelineStats &thread_stats);
+
+    Pipeline(const Pipeline &);
+    Pipeline &operator=(const Pipeline &);
+};
+
+// Reads filename through to its end, so that decoding it afterwards finds it
+// in the page cache rather than waiting on the disk; adds its size to bytes
+// (if given).  Returns load_ok or error_open.
+int prefetch_file(const char *filename, uint64_t *bytes=NULL);
+}
+
+#endif /* PIPELINE_H_ */
@@ -0,0 +1,686 @@
+//============================================================================
+// Name        : scanline_reader.cpp
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : Row-at-a-time JPEG, PNG, and TIFF decoding, so that images
+//               far larger than memory allows can still be fingerprinted.
+//============================================================================
+
+#include "scanline_reader.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <jpeglib.h>
+#include <png.h>
+#ifdef cimg_use_tiff
+#include <tiffio.h>
+#endif
+
+
+namespace {
+
+enum tiff_layout {
+    tiff_contig = 0,    // Raw samples, read a scanline at a time.
+    tiff_separate = 1,  // Raw samples, one strip per plane buffered.
+    tiff_rgba = 2,      // libtiff's RGBA conversion, one strip buffered.
+    tiff_tiles = 3,     // Raw samples, one row of tiles (per plane) buffered.
+    tiff_rgba_tiles = 4 // libtiff's RGBA conversion, one row of tiles buffered.
+};
+
+struct jpeg_error_handler {
+    struct jpeg_error_mgr original;
+    jmp_buf setjmp_buffer;
+};
+
+void jpeg_error_exit(j_common_ptr cinfo) {
+    jpeg_error_handler *handler = (jpeg_error_handler *)cinfo->err;
+    longjmp(handler->setjmp_buffer, 1);
+}
+
+void jpeg_silent_message(j_common_ptr) {
+}
+}
+
+
+struct image_io::ScanlineReader::State {
+    FILE *file;
+    int row;                            // Next row read_row() returns.
+    std::vector<unsigned char> buffer;  // Decoded rows held by the reader.
+
+    bool jpeg_active;
+    struct jpeg_decompress_struct jpeg;
+    jpeg_error_handler jpeg_error;
+
+    png_structp png;
+    png_infop png_info;
+    bool png_gray, png_alpha, png_buffered;
+    int png_row_bytes;
+
+#ifdef cimg_use_tiff
+    TIFF *tiff;
+    tiff_layout layout;
+    int samples, bits;
+    bool separate;                      // One plane per sample.
+    uint32 band_rows;                   // Rows per strip or per row of tiles.
+    uint32 tile_width;
+    tmsize_t chunk_size;                // Bytes per strip or tile.
+    int band_row;                       // First row of the buffered band.
+#endif
+
+    State() : file(NULL), row(0), jpeg_active(false), png(NULL), \
+        png_info(NULL), png_gray(false), png_alpha(false), \
+        png_buffered(false), png_row_bytes(0)
+#ifdef cimg_use_tiff
+        , tiff(NULL), layout(tiff_contig), samples(1), bits(8), \
+        separate(false), band_rows(0), tile_width(0), chunk_size(0), band_row(-1)
+#endif
+        {}
+};
+
+
+image_io::ScanlineReader::ScanlineReader() : state(NULL) {
+}
+
+
+image_io::ScanlineReader::~ScanlineReader() {
+    close();
+}
+
+
+void image_io::ScanlineReader::close() {
+    if( state == NULL ) {
+        return;
+    }
+    if( state->jpeg_active ) {
+        jpeg_destroy_decompress(&state->jpeg);
+    }
+    if( state->png != NULL ) {
+        png_destroy_read_struct(&state->png, &state->png_info, NULL);
+    }
+#ifdef cimg_use_tiff
+    if( state->tiff != NULL ) {
+        TIFFClose(state->tiff);
+    }
+#endif
+    if( state->file != NULL ) {
+        fclose(state->file);
+    }
+    delete state;
+    state = NULL;
+    info = ImageInfo();
+}
+
+
+size_t image_io::ScanlineReader::buffer_size() const {
+    return (state == NULL) ? 0 : state->buffer.size();
+}
+
+
+static bool exceeds_cap(uint64_t bytes, const image_io::DecodeOptions &options) {
+    return options.memory_cap > 0 && bytes > options.memory_cap;
+}
+
+
+static int open_jpeg(image_io::ScanlineReader::State *state, \
+        image_io::ImageInfo &info, const image_io::DecodeOptions &options) {
+    struct jpeg_decompress_struct &jpeg = state->jpeg;
+    jpeg.err = jpeg_std_error(&state->jpeg_error.original);
+    state->jpeg_error.original.error_exit = jpeg_error_exit;
+    state->jpeg_error.original.output_message = jpeg_silent_message;
+    if( setjmp(state->jpeg_error.setjmp_buffer) ) {
+        return image_io::error_decode;
+    }
+    jpeg_create_decompress(&jpeg);
+    state->jpeg_active = true;
+    jpeg_stdio_src(&jpeg, state->file);
+    jpeg_read_header(&jpeg, TRUE);
+
+    // Progressive scans are buffered as whole-image coefficient arrays.
+    if( jpeg_has_multiple_scans(&jpeg) && exceeds_cap((uint64_t)jpeg.image_width * \
+            jpeg.image_height * jpeg.num_components * sizeof(JCOEF), options) ) {
+        return image_io::error_too_large;
+    }
+    jpeg.scale_num = 1;
+    jpeg.scale_denom = image_io::jpeg_scale_denom(info, options.min_dim);
+    jpeg_start_decompress(&jpeg);
+    if( jpeg.output_components != 1 && jpeg.output_components != 3 && \
+            jpeg.output_components != 4 ) {
+        return image_io::error_decode;
+    }
+    info.width = jpeg.output_width;
+    info.height = jpeg.output_height;
+    info.channels = jpeg.output_components;
+    state->buffer.resize((size_t)info.width * info.channels);
+    return image_io::load_ok;
+}
+
+
+static int read_jpeg_row(image_io::ScanlineReader::State *state, \
+        const image_io::ImageInfo &info, uint16_t *samples) {
+    if( setjmp(state->jpeg_error.setjmp_buffer) ) {
+        return image_io::error_decode;
+    }
+    JSAMPROW row_pointer[1] = { &state->buffer[0] };
+    if( jpeg_read_scanlines(&state->jpeg, row_pointer, 1) != 1 ) {
+        return image_io::error_decode;
+    }
+    size_t count = (size_t)info.width * info.channels;
+    for( size_t i = 0; i < count; i++ ) {
+        samples[i] = state->buffer[i];
+    }
+    if( state->row + 1 == info.height ) {
+        jpeg_finish_decompress(&state->jpeg);
+    }
+    return 1;
+}
+
+
+// Applies the same transforms as CImg::load_png():  palette to RGB, gray
+// widened to 8 bits, tRNS to alpha, then everything expanded to 4 samples of
+// which only the channels CImg keeps are returned.
+static int open_png(image_io::ScanlineReader::State *state, \
+        image_io::ImageInfo &info, const image_io::DecodeOptions &options) {
+    state->png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if( state->png == NULL ) {
+        return image_io::error_decode;
+    }
+    state->png_info = png_create_info_struct(state->png);
+    if( state->png_info == NULL ) {
+        return image_io::error_decode;
+    }
+    if( setjmp(png_jmpbuf(state->png)) ) {
+        return image_io::error_decode;
+    }
+    png_structp png = state->png;
+    png_infop png_info = state->png_info;
+    png_init_io(png, state->file);
+    png_read_info(png, png_info);
+
+    png_uint_32 width, height;
+    int bit_depth, color_type, interlace_type;
+    png_get_IHDR(png, png_info, &width, &height, &bit_depth, &color_type, \
+        &interlace_type, NULL, NULL);
+    if( color_type == PNG_COLOR_TYPE_PALETTE ) {
+        png_set_palette_to_rgb(png);
+        color_type = PNG_COLOR_TYPE_RGB;
+        bit_depth = 8;
+    }
+    if( color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8 ) {
+        png_set_expand_gray_1_2_4_to_8(png);
+        state->png_gray = true;
+        bit_depth = 8;
+    }
+    if( png_get_valid(png, png_info, PNG_INFO_tRNS) ) {
+        png_set_tRNS_to_alpha(png);
+        color_type |= PNG_COLOR_MASK_ALPHA;
+    }
+    if( color_type == PNG_COLOR_TYPE_GRAY || \
+            color_type == PNG_COLOR_TYPE_GRAY_ALPHA ) {
+        png_set_gray_to_rgb(png);
+        color_type |= PNG_COLOR_MASK_COLOR;
+        state->png_gray = true;
+    }
+    if( color_type == PNG_COLOR_TYPE_RGB ) {
+        png_set_filler(png, 0xffffU, PNG_FILLER_AFTER);
+    }
+    int passes = png_set_interlace_handling(png);
+    png_read_update_info(png, png_info);
+    if( bit_depth != 8 && bit_depth != 16 ) {
+        return image_io::error_decode;
+    }
+    state->png_alpha = (color_type == PNG_COLOR_TYPE_RGB_ALPHA);
+    state->png_row_bytes = (int)png_get_rowbytes(png, png_info);
+
+    // Interlaced images only come together once every pass has been read.
+    state->png_buffered = (passes > 1);
+    uint64_t rows = state->png_buffered ? height : 1;
+    if( exceeds_cap(rows * state->png_row_bytes, options) ) {
+        return image_io::error_too_large;
+    }
+    state->buffer.resize(rows * state->png_row_bytes);
+    if( state->png_buffered ) {
+        std::vector<png_bytep> row_pointers(height);
+        for( png_uint_32 y = 0; y < height; y++ ) {
+            row_pointers[y] = &state->buffer[(size_t)y * state->png_row_bytes];
+        }
+        png_read_image(png, &row_pointers[0]);
+    }
+
+    info.width = width;
+    info.height = height;
+    info.bit_depth = bit_depth;
+    info.channels = (state->png_gray ? 1 : 3) + (state->png_alpha ? 1 : 0);
+    return image_io::load_ok;
+}
+
+
+static int read_png_row(image_io::ScanlineReader::State *state, \
+        const image_io::ImageInfo &info, uint16_t *samples) {
+    unsigned char *row = &state->buffer[0];
+    if( state->png_buffered ) {
+        row += (size_t)state->row * state->png_row_bytes;
+    } else {
+        if( setjmp(png_jmpbuf(state->png)) ) {
+            return image_io::error_decode;
+        }
+        png_read_row(state->png, row, NULL);
+    }
+
+    const int alpha_channel = state->png_gray ? 1 : 3;
+    const int bytes = info.bit_depth / 8;
+    for( int x = 0; x < info.width; x++ ) {
+        uint16_t pixel[4];
+        for( int c = 0; c < 4; c++ ) {
+            const unsigned char *sample = row + (x * 4 + c) * bytes;
+            pixel[c] = (bytes == 2) ? (uint16_t)((sample[0] << 8) | sample[1]) \
+                : sample[0];
+        }
+        uint16_t *out = samples + x * info.channels;
+        out[0] = pixel[0];
+        if( not state->png_gray ) {
+            out[1] = pixel[1];
+            out[2] = pixel[2];
+        }
+        if( state->png_alpha ) {
+            out[alpha_channel] = pixel[3];
+        }
+    }
+    return 1;
+}
+
+
+#ifdef cimg_use_tiff
+// Whether a directory is a reduced copy of the full width x height image:
+// same aspect ratio, allowing for each side having been rounded.
+static bool is_tiff_reduction(uint32 width, uint32 height, \
+        uint32 full_width, uint32 full_height) {
+    if( width == 0 || height == 0 || width >= full_width ) {
+        return false;
+    }
+    int64_t skew = (int64_t)width * full_height - (int64_t)height * full_width;
+    return (skew < 0 ? -skew : skew) <= (int64_t)full_width + full_height;
+}
+
+
+// Pyramidal and multi-resolution TIFFs also store reduced-resolution copies
+// of the first image, as its SubIFDs or as later directories marked
+// FILETYPE_REDUCEDIMAGE.  Leaves the smallest one whose sides both still
+// cover min_dim (or the first image) as the current directory.
+static int select_tiff_level(TIFF *tiff, int min_dim) {
+    uint32 full_width = 0, full_height = 0;
+    TIFFGetField(tiff, TIFFTAG_IMAGEWIDTH, &full_width);
+    TIFFGetField(tiff, TIFFTAG_IMAGELENGTH, &full_height);
+    if( min_dim <= 0 || full_width == 0 || full_height == 0 ) {
+        return image_io::load_ok;
+    }
+
+    uint16 count = 0;
+    toff_t *offsets = NULL;
+    std::vector<toff_t> sub_ifds;
+    if( TIFFGetField(tiff, TIFFTAG_SUBIFD, &count, &offsets) && count > 0 ) {
+        sub_ifds.assign(offsets, offsets + count);
+    }
+
+    uint64_t best_pixels = (uint64_t)full_width * full_height;
+    int best_directory = 0;
+    toff_t best_sub_ifd = 0;
+    for( size_t i = 0; i <= sub_ifds.size(); i++ ) {
+        // Later top-level directories first, then the SubIFDs.
+        bool more = (i == 0) ? TIFFReadDirectory(tiff) : \
+            TIFFSetSubDirectory(tiff, sub_ifds[i - 1]);
+        while( more ) {
+            uint32 width = 0, height = 0, type = 0;
+            TIFFGetField(tiff, TIFFTAG_IMAGEWIDTH, &width);
+            TIFFGetField(tiff, TIFFTAG_IMAGELENGTH, &height);
+            TIFFGetField(tiff, TIFFTAG_SUBFILETYPE, &type);
+            if( (i > 0 || (type & FILETYPE_REDUCEDIMAGE)) && \
+                    is_tiff_reduction(width, height, full_width, full_height) && \
+                    (int)width >= min_dim && (int)height >= min_dim && \
+                    (uint64_t)width * height < best_pixels ) {
+                best_pixels = (uint64_t)width * height;
+                best_directory = (i == 0) ? TIFFCurrentDirectory(tiff) : 0;
+                best_sub_ifd = (i == 0) ? 0 : sub_ifds[i - 1];
+            }
+            more = (i == 0) && TIFFReadDirectory(tiff);
+        }
+    }
+
+    bool found = (best_sub_ifd != 0) ? TIFFSetSubDirectory(tiff, best_sub_ifd) \
+        : TIFFSetDirectory(tiff, (tdir_t)best_directory);
+    return found ? image_io::load_ok : image_io::error_decode;
+}
+
+
+// Mirrors CImg::load_tiff():  raw samples unless libtiff's RGBA conversion is
+// needed (palette, YCbCr, etc., or 8-bit RGB/RGBA).  Plain 8-bit RGB reads
+// identically either way, so it stays on the cheaper raw path.  Strips are
+// read one at a time and tiles one row of tiles at a time.
+static int open_tiff(image_io::ScanlineReader::State *state, \
+        image_io::ImageInfo &info, const image_io::DecodeOptions &options, \
+        const char *filename) {
+    fclose(state->file);
+    state->file = NULL;
+    state->tiff = TIFFOpen(filename, "r");
+    if( state->tiff == NULL ) {
+        return image_io::error_decode;
+    }
+    TIFF *tiff = state->tiff;
+    int retval = select_tiff_level(tiff, options.min_dim);
+    if( retval != image_io::load_ok ) {
+        return retval;
+    }
+    uint32 width = 0, height = 0;
+    uint16 samples = 1, bits = 1, photometric = 0;
+    uint16 sample_format = SAMPLEFORMAT_UINT, planar = PLANARCONFIG_CONTIG;
+    TIFFGetField(tiff, TIFFTAG_IMAGEWIDTH, &width);
+    TIFFGetField(tiff, TIFFTAG_IMAGELENGTH, &height);
+    TIFFGetField(tiff, TIFFTAG_SAMPLESPERPIXEL, &samples);
+    TIFFGetField(tiff, TIFFTAG_SAMPLEFORMAT, &sample_format);
+    TIFFGetFieldDefaulted(tiff, TIFFTAG_BITSPERSAMPLE, &bits);
+    TIFFGetField(tiff, TIFFTAG_PHOTOMETRIC, &photometric);
+    TIFFGetField(tiff, TIFFTAG_PLANARCONFIG, &planar);
+    if( width == 0 || height == 0 ) {
+        return image_io::error_not_streamable;
+    }
+    if( options.max_pixels > 0 && \
+            (uint64_t)width * height > options.max_pixels ) {
+        return image_io::error_too_large;
+    }
+    bool tiled = TIFFIsTiled(tiff);
+    uint32 tiles_across = 1;
+    if( tiled ) {
+        TIFFGetField(tiff, TIFFTAG_TILEWIDTH, &state->tile_width);
+        TIFFGetField(tiff, TIFFTAG_TILELENGTH, &state->band_rows);
+        if( state->tile_width == 0 || state->band_rows == 0 ) {
+            return image_io::error_decode;
+        }
+        tiles_across = (width + state->tile_width - 1) / state->tile_width;
+        state->chunk_size = TIFFTileSize(tiff);
+    } else {
+        TIFFGetFieldDefaulted(tiff, TIFFTAG_ROWSPERSTRIP, &state->band_rows);
+        if( state->band_rows > height ) {
+            state->band_rows = height;
+        }
+        state->chunk_size = TIFFStripSize(tiff);
+    }
+
+    bool rgba = not (photometric < 3 && \
+        (bits != 8 || not (samples == 3 || samples == 4)));
+    if( rgba && photometric == PHOTOMETRIC_RGB && bits == 8 && samples == 3 ) {
+        rgba = false;
+    }
+    uint64_t bytes;
+    if( rgba ) {
+        info.channels = (photometric == PHOTOMETRIC_PALETTE) ? 3 : samples;
+        if( info.channels != 3 && info.channels != 4 ) {
+            return image_io::error_not_streamable;
+        }
+        info.bit_depth = 8;
+        if( tiled ) {
+            state->layout = tiff_rgba_tiles;
+            bytes = (uint64_t)tiles_across * state->tile_width * \
+                state->band_rows * sizeof(uint32);
+        } else {
+            state->layout = tiff_rgba;
+            bytes = (uint64_t)state->band_rows * width * sizeof(uint32);
+        }
+    } else {
+        if( sample_format != SAMPLEFORMAT_UINT || (bits != 8 && bits != 16) ) {
+            return image_io::error_not_streamable;
+        }
+        info.channels = samples;
+        info.bit_depth = bits;
+        uint64_t planes = (planar == PLANARCONFIG_SEPARATE) ? samples : 1;
+        if( tiled ) {
+            state->layout = tiff_tiles;
+            bytes = planes * tiles_across * state->chunk_size;
+        } else if( planar == PLANARCONFIG_SEPARATE ) {
+            state->layout = tiff_separate;
+            bytes = planes * state->chunk_size;
+        } else {
+            state->layout = tiff_contig;
+            bytes = TIFFScanlineSize(tiff);
+        }
+    }
+    if( exceeds_cap(bytes, options) ) {
+        return image_io::error_too_large;
+    }
+    state->buffer.resize(bytes);
+    state->samples = samples;
+    state->bits = bits;
+    state->separate = (planar == PLANARCONFIG_SEPARATE);
+    info.width = width;
+    info.height = height;
+    return image_io::load_ok;
+}
+
+
+static bool read_tiff_band(image_io::ScanlineReader::State *state, \
+        const image_io::ImageInfo &info, int band_row) {
+    TIFF *tiff = state->tiff;
+    unsigned char *buffer = &state->buffer[0];
+    const int planes = state->separate ? state->samples : 1;
+    if( state->layout == tiff_rgba ) {
+        return TIFFReadRGBAStrip(tiff, band_row, (uint32 *)buffer);
+    } else if( state->layout == tiff_separate ) {
+        for( int s = 0; s < planes; s++ ) {
+            if( TIFFReadEncodedStrip(tiff, TIFFComputeStrip(tiff, band_row, s), \
+                    buffer + s * state->chunk_size, state->chunk_size) < 0 ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const uint32 tile_width = state->tile_width;
+    const size_t tiles_across = (info.width + tile_width - 1) / tile_width;
+    for( size_t t = 0; t < tiles_across; t++ ) {
+        if( state->layout == tiff_rgba_tiles ) {
+            if( not TIFFReadRGBATile(tiff, t * tile_width, band_row, \
+                    (uint32 *)buffer + t * tile_width * state->band_rows) ) {
+                return false;
+            }
+            continue;
+        }
+        for( int s = 0; s < planes; s++ ) {
+            if( TIFFReadEncodedTile(tiff, TIFFComputeTile(tiff, t * tile_width, \
+                    band_row, 0, s), buffer + (s * tiles_across + t) * \
+                    state->chunk_size, state->chunk_size) < 0 ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+static int read_tiff_row(image_io::ScanlineReader::State *state, \
+        const image_io::ImageInfo &info, uint16_t *samples) {
+    const int row = state->row;
+    const size_t width = info.width;
+    const unsigned char *buffer = &state->buffer[0];
+
+    if( state->layout == tiff_contig ) {
+        if( TIFFReadScanline(state->tiff, &state->buffer[0], row, 0) < 0 ) {
+            return image_io::error_decode;
+        }
+        size_t count = width * info.channels;
+        for( size_t i = 0; i < count; i++ ) {
+            samples[i] = (state->bits == 16) ? ((uint16_t *)buffer)[i] : buffer[i];
+        }
+        return 1;
+    }
+
+    int band_row = row - row % state->band_rows;
+    if( band_row != state->band_row ) {
+        if( not read_tiff_band(state, info, band_row) ) {
+            return image_io::error_decode;
+        }
+        state->band_row = band_row;
+    }
+    const int band_rows = std::min((int)state->band_rows, info.height - band_row);
+    const size_t y = row - band_row;
+
+    if( state->layout == tiff_rgba || state->layout == tiff_rgba_tiles ) {
+        // libtiff returns each strip or tile bottom row first; short tiles
+        // at the bottom edge are still laid out at full height.
+        const uint32 *raster = (const uint32 *)buffer;
+        for( size_t x = 0; x < width; x++ ) {
+            const uint32 *pixel;
+            if( state->layout == tiff_rgba ) {
+                pixel = raster + (band_rows - 1 - y) * width + x;
+            } else {
+                const size_t tile_width = state->tile_width;
+                pixel = raster + (x / tile_width) * tile_width * state->band_rows \
+                    + (state->band_rows - 1 - y) * tile_width + x % tile_width;
+            }
+            uint16_t *out = samples + x * info.channels;
+            out[0] = TIFFGetR(*pixel);
+            out[1] = TIFFGetG(*pixel);
+            out[2] = TIFFGetB(*pixel);
+            if( info.channels == 4 ) {
+                out[3] = TIFFGetA(*pixel);
+            }
+        }
+        return 1;
+    }
+
+    // Raw samples:  locate each one's plane (strip or tile) and offset in it.
+    const int channels = info.channels;
+    const size_t tile_width = (state->layout == tiff_tiles) ? \
+        state->tile_width : width;
+    const size_t tiles_across = (width + tile_width - 1) / tile_width;
+    for( size_t x = 0; x < width; x++ ) {
+        const size_t tile = x / tile_width;
+        const size_t pixel = y * tile_width + x % tile_width;
+        for( int s = 0; s < channels; s++ ) {
+            size_t chunk, offset;
+            if( state->separate ) {
+                chunk = s * tiles_across + tile;
+                offset = pixel;
+            } else {
+                chunk = tile;
+                offset = pixel * channels + s;
+            }
+            const unsigned char *data = buffer + chunk * state->chunk_size;
+            samples[x * channels + s] = (state->bits == 16) ? \
+                ((const uint16_t *)data)[offset] : data[offset];
+        }
+    }
+    return 1;
+}
+#endif
+
+
+int image_io::ScanlineReader::open(const char *filename, \
+        const DecodeOptions &options) {
+    close();
+    int retval = probe_image(filename, info);
+    if( retval != load_ok ) {
+        return retval;
+    }
+    // TIFFs are checked once the directory to read has been chosen.
+    if( info.format != format_tiff && options.max_pixels > 0 && \
+            (uint64_t)info.width * info.height > options.max_pixels ) {
+        return error_too_large;
+    }
+
+    state = new State();
+    state->file = fopen(filename, "rb");
+    if( state->file == NULL ) {
+        close();
+        return error_open;
+    }
+    EmbeddedPreview preview;
+    if( info.format == format_jpeg && options.preview_min_dim > 0 && \
+            find_preview(filename, options.preview_min_dim, preview) == load_ok ) {
+        if( fseek(state->file, (long)preview.offset, SEEK_SET) != 0 ) {
+            close();
+            return error_open;
+        }
+        info = preview.info;
+    }
+    if( info.format == format_jpeg ) {
+        retval = open_jpeg(state, info, options);
+    } else if( info.format == format_png ) {
+        retval = open_png(state, info, options);
+    } else {
+#ifdef cimg_use_tiff
+        retval = open_tiff(state, info, options, filename);
+#else
+        retval = error_not_streamable;
+#endif
+    }
+    if( retval != load_ok ) {
+        close();
+    }
+    return retval;
+}
+
+
+int image_io::ScanlineReader::read_row(uint16_t *samples) {
+    if( state == NULL || samples == NULL ) {
+        return error_arguments;
+    }
+    if( state->row >= info.height ) {
+        return 0;
+    }
+    int retval;
+    if( info.format == format_jpeg ) {
+        retval = read_jpeg_row(state, info, samples);
+    } else if( info.format == format_png ) {
+        retval = read_png_row(state, info, samples);
+    } else {
+#ifdef cimg_use_tiff
+        retval = read_tiff_row(state, info, samples);
+#else
+        retval = error_not_streamable;
+#endif
+    }
+    if( retval == 1 ) {
+        ++state->row;
+    }
+    return retval;
+}
+
+
+int image_io::ScanlineReader::skip_rows(int count) {
+    if( state == NULL || count < 0 ) {
+        return error_arguments;
+    }
+    count = std::min(count, info.height - state->row);
+    int skipped = 0;
+#ifdef LIBJPEG_TURBO_VERSION
+    if( info.format == format_jpeg ) {
+        if( setjmp(state->jpeg_error.setjmp_buffer) ) {
+            return error_decode;
+        }
+        // Leaves the last row to read_row(), which finishes decompression.
+        skipped = std::max(std::min(count, info.height - 1 - state->row), 0);
+        if( skipped > 0 && \
+                (int)jpeg_skip_scanlines(&state->jpeg, skipped) != skipped ) {
+            return error_decode;
+        }
+        state->row += skipped;
+    }
+#endif
+#ifdef cimg_use_tiff
+    // Strips and tiles are read by row number, so rows need no decoding.
+    if( info.format == format_tiff && state->layout != tiff_contig ) {
+        state->row += count;
+        return count;
+    }
+#endif
+    std::vector<uint16_t> samples;
+    for( ; skipped < count; skipped++ ) {
+        samples.resize((size_t)info.width * info.channels);
+        int retval = read_row(&samples[0]);
+        if( retval < 0 ) {
+            return retval;
+        }
+    }
+    return skipped;
+}
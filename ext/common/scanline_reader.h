@@ -0,0 +1,56 @@
+//============================================================================
+// Name        : scanline_reader.h
+// Author      : Stipple, Inc.
+// Version     : 1.0.0
+// Copyright   : Copyright 2013 Stipple, Inc.
+// Description : Row-at-a-time JPEG, PNG, and TIFF decoding, so that images
+//               far larger than memory allows can still be fingerprinted.
+//============================================================================
+
+#ifndef SCANLINE_READER_H_
+#define SCANLINE_READER_H_
+
+#include "image_io.h"
+
+
+namespace image_io {
+
+// Decodes an image one row at a time, top to bottom.  Rows hold the same
+// sample values CImg's loaders produce (load_image), interleaved per pixel.
+// Only the decoder's working buffers are held in memory:  a few rows for
+// baseline JPEG and non-interlaced PNG, a strip or a row of tiles for TIFF.
+// Layouts that need the whole image buffered (progressive JPEG, interlaced
+// PNG) are refused with error_too_large when that would exceed
+// DecodeOptions::memory_cap.  Given a min_dim, pyramidal TIFFs are read from
+// their smallest reduced-resolution copy that covers it (info describes the
+// copy read).
+class ScanlineReader {
+public:
+    struct State;       // Decoder-specific; see scanline_reader.cpp.
+
+    ImageInfo info;     // Geometry of the decoded rows (after any scaling).
+
+    ScanlineReader();
+    ~ScanlineReader();
+
+    int open(const char *filename, const DecodeOptions &options=DecodeOptions());
+    // samples must hold info.width * info.channels values.  Returns 1 for a
+    // row, 0 once all rows have been read, or a negative error code.
+    int read_row(uint16_t *samples);
+    // Moves past count rows without returning them:  libjpeg-turbo skips
+    // their IDCT and color conversion, TIFFs their strips and tiles.  Returns
+    // the number of rows skipped (fewer at the bottom) or an error code.
+    int skip_rows(int count);
+    void close();
+
+    size_t buffer_size() const;     // Bytes of decoded data held internally.
+
+private:
+    State *state;
+
+    ScanlineReader(const ScanlineReader &);
+    ScanlineReader &operator=(const ScanlineReader &);
+};
+}
+
+#endif /* SCANLINE_READER_H_ */
@@ -38,6 +38,16 @@ unless find_library('tiff', 'TIFFSetDirectory')
   abort "Unable to find libtiff. Please install it."
 end
 
+unless find_library('pthread', 'pthread_create')
+  abort "Unable to find libpthread. Please install it."
+end
+
+# Fingerprinting and index searches run without the GVL where Ruby allows
+# (see image_io::run_blocking()).
+have_header('ruby/thread.h')
+have_func('rb_thread_call_without_gvl', 'ruby/thread.h') or
+  have_func('rb_thread_blocking_region')
+
 
 # For some reason, mkmf falls back to using gcc to link c++ binaries.
 # Use a big hammer and force it to use g++ for everything.
@@ -52,6 +62,19 @@ if RUBY_PLATFORM !~ /darwin/
   Config::MAKEFILE_CONFIG['LDSHARED'] = "#{$CXX} -shared"
 end
 
+# mwisd_fp and histogroup both wrap a class named Fingerprint:  keep each
+# extension's symbols (SWIG's class records among them) to itself, so both
+# may be loaded in one process.  Init_* stays visible via SWIGEXPORT.
+$CPPFLAGS << " -fvisibility=hidden -DGCC_HASCLASSVISIBILITY"
+
+# Sources shared by all fingerprint types (image loading, etc.) live in
+# ext/common and are compiled into each extension.
+COMMON_DIR = File.expand_path('../common', File.dirname(__FILE__))
+$INCFLAGS << " -I#{COMMON_DIR}"
+$VPATH << COMMON_DIR
+$srcs = Dir.glob(File.join($srcdir, '*.{c,cpp,cxx}')).map { |f| File.basename(f) } +
+        Dir.glob(File.join(COMMON_DIR, '*.cpp')).map { |f| File.basename(f) }
+
 # Why does this fail, even when explicitly giving the correct path?
 # It's found just fine during compilation.
 #unless find_header('CImg.h')
@@ -8,26 +8,208 @@
 //============================================================================
 
 #include "histogroup.h"
+#include "image_io.h"
+#include "scanline_reader.h"
 #include "CImg.h"
 #include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 using namespace cimg_library;
 
+// Slots of the thread's image_io::ComputeContext used here.
+enum { context_original = 0, context_histogram = 1 };
 
-int histogroup::compute_image_hash(const char *filename, float* &hash, \
+
+// Normalizes a 3D histogram into the image hash (fingerprint).
+static int histogram_to_hash(CImg<float> &hist, float* &hash, \
         int hash_size_in_bytes, int bins_per_dimension) {
-    // Input sanity check.
-    if( filename == NULL ) {
-        fprintf(stderr, "compute_image_hash() : Must supply filename != NULL.\n");
-        return -1;
+    // Change representation of hist to simplify code in next steps.
+    hist.unroll('x');
+
+    // Compute sum for normalizing histogram during next step.
+    float sum = 0.0;
+    cimg_forX(hist, x) {
+        sum += hist(x);
     }
-    if( bins_per_dimension < 2 ) {
-        fprintf(stderr, "compute_image_hash() : Must request 2 or more bins per dim!\n");
-        return -2;
+    const float inv_sum = 1.0 / (sum + 0.0000000001);
+
+    // Convert normalized 3D histogram into image hash (fingerprint).
+    if( hash_size_in_bytes >= ((int)sizeof(float))*bins_per_dimension*bins_per_dimension*bins_per_dimension ) {
+        cimg_forX(hist, x) {
+            hash[x] = inv_sum * hist(x);
+        }
+    }
+    return 1;
+}
+
+
+// Deterministic offset in [0, range) for cell (i, j) of a sampling grid.
+static int jitter(uint32_t i, uint32_t j, int range) {
+    uint32_t h = i * 0x9E3779B1u ^ (j + 0x7F4A7C15u) * 0x85EBCA77u;
+    h ^= h >> 15;
+    h *= 0xC2B2AE3Du;
+    h ^= h >> 13;
+    return (int)(h % (uint32_t)range);
+}
+
+
+// Histogram of an image streamed a row at a time (see compute_image_hash()),
+// bit for bit the same as the in-memory computation.  The bin range depends
+// on the image's maximum value, which is only known at the end, so 16-bit
+// images are binned for both candidate ranges at once.  With a stride above
+// 1, only one pixel, at a jittered position, of each stride x stride cell is
+// counted (stratified sampling), one row per band of stride rows being read
+// and the rest skipped undecoded where the format allows.  groups, if given,
+// gets a row per sample_groups histograms of every sample_groups'th band,
+// for sampling_drift_bound().
+const int sample_groups = 16;
+static int stream_histogram(image_io::ScanlineReader &reader, \
+        int bins_per_dimension, CImg<float> &hist, int stride=1, \
+        CImg<float> *groups=NULL) {
+    const int width = reader.info.width, height = reader.info.height;
+    const bool wide = reader.info.bit_depth > 8;
+    const float max_narrow = 255.0, max_wide = 65535.0;
+    const float inv_narrow = 1.0 / max_narrow, inv_wide = 1.0 / max_wide;
+    const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    CImg<float> hist_wide, groups_wide;
+    hist.assign(bins_per_dimension, bins_per_dimension, bins_per_dimension, 1, 0);
+    if( wide ) {
+        hist_wide.assign(bins_per_dimension, bins_per_dimension, bins_per_dimension, 1, 0);
+    }
+    if( groups != NULL ) {
+        groups->assign(bins, sample_groups, 1, 1, 0);
+        if( wide ) {
+            groups_wide.assign(bins, sample_groups, 1, 1, 0);
+        }
+    }
+
+    std::vector<uint16_t> row((size_t)width * 3);
+    float max_value = 0.0;
+    int retval = 1;
+    for( int band = 0; band * stride < height; band++ ) {
+        const int band_rows = std::min(stride, height - band * stride);
+        const int y = (stride > 1) ? jitter(band, 0, band_rows) : 0;
+        if( (retval = reader.skip_rows(y)) < 0 || \
+                (retval = reader.read_row(&row[0])) < 1 || \
+                (retval = reader.skip_rows(band_rows - 1 - y)) < 0 ) {
+            break;
+        }
+        for( int cell = 0; cell * stride < width; cell++ ) {
+            const int x = cell * stride + ((stride > 1) ? \
+                jitter(band, cell + 1, std::min(stride, width - cell * stride)) : 0);
+            const uint16_t *sample = &row[(size_t)x * 3];
+            int narrow[3], wide_bins[3];
+            for( int c = 0; c < 3; c++ ) {
+                const float val = sample[c];
+                max_value = std::max(max_value, val);
+                narrow[c] = (val == max_narrow) ? bins_per_dimension-1 : \
+                    std::min((int)(val * bins_per_dimension * inv_narrow), \
+                    bins_per_dimension-1);
+                wide_bins[c] = (val == max_wide) ? bins_per_dimension-1 : \
+                    (int)(val * bins_per_dimension * inv_wide);
+            }
+            const int bin = (narrow[0]*bins_per_dimension + narrow[1])*bins_per_dimension + narrow[2];
+            ++hist[bin];
+            if( groups != NULL ) {
+                ++(*groups)(bin, band % sample_groups);
+            }
+            if( wide ) {
+                const int bin_wide = (wide_bins[0]*bins_per_dimension + wide_bins[1])*bins_per_dimension + wide_bins[2];
+                ++hist_wide[bin_wide];
+                if( groups != NULL ) {
+                    ++groups_wide(bin_wide, band % sample_groups);
+                }
+            }
+        }
+    }
+    if( retval < 0 ) {
+        return retval;
+    }
+    if( max_value > 255.1 ) {
+        hist.swap(hist_wide);
+        if( groups != NULL ) {
+            groups->swap(groups_wide);
+        }
+    }
+    return 1;
+}
+
+
+// Chi-square distance (compare_chisquare()) within which, with about 99.9%
+// confidence, a sampled histogram (summed over groups, see stream_histogram())
+// of an image of pixels pixels lies of the full one.  For n independent
+// samples over k occupied bins, 2n times that distance is roughly chi-square
+// distributed with k - 1 degrees of freedom; the Wilson-Hilferty
+// approximation gives its quantile.  Samples sharing a row are not
+// independent (e.g. across horizontal stripes), so the quantile is scaled by
+// the design effect, the ratio of the distance expected from the groups'
+// spread (a random groups variance estimate) to that expected of independent
+// samples, when above 1.
+static double sampling_drift_bound(const CImg<float> &groups, uint64_t pixels) {
+    const int bins = groups.width();
+    std::vector<double> totals(sample_groups, 0.0), p(bins, 0.0);
+    double sampled = 0.0;
+    cimg_forXY(groups, x, g) {
+        totals[g] += groups(x, g);
+        p[x] += groups(x, g);
+        sampled += groups(x, g);
+    }
+    if( sampled == 0.0 || sampled >= pixels ) {
+        return 0.0;
+    }
+    int occupied = 0, used_groups = 0;
+    double expected = 0.0;
+    for( int g = 0; g < sample_groups; g++ ) {
+        used_groups += (totals[g] > 0.0);
+    }
+    for( int x = 0; x < bins; x++ ) {
+        if( p[x] == 0.0 ) {
+            continue;
+        }
+        p[x] /= sampled;
+        occupied++;
+        double spread = 0.0;
+        for( int g = 0; g < sample_groups; g++ ) {
+            if( totals[g] > 0.0 ) {
+                const double d = groups(x, g) / totals[g] - p[x];
+                spread += d * d;
+            }
+        }
+        if( used_groups > 1 ) {
+            expected += spread / (used_groups * (used_groups - 1.0)) / (2.0 * p[x]);
+        }
     }
 
-    // Load original image into CImg structure.
-    CImg<float> original_image(filename);
+    const double df = std::max(occupied - 1, 1), z = 3.09;
+    const double c = 2.0 / (9.0 * df);
+    const double quantile = df * pow(1.0 - c + z * sqrt(c), 3);
+    const double design_effect = expected / (df / (2.0 * sampled));
+    return quantile / (2.0 * sampled) * std::max(design_effect, 1.0) * \
+        (1.0 - sampled / pixels);
+}
+
+
+// Loads an image for histogramming (from data, if given and image_io can),
+// reporting failures as compute_image_hash() does.
+template<typename T>
+static int load_for_histogram(const char *filename, const char *data, \
+        size_t length, const image_io::DecodeOptions &options, \
+        CImg<T> &original_image) {
+    int retval = image_io::error_needs_file;
+    if( data != NULL ) {
+        retval = image_io::load_image(data, length, original_image, options);
+    }
+    if( retval == image_io::error_needs_file ) {
+        retval = image_io::load_image(filename, original_image, options);
+    }
+    if( retval < 1 ) {
+        fprintf(stderr, "compute_image_hash() : Failed to load image file (error %d)!\n", retval);
+        return retval;
+    }
     if( not ((original_image.width() > 0) && \
             (original_image.height() > 0) && \
             (original_image.depth() == 1)) ) {
@@ -39,6 +221,269 @@ int histogroup::compute_image_hash(const char *filename, float* &hash, \
         fprintf(stderr, "compute_image_hash() : Loaded image spectrum != 3, so inappropriate for 3D histogram!\n");
         return -4;
     }
+    return 1;
+}
+
+
+// Counts the bin indices of pixels [start, end) of an 8- or 16-bit image into
+// four interleaved sub-histograms, so that runs of pixels in the same bin
+// don't serialize on one counter.  Bin indices are computed a block at a time
+// (a loop compilers turn into SIMD shifts):  for 8-bit samples and
+// power-of-two bins shift is set, which agrees with bin_of, a table of
+// BINMAP's own float results.  counts has room for 4 sub-histograms.
+template<typename T>
+struct HistogramTile {
+    const CImg<T> *image;
+    size_t start, end;
+    const uint16_t *bin_of;
+    int bins_per_dimension, shift, log2_bins;
+    uint32_t *counts;
+
+    static void *run(void *arg) {
+        HistogramTile *tile = (HistogramTile *)arg;
+        tile->count();
+        return NULL;
+    }
+
+    void count() {
+        const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+        const T *red = image->data(0, 0, 0, 0);
+        const T *green = image->data(0, 0, 0, 1);
+        const T *blue = image->data(0, 0, 0, 2);
+        const size_t block = 1024;
+        uint32_t idx[block];
+        std::fill(counts, counts + 4 * (size_t)bins, 0);
+        for( size_t first = start; first < end; first += block ) {
+            const size_t n = std::min(block, end - first);
+            const T *r = red + first, *g = green + first, *b = blue + first;
+            if( shift >= 0 ) {
+                for( size_t i = 0; i < n; i++ ) {
+                    idx[i] = ((uint32_t)(r[i] >> shift) << (2 * log2_bins)) | \
+                        ((uint32_t)(g[i] >> shift) << log2_bins) | \
+                        (uint32_t)(b[i] >> shift);
+                }
+            } else {
+                for( size_t i = 0; i < n; i++ ) {
+                    idx[i] = (bin_of[r[i]]*bins_per_dimension + bin_of[g[i]])* \
+                        bins_per_dimension + bin_of[b[i]];
+                }
+            }
+            for( size_t i = 0; i < n; i++ ) {
+                ++counts[(i & 3) * bins + idx[i]];
+            }
+        }
+    }
+};
+
+
+// 3D histogram of an 8- or 16-bit image in its native sample type:  a
+// quarter (or half) the memory of a float copy, and no pass for the maximum
+// when the decoder says the samples are 8-bit.  Bit for bit the same as the
+// float computation in compute_image_hash(), counts saturating at 2^24 as
+// float increments do.  Large images are split into bands of rows counted by
+// up to threads threads (0: one per online CPU), each with its own
+// sub-histograms, which are summed at the end.  The bin table and counts are
+// kept in context.
+template<typename T>
+static void native_histogram(const CImg<T> &image, float max_value, \
+        int bins_per_dimension, int threads, CImg<float> &hist, \
+        image_io::ComputeContext &context) {
+    const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    const float inv_range_values = 1.0 / max_value;
+    std::vector<uint16_t> &bin_of = context.table;
+    bin_of.resize((size_t)max_value + 1);
+    for( size_t v = 0; v < bin_of.size(); v++ ) {
+        const float val = v;
+        bin_of[v] = (val == max_value) ? bins_per_dimension-1 : \
+            (int)(val * bins_per_dimension * inv_range_values);
+    }
+    int shift = 8, log2_bins = 0;
+    while( (1 << log2_bins) < bins_per_dimension ) {
+        ++log2_bins;
+        --shift;
+    }
+    if( max_value != 255.0 || (1 << log2_bins) != bins_per_dimension ) {
+        shift = -1;
+    }
+
+    const size_t pixels = (size_t)image.width() * image.height();
+    if( threads <= 0 ) {
+        threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    threads = (int)std::min((size_t)std::max(threads, 1), \
+        std::max(pixels / histogroup::pixels_per_histogram_thread, (size_t)1));
+    const size_t rows_per_tile = (image.height() + threads - 1) / threads;
+
+    if( context.counts.size() < (size_t)threads * 4 * bins ) {
+        context.counts.resize((size_t)threads * 4 * bins);
+    }
+    std::vector< HistogramTile<T> > tiles(threads);
+    std::vector<pthread_t> ids(threads);
+    std::vector<bool> started(threads, false);
+    for( int t = 0; t < threads; t++ ) {
+        HistogramTile<T> &tile = tiles[t];
+        tile.image = &image;
+        tile.start = std::min(t * rows_per_tile, (size_t)image.height()) * image.width();
+        tile.end = std::min((t + 1) * rows_per_tile, (size_t)image.height()) * image.width();
+        tile.bin_of = &bin_of[0];
+        tile.bins_per_dimension = bins_per_dimension;
+        tile.shift = shift;
+        tile.log2_bins = log2_bins;
+        tile.counts = &context.counts[(size_t)t * 4 * bins];
+        // The calling thread takes the first tile, and any a thread can't
+        // be started for.
+        started[t] = (t > 0) && \
+            pthread_create(&ids[t], NULL, HistogramTile<T>::run, &tile) == 0;
+    }
+    for( int t = 0; t < threads; t++ ) {
+        if( not started[t] ) {
+            tiles[t].count();
+        }
+    }
+    for( int t = 0; t < threads; t++ ) {
+        if( started[t] ) {
+            pthread_join(ids[t], NULL);
+        }
+    }
+
+    hist.assign(bins_per_dimension, bins_per_dimension, bins_per_dimension, 1, 0);
+    for( int x = 0; x < bins; x++ ) {
+        uint32_t count = 0;
+        for( int t = 0; t < threads; t++ ) {
+            const uint32_t *counts = tiles[t].counts;
+            count += counts[x] + counts[bins + x] + counts[2*bins + x] + \
+                counts[3*bins + x];
+        }
+        hist[x] = (float)std::min(count, (uint32_t)1 << 24);
+    }
+}
+
+
+int histogroup::compute_image_hash(const char *filename, float* &hash, \
+        int hash_size_in_bytes, int bins_per_dimension, \
+        const image_io::DecodeOptions &options, int threads, \
+        uint64_t sample_budget, double *drift_bound) {
+    return compute_image_hash(filename, NULL, 0, hash, hash_size_in_bytes, \
+        bins_per_dimension, options, threads, sample_budget, drift_bound);
+}
+
+
+int histogroup::compute_image_hash(const char *filename, const char *data, \
+        size_t length, float* &hash, int hash_size_in_bytes, \
+        int bins_per_dimension, const image_io::DecodeOptions &options, \
+        int threads, uint64_t sample_budget, double *drift_bound) {
+    // Input sanity check.
+    if( filename == NULL ) {
+        fprintf(stderr, "compute_image_hash() : Must supply filename != NULL.\n");
+        return -1;
+    }
+    if( bins_per_dimension < 2 ) {
+        fprintf(stderr, "compute_image_hash() : Must request 2 or more bins per dim!\n");
+        return -2;
+    }
+
+    if( drift_bound != NULL ) {
+        *drift_bound = 0.0;
+    }
+
+    // Images of more than sample_budget pixels are histogrammed from about
+    // that many, spread evenly over the image (see stream_histogram()).
+    image_io::ImageInfo info;
+    int retval;
+    if( sample_budget > 0 && \
+            image_io::probe_decoded(filename, options, info) == image_io::load_ok && \
+            (uint64_t)info.width * info.height > sample_budget ) {
+        image_io::ScanlineReader reader;
+        CImg<float> hist, groups;
+        uint64_t pixels = 0;
+        retval = reader.open(filename, options);
+        if( retval == image_io::load_ok && reader.info.channels != 3 ) {
+            fprintf(stderr, "compute_image_hash() : Loaded image spectrum != 3, so inappropriate for 3D histogram!\n");
+            return -4;
+        }
+        if( retval == image_io::load_ok ) {
+            pixels = (uint64_t)reader.info.width * reader.info.height;
+            const int stride = (int)ceil(sqrt((double)pixels / sample_budget));
+            retval = stream_histogram(reader, bins_per_dimension, hist, \
+                std::max(stride, 1), &groups);
+        }
+        // Layouts the reader can't stream are computed in full below.
+        if( retval != image_io::error_not_streamable ) {
+            if( retval < 1 ) {
+                fprintf(stderr, "compute_image_hash() : Failed to load image file (error %d)!\n", retval);
+                return retval;
+            }
+            if( drift_bound != NULL ) {
+                *drift_bound = sampling_drift_bound(groups, pixels);
+            }
+            return histogram_to_hash(hist, hash, hash_size_in_bytes, bins_per_dimension);
+        }
+    }
+
+    // Images whose float decode would exceed memory_cap are streamed instead.
+    if( options.memory_cap > 0 && \
+            (retval = image_io::probe_decoded(filename, options, \
+                info)) == image_io::load_ok && \
+            image_io::decoded_size(info, sizeof(float)) > options.memory_cap ) {
+        image_io::ScanlineReader reader;
+        CImg<float> hist;
+        retval = reader.open(filename, options);
+        if( retval == image_io::load_ok && reader.info.channels != 3 ) {
+            fprintf(stderr, "compute_image_hash() : Loaded image spectrum != 3, so inappropriate for 3D histogram!\n");
+            return -4;
+        }
+        if( retval == image_io::load_ok ) {
+            retval = stream_histogram(reader, bins_per_dimension, hist);
+        }
+        if( retval < 1 ) {
+            fprintf(stderr, "compute_image_hash() : Failed to load image file (error %d)!\n", retval);
+            return retval;
+        }
+        return histogram_to_hash(hist, hash, hash_size_in_bytes, bins_per_dimension);
+    }
+
+    // 8- and 16-bit images (as the decoder reports them) are histogrammed
+    // natively; deeper ones go through float below.
+    // Decoded images and the histogram live in the thread's context, and so
+    // keep their buffers from one image of a given size to the next.
+    image_io::ComputeContext &context = image_io::thread_compute_context();
+    // (probe_decoded() differs from probe_image() only for previews.)
+    retval = (data != NULL && options.preview_min_dim <= 0) ? \
+        image_io::probe_image(data, length, info) : \
+        image_io::probe_decoded(filename, options, info);
+    if( retval == image_io::load_ok && info.bit_depth <= 16 ) {
+        CImg<float> &hist = context.floats(context_histogram);
+        if( info.bit_depth <= 8 ) {
+            CImg<uint8_t> &original_image = context.bytes(context_original);
+            retval = load_for_histogram(filename, data, length, options, \
+                original_image);
+            if( retval < 1 ) {
+                return retval;
+            }
+            native_histogram(original_image, 255.0, bins_per_dimension, threads, \
+                hist, context);
+        } else {
+            CImg<uint16_t> &original_image = context.words(context_original);
+            retval = load_for_histogram(filename, data, length, options, \
+                original_image);
+            if( retval < 1 ) {
+                return retval;
+            }
+            const float max_value = (original_image.max() > 255) ? 65535.0 : 255.0;
+            native_histogram(original_image, max_value, bins_per_dimension, \
+                threads, hist, context);
+        }
+        context.trim();
+        return histogram_to_hash(hist, hash, hash_size_in_bytes, bins_per_dimension);
+    }
+
+    // Load original image into CImg structure (format detected by content).
+    CImg<float> &original_image = context.floats(context_original);
+    retval = load_for_histogram(filename, data, length, options, \
+        original_image);
+    if( retval < 1 ) {
+        return retval;
+    }
 
     // Standardize the contrast in the image by normalizing it.  TODO: Good idea?  Use observed max/min?
     //original_image.normalize(0.0, 255.0);
@@ -62,7 +507,8 @@ int histogroup::compute_image_hash(const char *filename, float* &hash, \
     }
     //printf("DBG: min, max= %f, %f\n", min_value, max_value);
     const float inv_range_values = 1.0 / (max_value - min_value);
-    CImg<float> hist(bins_per_dimension, bins_per_dimension, bins_per_dimension, 1, 0);
+    CImg<float> &hist = context.floats(context_histogram);
+    hist.assign(bins_per_dimension, bins_per_dimension, bins_per_dimension, 1, 0);
     long count = 0;
 #define NONZEROMINBINMAP(val) (val == max_value ? bins_per_dimension-1 : (int)((val - min_value) * bins_per_dimension * inv_range_values))
 #define BINMAP(val) (val == max_value ? bins_per_dimension-1 : (int)(val * bins_per_dimension * inv_range_values))
@@ -80,23 +526,8 @@ int histogroup::compute_image_hash(const char *filename, float* &hash, \
     hist.save_png("temp.hist.png");
 #endif
 
-    // Change representation of hist to simplify code in next steps.
-    hist.unroll('x');
-
-    // Compute sum for normalizing histogram during next step.
-    float sum = 0.0;
-    cimg_forX(hist, x) {
-        sum += hist(x);
-    }
-    const float inv_sum = 1.0 / (sum + 0.0000000001);
-
-    // Convert normalized 3D histogram into image hash (fingerprint).
-    if( hash_size_in_bytes >= ((int)sizeof(float))*bins_per_dimension*bins_per_dimension*bins_per_dimension ) {
-        cimg_forX(hist, x) {
-            hash[x] = inv_sum * hist(x);
-        }
-    }
-    return 1;
+    context.trim();
+    return histogram_to_hash(hist, hash, hash_size_in_bytes, bins_per_dimension);
 }
 
 
@@ -116,31 +547,90 @@ double histogroup::compare_chisquare(float *hash_1, float *hash_2,
 }
 
 
-int histogroup::read_hash_from_text(char *text, float* &hash, int hash_size_in_bytes) {
+// Compares hash with a block of lanes fingerprints, one per lane, so the
+// divides of all lanes issue together (compilers vectorize the lane loops);
+// each lane still sums its fingerprint's bins in compare_chisquare()'s order
+// and precision, so distances are identical to it.  After every
+// check_bins bins, stops once every lane's partial sum exceeds cutoff.
+static const int compare_lanes = 8;
+static void chisquare_block(const float *hash, const float *hashes, \
+        int bins, double cutoff, double *distances) {
+    const int check_bins = 8;
+    float sum[compare_lanes] = { 0.0f };
+    for( int bin = 0; bin < bins; bin++ ) {
+        for( int lane = 0; lane < compare_lanes; lane++ ) {
+            const float a = hash[bin];
+            const float b = hashes[lane * bins + bin];
+            sum[lane] += (a - b) * (a - b) / (a + b + 0.0000000001);
+        }
+        if( (bin + 1) % check_bins == 0 ) {
+            bool all_over = true;
+            for( int lane = 0; lane < compare_lanes; lane++ ) {
+                all_over = all_over && (sum[lane] > cutoff);
+            }
+            if( all_over ) {
+                break;
+            }
+        }
+    }
+    for( int lane = 0; lane < compare_lanes; lane++ ) {
+        distances[lane] = sum[lane];
+    }
+}
 
-    // Read first block of hash data, accommodating irregular leading spaces.
-    hash[0] = (float)atof(text);
-    int shift = 0;
-    while( (text[shift] == ' ') && (shift < 9) ) {
-        ++shift;
+
+int histogroup::compare_chisquare_many(const float *hash, \
+        const float *hashes, int count, int bins_per_dimension, \
+        double *distances, double cutoff) {
+    if( hash == NULL || hashes == NULL || distances == NULL || count < 0 || \
+            bins_per_dimension < 1 ) {
+        return -1;
     }
-    while( (text[shift] != ' ') && (shift < 9) ) {
-        ++shift;
+
+    const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    int index = 0;
+    for( ; index + compare_lanes <= count; index += compare_lanes ) {
+        chisquare_block(hash, hashes + (size_t)index * bins, bins, cutoff, \
+            distances + index);
+    }
+    if( index < count ) {
+        // Pad the last block with copies of its last fingerprint.
+        std::vector<float> block((size_t)compare_lanes * bins);
+        double block_distances[compare_lanes];
+        for( int lane = 0; lane < compare_lanes; lane++ ) {
+            const int source = std::min(index + lane, count - 1);
+            std::copy(hashes + (size_t)source * bins, \
+                hashes + (size_t)(source + 1) * bins, &block[lane * bins]);
+        }
+        chisquare_block(hash, &block[0], bins, cutoff, block_distances);
+        std::copy(block_distances, block_distances + (count - index), \
+            distances + index);
     }
 
-    // Read hash data (expected "%9.7f " repeated format for float blocks).
-    char *cptr = text + shift;
-    int index = 1, stop_index = hash_size_in_bytes/sizeof(float);
-    while( (cptr != NULL) && (index < stop_index) ) {
-        hash[index] = (float)atof(cptr);
-        ++index;
-        cptr = strchr(cptr+9, ' ');
+    int within = 0;
+    for( index = 0; index < count; index++ ) {
+        within += (distances[index] <= cutoff);
     }
+    return within;
+}
 
-    // Basic validation.
-    if( (cptr == NULL) && (index < stop_index) ) {
-        puts("Warning: read_hash_from_text read shorter than expected hash text");
-        return 0;
+
+int histogroup::coarsen_hash(const float *hash, int bins_per_dimension, \
+        float *coarse) {
+    if( hash == NULL || coarse == NULL || bins_per_dimension < 2 || \
+            bins_per_dimension % 2 != 0 ) {
+        return -1;
+    }
+
+    const int fine = bins_per_dimension, half = bins_per_dimension / 2;
+    std::fill(coarse, coarse + half * half * half, 0.0f);
+    for( int i = 0; i < fine; i++ ) {
+        for( int j = 0; j < fine; j++ ) {
+            for( int k = 0; k < fine; k++ ) {
+                coarse[((i/2)*half + j/2)*half + k/2] += \
+                    hash[(i*fine + j)*fine + k];
+            }
+        }
     }
 
     // Success.
@@ -148,39 +638,1567 @@ int histogroup::read_hash_from_text(char *text, float* &hash, int hash_size_in_b
 }
 
 
+int histogroup::embed_hash(const float *hash, int bins_per_dimension, \
+        float *embedding) {
+    if( hash == NULL || embedding == NULL || bins_per_dimension < 1 ) {
+        return -1;
+    }
+    const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    for( int index = 0; index < bins; index++ ) {
+        embedding[index] = sqrtf(std::max(hash[index], 0.0f));
+    }
 
-// class histogroup::Fingerprint
+    // Success.
+    return 1;
+}
 
-histogroup::Fingerprint::Fingerprint(int hash_size_in_bins_per_dimension) {
-	bins_per_band = hash_size_in_bins_per_dimension;
-    size_in_bytes = bins_per_band * bins_per_band * bins_per_band * sizeof(float);
-    contents = (float*)malloc(size_in_bytes);
+
+double histogroup::embedding_distance(const float *embedding_1, \
+        const float *embedding_2, int bins_per_dimension) {
+    const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    float sum = 0.0f;
+    for( int index = 0; index < bins; index++ ) {
+        const float d = embedding_1[index] - embedding_2[index];
+        sum += d * d;
+    }
+    return sqrt(sum);
 }
 
 
-histogroup::Fingerprint::~Fingerprint() {
-    if(contents != NULL) {
-        free(contents);
+// Quantized fingerprint layout:  one value per bin, in the order of the float
+// fingerprint, q = round(sqrt(frequency) * (2**bits - 1)) as uint8 (bits 8)
+// or little-endian uint16 (bits 16), with no header.  The square root spends
+// the levels where chi-square is most sensitive, on small frequencies:  with
+// 8 bits a bin needs only 1.5e-5 of the pixels to stay nonzero.
+
+int histogroup::quantize_hash(const float *hash, int bins_per_dimension, \
+        int bits, std::string &blob) {
+    if( hash == NULL || bins_per_dimension < 2 || (bits != 8 && bits != 16) ) {
+        return -1;
+    }
+
+    const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    const float scale = (bits == 8) ? 255.0f : 65535.0f;
+    blob.resize((bits / 8) * bins);
+    uint8_t *out = (uint8_t*)&blob[0];
+    for( int index=0; index < bins; index++ ) {
+        const float frequency = std::min(std::max(hash[index], 0.0f), 1.0f);
+        const unsigned value = (unsigned)(sqrtf(frequency) * scale + 0.5f);
+        if( bits == 8 ) {
+            out[index] = value;
+        } else {
+            out[2*index] = value & 0xFF;
+            out[2*index+1] = (value >> 8) & 0xFF;
+        }
     }
+
+    // Success.
+    return 1;
 }
 
 
-std::vector<float> histogroup::Fingerprint::as_float_array() {
-    std::vector<float> values (contents, contents+(size_in_bytes/sizeof(float)));
-    return values;
+// Returns the bits per value of a quantized fingerprint, from its size.
+static int quantized_bits(const std::string &blob, int bins_per_dimension) {
+    const size_t bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    if( blob.size() == bins ) {
+        return 8;
+    } else if( blob.size() == 2*bins ) {
+        return 16;
+    }
+    return 0;
 }
 
 
-void histogroup::Fingerprint::set_from_float_array(const std::vector<float>& values) {
-    // Expects a bins_per_band**3 element vector, in the style created by ::as_float_array().
-    size_t count = std::min((size_t)size_in_bytes/sizeof(float), values.size());
-    std::copy (values.begin(), values.begin()+count, contents);
+int histogroup::dequantize_hash(const std::string &blob, \
+        int bins_per_dimension, float* &hash) {
+    const int bits = quantized_bits(blob, bins_per_dimension);
+    if( hash == NULL || bits == 0 ) {
+        return -1;
+    }
+
+    const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    const float inv_scale = 1.0f / ((bits == 8) ? 255.0f : 65535.0f);
+    const uint8_t *in = (const uint8_t*)blob.data();
+    for( int index=0; index < bins; index++ ) {
+        const float value = (bits == 8) ? in[index] : \
+            (in[2*index] | (in[2*index+1] << 8));
+        hash[index] = (value * inv_scale) * (value * inv_scale);
+    }
+
+    // Success.
+    return 1;
+}
+
+
+// Chi-square distance between quantized fingerprints, computed from the
+// quantized values without dequantizing:  with frequencies a = (q_a/scale)**2,
+// (a - b)**2 / (a + b) = ((q_a - q_b)(q_a + q_b))**2 / (q_a**2 + q_b**2) / scale**2.
+// For 8-bit values every product up to the last square is exact in float.
+// Eight partial sums, one per lane, let compilers keep the loop in SIMD
+// registers without reassociating the sum.
+template<typename T>
+static double chisquare_quantized(const T *hash_1, const T *hash_2, int bins, \
+        float scale) {
+    const int lanes = 8;
+    float partial[lanes] = { 0.0f };
+    int index = 0;
+    for( ; index + lanes <= bins; index += lanes ) {
+        for( int lane=0; lane < lanes; lane++ ) {
+            const float a = hash_1[index + lane], b = hash_2[index + lane];
+            const float d = (a - b) * (a + b);
+            partial[lane] += d * d / (a * a + b * b + 1e-10f);
+        }
+    }
+    for( ; index < bins; index++ ) {
+        const float a = hash_1[index], b = hash_2[index];
+        const float d = (a - b) * (a + b);
+        partial[0] += d * d / (a * a + b * b + 1e-10f);
+    }
+    float sum = 0.0f;
+    for( int lane=0; lane < lanes; lane++ ) {
+        sum += partial[lane];
+    }
+    return sum / (scale * scale);
+}
+
+
+double histogroup::compare_chisquare_quantized(const uint8_t *hash_1, \
+        const uint8_t *hash_2, int bins_per_dimension) {
+    return chisquare_quantized(hash_1, hash_2, \
+        bins_per_dimension * bins_per_dimension * bins_per_dimension, 255.0f);
+}
+
+
+double histogroup::compare_chisquare_quantized(const uint16_t *hash_1, \
+        const uint16_t *hash_2, int bins_per_dimension) {
+    return chisquare_quantized(hash_1, hash_2, \
+        bins_per_dimension * bins_per_dimension * bins_per_dimension, 65535.0f);
+}
+
+
+// The distance compare_quantized() returns.
+static double quantized_distance(const std::string &blob_1, \
+        const std::string &blob_2, int bins_per_dimension) {
+    const int bits = quantized_bits(blob_1, bins_per_dimension);
+    if( bits == 0 || quantized_bits(blob_2, bins_per_dimension) != bits ) {
+        return -1.0;
+    }
+    if( bits == 8 ) {
+        return histogroup::compare_chisquare_quantized((const uint8_t*)blob_1.data(), \
+            (const uint8_t*)blob_2.data(), bins_per_dimension);
+    }
+    // Little-endian uint16 values, copied out to be aligned.
+    const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    std::vector<uint16_t> values_1(bins), values_2(bins);
+    const uint8_t *in_1 = (const uint8_t*)blob_1.data();
+    const uint8_t *in_2 = (const uint8_t*)blob_2.data();
+    for( int index=0; index < bins; index++ ) {
+        values_1[index] = in_1[2*index] | (in_1[2*index+1] << 8);
+        values_2[index] = in_2[2*index] | (in_2[2*index+1] << 8);
+    }
+    return histogroup::compare_chisquare_quantized(&values_1[0], &values_2[0], \
+        bins_per_dimension);
+}
+
+
+// compare_quantized() as run by image_io::run_blocking(), on copies of the
+// fingerprints, which a Ruby caller may otherwise change while the GVL is
+// released.
+struct QuantizedComparison {
+    std::string blob_1, blob_2;
+    int bins_per_dimension;
+    double distance;
+
+    static void *run(void *comparison) {
+        QuantizedComparison *self = (QuantizedComparison*)comparison;
+        self->distance = quantized_distance(self->blob_1, self->blob_2, \
+            self->bins_per_dimension);
+        return NULL;
+    }
+};
+
+
+double histogroup::compare_quantized(const std::string &blob_1, \
+        const std::string &blob_2, int bins_per_dimension) {
+    QuantizedComparison comparison;
+    comparison.blob_1 = blob_1;
+    comparison.blob_2 = blob_2;
+    comparison.bins_per_dimension = bins_per_dimension;
+    comparison.distance = -1.0;
+    image_io::run_blocking(QuantizedComparison::run, &comparison);
+    return comparison.distance;
 }
 
 
+// Distances from the quantized fingerprint query to each of those of its
+// size packed back to back in packed, for compare_many() and match_many().
+static std::vector<double> packed_distances(const char *query, size_t length, \
+        const char *packed, size_t packed_length, int bins_per_dimension) {
+    const int bins = bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    const int bits = (bins_per_dimension < 2) ? 0 : \
+        ((length == (size_t)bins) ? 8 : ((length == 2 * (size_t)bins) ? 16 : 0));
+    if( bits == 0 || packed_length % length != 0 ) {
+        throw CImgArgumentException("histogroup::compare_many quantized fingerprints of other sizes.\n");
+    }
+
+    const size_t count = packed_length / length;
+    std::vector<double> distances(count);
+    if( bits == 8 ) {
+        for( size_t index=0; index < count; index++ ) {
+            distances[index] = histogroup::compare_chisquare_quantized( \
+                (const uint8_t*)query, (const uint8_t*)packed + index * length, \
+                bins_per_dimension);
+        }
+        return distances;
+    }
+
+    // Little-endian uint16 values, copied out to be aligned.
+    std::vector<uint16_t> values_1(bins), values_2(bins);
+    const uint8_t *in_1 = (const uint8_t*)query;
+    for( int bin=0; bin < bins; bin++ ) {
+        values_1[bin] = in_1[2*bin] | (in_1[2*bin+1] << 8);
+    }
+    for( size_t index=0; index < count; index++ ) {
+        const uint8_t *in_2 = (const uint8_t*)packed + index * length;
+        for( int bin=0; bin < bins; bin++ ) {
+            values_2[bin] = in_2[2*bin] | (in_2[2*bin+1] << 8);
+        }
+        distances[index] = histogroup::compare_chisquare_quantized( \
+            &values_1[0], &values_2[0], bins_per_dimension);
+    }
+    return distances;
+}
+
+
+// packed_distances() as run by image_io::run_blocking(), on its own copy of
+// the bytes (see QuantizedComparison).
+struct PackedComparison {
+    std::string query, packed;
+    int bins_per_dimension;
+    std::vector<double> distances;
+
+    static void *run(void *comparison) {
+        PackedComparison *self = (PackedComparison*)comparison;
+        self->distances = packed_distances(self->query.data(), \
+            self->query.size(), self->packed.data(), self->packed.size(), \
+            self->bins_per_dimension);
+        return NULL;
+    }
+};
+
+
+static std::vector<double> compare_packed(const char *query, size_t length, \
+        const char *packed, size_t packed_length, int bins_per_dimension) {
+    PackedComparison comparison;
+    comparison.query.assign(query, length);
+    comparison.packed.assign(packed, packed_length);
+    comparison.bins_per_dimension = bins_per_dimension;
+    image_io::run_blocking(PackedComparison::run, &comparison);
+    return comparison.distances;
+}
+
+
+std::string histogroup::compare_many(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2, int bins_per_dimension) {
+    const std::vector<double> distances = compare_packed(bytes_1, length_1, \
+        bytes_2, length_2, bins_per_dimension);
+    std::string packed(4 * distances.size(), '\0');
+    for( size_t index=0; index < distances.size(); index++ ) {
+        const float distance = (float)distances[index];
+        uint32_t bits;
+        memcpy(&bits, &distance, sizeof(bits));
+        for( int shift=0; shift < 4; shift++ ) {
+            packed[4*index + shift] = (char)((bits >> (8*shift)) & 0xFF);
+        }
+    }
+    return packed;
+}
+
+
+std::vector<int> histogroup::match_many(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2, int bins_per_dimension, \
+        double cutoff, int limit) {
+    const std::vector<double> distances = compare_packed(bytes_1, length_1, \
+        bytes_2, length_2, bins_per_dimension);
+
+    // Distances of the matches, paired with their indices to break ties.
+    std::vector< std::pair<double,int> > matches;
+    for( size_t index=0; index < distances.size(); index++ ) {
+        if( distances[index] <= cutoff ) {
+            matches.push_back(std::make_pair(distances[index], (int)index));
+        }
+    }
+    if( limit > 0 && limit < (int)matches.size() ) {
+        std::partial_sort(matches.begin(), matches.begin() + limit, matches.end());
+        matches.resize(limit);
+    } else {
+        std::sort(matches.begin(), matches.end());
+    }
+
+    std::vector<int> indices(matches.size());
+    for( size_t match=0; match < matches.size(); match++ ) {
+        indices[match] = matches[match].second;
+    }
+    return indices;
+}
+
+
+// Little-endian float32s, copied out to be aligned.
+static std::vector<float> unpack_floats(const char *bytes, size_t length) {
+    std::vector<float> values(length / 4);
+    const uint8_t *in = (const uint8_t*)bytes;
+    for( size_t index=0; index < values.size(); index++ ) {
+        const uint32_t bits = in[4*index] | (in[4*index+1] << 8) | \
+            (in[4*index+2] << 16) | ((uint32_t)in[4*index+3] << 24);
+        memcpy(&values[index], &bits, sizeof(bits));
+    }
+    return values;
+}
+
+
+// compare_chisquare_many() on unpacked fingerprints, as run by
+// image_io::run_blocking().
+struct ChisquareComparison {
+    std::vector<float> hash, hashes;
+    int bins_per_dimension;
+    double cutoff;
+    std::vector<double> distances;
+
+    static void *run(void *comparison) {
+        ChisquareComparison *self = (ChisquareComparison*)comparison;
+        const int bins = self->bins_per_dimension * \
+            self->bins_per_dimension * self->bins_per_dimension;
+        self->distances.resize(self->hashes.size() / bins);
+        if( not self->distances.empty() ) {
+            histogroup::compare_chisquare_many(&self->hash[0], \
+                &self->hashes[0], (int)self->distances.size(), \
+                self->bins_per_dimension, &self->distances[0], self->cutoff);
+        }
+        return NULL;
+    }
+};
+
+
+std::string histogroup::compare_chisquare_many(const char *bytes_1, \
+        size_t length_1, const char *bytes_2, size_t length_2, \
+        int bins_per_dimension, double cutoff) {
+    const size_t bins = (bins_per_dimension < 1) ? 0 : \
+        (size_t)bins_per_dimension * bins_per_dimension * bins_per_dimension;
+    if( bins == 0 || length_1 != 4 * bins || length_2 % length_1 != 0 ) {
+        throw CImgArgumentException("histogroup::compare_chisquare_many fingerprints of other sizes.\n");
+    }
+
+    ChisquareComparison comparison;
+    comparison.hash = unpack_floats(bytes_1, length_1);
+    comparison.hashes = unpack_floats(bytes_2, length_2);
+    comparison.bins_per_dimension = bins_per_dimension;
+    comparison.cutoff = cutoff;
+    image_io::run_blocking(ChisquareComparison::run, &comparison);
+
+    std::string packed(8 * comparison.distances.size(), '\0');
+    for( size_t index=0; index < comparison.distances.size(); index++ ) {
+        uint64_t bits;
+        memcpy(&bits, &comparison.distances[index], sizeof(bits));
+        for( int shift=0; shift < 8; shift++ ) {
+            packed[8*index + shift] = (char)((bits >> (8*shift)) & 0xFF);
+        }
+    }
+    return packed;
+}
+
+
+int histogroup::read_hash_from_text(char *text, float* &hash, int hash_size_in_bytes) {
+
+    // Read first block of hash data, accommodating irregular leading spaces.
+    hash[0] = (float)atof(text);
+    int shift = 0;
+    while( (text[shift] == ' ') && (shift < 9) ) {
+        ++shift;
+    }
+    while( (text[shift] != ' ') && (shift < 9) ) {
+        ++shift;
+    }
+
+    // Read hash data (expected "%9.7f " repeated format for float blocks).
+    char *cptr = text + shift;
+    int index = 1, stop_index = hash_size_in_bytes/sizeof(float);
+    while( (cptr != NULL) && (index < stop_index) ) {
+        hash[index] = (float)atof(cptr);
+        ++index;
+        cptr = strchr(cptr+9, ' ');
+    }
+
+    // Basic validation.
+    if( (cptr == NULL) && (index < stop_index) ) {
+        puts("Warning: read_hash_from_text read shorter than expected hash text");
+        return 0;
+    }
+
+    // Success.
+    return 1;
+}
+
+
+
+// class histogroup::SharedMutex
+
+histogroup::SharedMutex::SharedMutex() {
+    pthread_rwlock_init(&rwlock, NULL);
+}
+
+
+histogroup::SharedMutex::SharedMutex(const SharedMutex &) {
+    pthread_rwlock_init(&rwlock, NULL);
+}
+
+
+histogroup::SharedMutex &histogroup::SharedMutex::operator=(const SharedMutex &) {
+    return *this;
+}
+
+
+histogroup::SharedMutex::~SharedMutex() {
+    pthread_rwlock_destroy(&rwlock);
+}
+
+
+void histogroup::SharedMutex::lock(bool shared) const {
+    if( shared ) {
+        pthread_rwlock_rdlock(&rwlock);
+    } else {
+        pthread_rwlock_wrlock(&rwlock);
+    }
+}
+
+
+void histogroup::SharedMutex::unlock() const {
+    pthread_rwlock_unlock(&rwlock);
+}
+
+
+histogroup::ScopedLock::ScopedLock(const SharedMutex &mutex, bool shared) : \
+        mutex(mutex) {
+    mutex.lock(shared);
+}
+
+
+histogroup::ScopedLock::~ScopedLock() {
+    mutex.unlock();
+}
+
+
+
+// class histogroup::Index
+
+// Merging bins can only shrink compare_chisquare()'s distance (it is an
+// f-divergence), so a coarse distance above the cutoff rules a fingerprint
+// out without reading it; coarse_slack covers float rounding in the sums.
+static const double coarse_slack = 1.0e-5;
+
+// Embedding distances are bounded via float sums; pivot_slack covers their
+// rounding.
+static const double pivot_slack = 1.0e-5;
+
+histogroup::Index::Index(int hash_size_in_bins_per_dimension, bool screen, \
+        int pivots) {
+    bins_per_band = hash_size_in_bins_per_dimension;
+    coarse_bins_per_band = (screen && bins_per_band % 2 == 0) ? \
+        bins_per_band / 2 : 0;
+    this->pivots = std::max(pivots, 0);
+    verified = 0;
+    sorted = 0;
+    pivots_chosen_at = 0;
+}
+
+
+// Index::add_hash() as run by image_io::run_blocking(), which also waits
+// out any search holding the index.
+struct IndexAddition {
+    histogroup::Index *index;
+    const float *hash;
+    int id;
+
+    static void *run(void *addition) {
+        IndexAddition *self = (IndexAddition*)addition;
+        self->id = self->index->add_hash(self->hash);
+        return NULL;
+    }
+};
+
+
+int histogroup::Index::add(Fingerprint *fingerprint) {
+    if( fingerprint == NULL || fingerprint->bins_per_band != bins_per_band ) {
+        throw CImgArgumentException("histogroup::Index::add fingerprint of another size.\n");
+    }
+    IndexAddition addition;
+    addition.index = this;
+    addition.hash = fingerprint->contents;
+    addition.id = -1;
+    image_io::run_blocking(IndexAddition::run, &addition);
+    return addition.id;
+}
+
+
+int histogroup::Index::add_hash(const float *hash) {
+    ScopedLock lock(mutex, false);
+    const int bins = bins_per_band * bins_per_band * bins_per_band;
+    hashes.insert(hashes.end(), hash, hash + bins);
+    if( coarse_bins_per_band > 0 ) {
+        const int coarse_bins = bins / 8;
+        coarse_hashes.resize(coarse_hashes.size() + coarse_bins);
+        coarsen_hash(hash, bins_per_band, \
+            &coarse_hashes[coarse_hashes.size() - coarse_bins]);
+    }
+    if( pivots > 0 ) {
+        embeddings.resize(embeddings.size() + bins);
+        const float *embedding = &embeddings[embeddings.size() - bins];
+        embed_hash(hash, bins_per_band, (float*)embedding);
+        // Fingerprints added after the pivots were chosen are placed now.
+        for( size_t p = 0; p < pivot_ids.size(); p++ ) {
+            pivot_distances.push_back(embedding_distance(embedding, \
+                &embeddings[(size_t)pivot_ids[p] * bins], bins_per_band));
+        }
+    }
+    return size() - 1;
+}
+
+
+// Farthest-first traversal from the first fingerprint:  each pivot is the
+// fingerprint farthest from those already chosen.
+void histogroup::Index::choose_pivots() {
+    const int count = size();
+    const int bins = bins_per_band * bins_per_band * bins_per_band;
+    const int chosen = std::min(pivots, count);
+    std::vector<float> nearest(count, HUGE_VALF);
+    pivot_ids.clear();
+    pivot_distances.assign((size_t)count * chosen, 0.0f);
+    int next = 0;
+    for( int p = 0; p < chosen; p++ ) {
+        pivot_ids.push_back(next);
+        const float *pivot = &embeddings[(size_t)next * bins];
+        int farthest = 0;
+        for( int id = 0; id < count; id++ ) {
+            const float d = embedding_distance(&embeddings[(size_t)id * bins], \
+                pivot, bins_per_band);
+            pivot_distances[(size_t)id * chosen + p] = d;
+            nearest[id] = std::min(nearest[id], d);
+            if( nearest[id] > nearest[farthest] ) {
+                farthest = id;
+            }
+        }
+        next = farthest;
+    }
+    pivots_chosen_at = count;
+    sort_by_pivots();
+}
+
+
+// Orders ids by their distance to one pivot, given as distances (a column
+// of the pivot distance table) or as a plain value.
+struct PivotOrder {
+    const float *distances;
+    size_t stride;
+    bool operator()(int id_1, int id_2) const {
+        return distances[id_1 * stride] < distances[id_2 * stride];
+    }
+    bool operator()(int id, float distance) const {
+        return distances[id * stride] < distance;
+    }
+    bool operator()(float distance, int id) const {
+        return distance < distances[id * stride];
+    }
+};
+
+
+void histogroup::Index::sort_by_pivots() {
+    const int chosen = (int)pivot_ids.size();
+    sorted = size();
+    by_pivot.resize((size_t)chosen * sorted);
+    for( int p = 0; p < chosen; p++ ) {
+        PivotOrder order = { &pivot_distances[p], (size_t)chosen };
+        int *ids = &by_pivot[(size_t)p * sorted];
+        for( int id = 0; id < sorted; id++ ) {
+            ids[id] = id;
+        }
+        std::sort(ids, ids + sorted, order);
+    }
+}
+
+
+void histogroup::Index::prepare() {
+    ScopedLock lock(mutex, false);
+    if( pivots == 0 || size() == 0 ) {
+        return;
+    }
+    if( pivot_ids.empty() || size() >= 2 * pivots_chosen_at ) {
+        choose_pivots();
+    } else if( size() - sorted > size() / 16 ) {
+        sort_by_pivots();
+    }
+}
+
+
+// Ids, in order, of fingerprints the pivots can't rule out.
+int histogroup::Index::search_pivots(const float *hash, double cutoff, \
+        std::vector<int> &candidates) const {
+    const int bins = bins_per_band * bins_per_band * bins_per_band;
+    const int chosen = (int)pivot_ids.size();
+    std::vector<float> embedding(bins);
+    std::vector<double> query_distances(chosen);
+    embed_hash(hash, bins_per_band, &embedding[0]);
+    for( int p = 0; p < chosen; p++ ) {
+        query_distances[p] = embedding_distance(&embedding[0], \
+            &embeddings[(size_t)pivot_ids[p] * bins], bins_per_band);
+    }
+
+    // Visit the sorted fingerprints in the narrowest pivot's range, then
+    // those added since.
+    const double radius = sqrt(std::max(cutoff, 0.0)) * (1.0 + pivot_slack) + 1.0e-6;
+    const int *first = NULL, *last = NULL;
+    for( int p = 0; p < chosen; p++ ) {
+        PivotOrder order = { &pivot_distances[p], (size_t)chosen };
+        const int *ids = &by_pivot[(size_t)p * sorted];
+        const int *low = std::lower_bound(ids, ids + sorted, \
+            (float)(query_distances[p] - radius), order);
+        const int *high = std::upper_bound(low, ids + sorted, \
+            (float)(query_distances[p] + radius), order);
+        if( first == NULL || high - low < last - first ) {
+            first = low;
+            last = high;
+        }
+    }
+    candidates.clear();
+    for( int id = sorted; first != last || id < size(); ) {
+        const int candidate = (first != last) ? *first++ : id++;
+        const float *distances = &pivot_distances[(size_t)candidate * chosen];
+        bool possible = true;
+        for( int p = 0; p < chosen && possible; p++ ) {
+            possible = fabs(query_distances[p] - distances[p]) <= radius;
+        }
+        if( possible ) {
+            candidates.push_back(candidate);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    return (int)candidates.size();
+}
+
+
+int histogroup::Index::size() const {
+    return (int)(hashes.size() / (bins_per_band * bins_per_band * bins_per_band));
+}
+
+
+const float *histogroup::Index::hash_of(int id) const {
+    return &hashes[(size_t)id * bins_per_band * bins_per_band * bins_per_band];
+}
+
+
+// Index::prepare() and find() as run by image_io::run_blocking().
+struct IndexSearch {
+    histogroup::Index *index;
+    const float *hash;
+    double cutoff;
+    std::vector<int> ids;
+    std::vector<double> distances;
+    int compared;
+
+    static void *run(void *search) {
+        IndexSearch *self = (IndexSearch*)search;
+        self->index->prepare();
+        self->index->find(self->hash, self->cutoff, self->ids, \
+            self->distances, &self->compared);
+        return NULL;
+    }
+};
+
+
+std::vector<int> histogroup::Index::search(Fingerprint *query, double cutoff) {
+    if( query == NULL || query->bins_per_band != bins_per_band ) {
+        throw CImgArgumentException("histogroup::Index::search fingerprint of another size.\n");
+    }
+    IndexSearch search;
+    search.index = this;
+    search.hash = query->contents;
+    search.cutoff = cutoff;
+    search.compared = 0;
+    image_io::run_blocking(IndexSearch::run, &search);
+    verified = search.compared;
+    return search.ids;
+}
+
+
+int histogroup::Index::search_hash(const float *hash, double cutoff, \
+        std::vector<int> &ids, std::vector<double> &distances) {
+    prepare();
+    return find(hash, cutoff, ids, distances, &verified);
+}
+
+
+int histogroup::Index::find(const float *hash, double cutoff, \
+        std::vector<int> &ids, std::vector<double> &distances, \
+        int *compared) const {
+    ScopedLock lock(mutex, true);
+    const int count = size();
+    const int bins = bins_per_band * bins_per_band * bins_per_band;
+    ids.clear();
+    distances.clear();
+    if( compared != NULL ) {
+        *compared = 0;
+    }
+    if( count == 0 ) {
+        return 0;
+    }
+
+    // Fingerprints that could be within cutoff, in order.
+    std::vector<int> candidates;
+    if( pivots > 0 ) {
+        search_pivots(hash, cutoff, candidates);
+    } else if( coarse_bins_per_band > 0 ) {
+        std::vector<float> coarse(bins / 8);
+        std::vector<double> coarse_distances(count);
+        coarsen_hash(hash, bins_per_band, &coarse[0]);
+        const double coarse_cutoff = cutoff * (1.0 + coarse_slack) + 1.0e-9;
+        compare_chisquare_many(&coarse[0], &coarse_hashes[0], count, \
+            coarse_bins_per_band, &coarse_distances[0], coarse_cutoff);
+        for( int id = 0; id < count; id++ ) {
+            if( coarse_distances[id] <= coarse_cutoff ) {
+                candidates.push_back(id);
+            }
+        }
+    } else {
+        std::vector<double> all_distances(count);
+        compare_chisquare_many(hash, &hashes[0], count, bins_per_band, \
+            &all_distances[0], cutoff);
+        for( int id = 0; id < count; id++ ) {
+            if( all_distances[id] <= cutoff ) {
+                ids.push_back(id);
+                distances.push_back(all_distances[id]);
+            }
+        }
+        if( compared != NULL ) {
+            *compared = count;
+        }
+        return (int)ids.size();
+    }
+
+    // Compare the candidates in full.
+    const int checked = (int)candidates.size();
+    if( checked > 0 ) {
+        std::vector<float> gathered((size_t)checked * bins);
+        std::vector<double> candidate_distances(checked);
+        for( int index = 0; index < checked; index++ ) {
+            const float *candidate = &hashes[(size_t)candidates[index] * bins];
+            std::copy(candidate, candidate + bins, &gathered[(size_t)index * bins]);
+        }
+        compare_chisquare_many(hash, &gathered[0], checked, bins_per_band, \
+            &candidate_distances[0], cutoff);
+        for( int index = 0; index < checked; index++ ) {
+            if( candidate_distances[index] <= cutoff ) {
+                ids.push_back(candidates[index]);
+                distances.push_back(candidate_distances[index]);
+            }
+        }
+    }
+    if( compared != NULL ) {
+        *compared = checked;
+    }
+    return (int)ids.size();
+}
+
+
+
+// class histogroup::Groups
+
+histogroup::Groups::Groups(int hash_size_in_bins_per_dimension, double radius, \
+        int min_members, int pivots) : \
+        index(hash_size_in_bins_per_dimension, true, pivots) {
+    this->radius = radius;
+    this->min_members = min_members;
+    threads = 0;
+    group_count = 0;
+}
+
+
+// Groups::add_hash() as run by image_io::run_blocking().
+struct GroupAddition {
+    histogroup::Groups *groups;
+    const float *hash;
+    int id;
+
+    static void *run(void *addition) {
+        GroupAddition *self = (GroupAddition*)addition;
+        self->id = self->groups->add_hash(self->hash);
+        return NULL;
+    }
+};
+
+
+int histogroup::Groups::add(Fingerprint *fingerprint) {
+    if( fingerprint == NULL || fingerprint->bins_per_band != index.bins_per_band ) {
+        throw CImgArgumentException("histogroup::Groups::add fingerprint of another size.\n");
+    }
+    GroupAddition addition;
+    addition.groups = this;
+    addition.hash = fingerprint->contents;
+    addition.id = -1;
+    image_io::run_blocking(GroupAddition::run, &addition);
+    return addition.id;
+}
+
+
+int histogroup::Groups::add_hash(const float *hash) {
+    ScopedLock lock(mutex, false);
+    group_of.push_back(-1);
+    neighbor_counts.push_back(0);
+    return index.add_hash(hash);
+}
+
+
+int histogroup::Groups::size() const {
+    return index.size();
+}
+
+
+// Neighbors of every step-th fingerprint from first, found by one thread.
+struct NeighborSearch {
+    const histogroup::Index *index;
+    double radius;
+    int first, step;
+    std::vector<int> counts, neighbors;     // Each fingerprint's, in turn.
+
+    static void *run(void *search) {
+        ((NeighborSearch*)search)->find();
+        return NULL;
+    }
+    void find() {
+        std::vector<int> ids;
+        std::vector<double> distances;
+        for( int id = first; id < index->size(); id += step ) {
+            index->find(index->hash_of(id), radius, ids, distances);
+            counts.push_back((int)ids.size());
+            neighbors.insert(neighbors.end(), ids.begin(), ids.end());
+        }
+    }
+};
+
+
+int histogroup::Groups::cluster() {
+    image_io::run_blocking(run_regroup, this);
+    return group_count;
+}
+
+
+void *histogroup::Groups::run_regroup(void *groups) {
+    ((Groups*)groups)->regroup();
+    return NULL;
+}
+
+
+int histogroup::Groups::regroup() {
+    ScopedLock lock(mutex, false);
+    const int count = size();
+    int threads = this->threads;
+    if( threads <= 0 ) {
+        threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    threads = std::min(std::max(threads, 1), std::max(count, 1));
+
+    // Every fingerprint's neighbors (itself included), fingerprints dealt
+    // out to threads in turn.
+    index.prepare();
+    std::vector<NeighborSearch> searches(threads);
+    std::vector<pthread_t> ids(threads);
+    std::vector<bool> started(threads, false);
+    for( int t = 0; t < threads; t++ ) {
+        NeighborSearch &search = searches[t];
+        search.index = &index;
+        search.radius = radius;
+        search.first = t;
+        search.step = threads;
+        // The calling thread takes the first fingerprints, and those of any
+        // thread that can't be started.
+        started[t] = (t > 0) && \
+            pthread_create(&ids[t], NULL, NeighborSearch::run, &search) == 0;
+    }
+    for( int t = 0; t < threads; t++ ) {
+        if( not started[t] ) {
+            searches[t].find();
+        }
+    }
+    for( int t = 0; t < threads; t++ ) {
+        if( started[t] ) {
+            pthread_join(ids[t], NULL);
+        }
+    }
+    std::vector<size_t> offsets(count + 1, 0);
+    std::vector<int> neighbors;
+    std::vector<size_t> read(threads, 0);
+    for( int id = 0; id < count; id++ ) {
+        const NeighborSearch &search = searches[id % threads];
+        const int found = search.counts[id / threads];
+        neighbors.insert(neighbors.end(), search.neighbors.begin() + read[id % threads], \
+            search.neighbors.begin() + read[id % threads] + found);
+        read[id % threads] += found;
+        neighbor_counts[id] = found;
+        offsets[id + 1] = neighbors.size();
+    }
+    searches.clear();
+
+    // Grow a group from each core fingerprint not yet in one.
+    group_of.assign(count, -1);
+    group_count = 0;
+    std::vector<int> pending;
+    for( int id = 0; id < count; id++ ) {
+        if( group_of[id] >= 0 || neighbor_counts[id] < min_members ) {
+            continue;
+        }
+        group_of[id] = group_count;
+        pending.push_back(id);
+        while( not pending.empty() ) {
+            const int core = pending.back();
+            pending.pop_back();
+            for( size_t n = offsets[core]; n < offsets[core + 1]; n++ ) {
+                const int neighbor = neighbors[n];
+                if( group_of[neighbor] < 0 ) {
+                    group_of[neighbor] = group_count;
+                    if( neighbor_counts[neighbor] >= min_members ) {
+                        pending.push_back(neighbor);
+                    }
+                }
+            }
+        }
+        ++group_count;
+    }
+    return group_count;
+}
+
+
+// Groups::assign_hash() as run by image_io::run_blocking().
+struct GroupAssignment {
+    histogroup::Groups *groups;
+    const float *hash;
+    int group;
+
+    static void *run(void *assignment) {
+        GroupAssignment *self = (GroupAssignment*)assignment;
+        self->group = self->groups->assign_hash(self->hash);
+        return NULL;
+    }
+};
+
+
+int histogroup::Groups::assign(Fingerprint *fingerprint) {
+    if( fingerprint == NULL || fingerprint->bins_per_band != index.bins_per_band ) {
+        throw CImgArgumentException("histogroup::Groups::assign fingerprint of another size.\n");
+    }
+    GroupAssignment assignment;
+    assignment.groups = this;
+    assignment.hash = fingerprint->contents;
+    assignment.group = -1;
+    image_io::run_blocking(GroupAssignment::run, &assignment);
+    return assignment.group;
+}
+
+
+int histogroup::Groups::assign_hash(const float *hash) {
+    ScopedLock lock(mutex, false);
+    std::vector<int> ids;
+    std::vector<double> distances;
+    index.search_hash(hash, radius, ids, distances);
+    int group = -1;
+    double nearest = HUGE_VAL;
+    for( size_t n = 0; n < ids.size(); n++ ) {
+        const int id = ids[n];
+        if( neighbor_counts[id] > 0 ) {
+            ++neighbor_counts[id];
+        }
+        if( group_of[id] >= 0 && neighbor_counts[id] >= min_members && \
+                distances[n] < nearest ) {
+            group = group_of[id];
+            nearest = distances[n];
+        }
+    }
+    index.add_hash(hash);
+    group_of.push_back(group);
+    neighbor_counts.push_back((int)ids.size() + 1);
+    return group;
+}
+
+
+// Groups::labels() as run by image_io::run_blocking().
+struct GroupLabels {
+    const histogroup::Groups *groups;
+    std::vector<int> labels;
+
+    static void *run(void *labels) {
+        GroupLabels *self = (GroupLabels*)labels;
+        self->groups->labels(self->labels);
+        return NULL;
+    }
+};
+
+
+std::vector<int> histogroup::Groups::labels() {
+    GroupLabels labels;
+    labels.groups = this;
+    image_io::run_blocking(GroupLabels::run, &labels);
+    return labels.labels;
+}
+
+
+void histogroup::Groups::labels(std::vector<int> &labels) const {
+    ScopedLock lock(mutex, true);
+    labels = group_of;
+}
+
+
+
+// class histogroup::PartitionedIndex
+
+histogroup::PartitionedIndex::PartitionedIndex( \
+        int hash_size_in_bins_per_dimension, bool screen, int pivots) {
+    bins_per_band = hash_size_in_bins_per_dimension;
+    this->screen = screen;
+    this->pivots = pivots;
+    count = 0;
+    partitions_searched = 0;
+    verified = 0;
+}
+
+
+// PartitionedIndex::add_hash() as run by image_io::run_blocking().
+struct PartitionAddition {
+    histogroup::PartitionedIndex *index;
+    const float *hash;
+    int key;
+    int64_t time;
+    int id;
+
+    static void *run(void *addition) {
+        PartitionAddition *self = (PartitionAddition*)addition;
+        self->id = self->index->add_hash(self->hash, self->key, self->time);
+        return NULL;
+    }
+};
+
+
+int histogroup::PartitionedIndex::add(Fingerprint *fingerprint, int key, \
+        int64_t time) {
+    if( fingerprint == NULL || fingerprint->bins_per_band != bins_per_band ) {
+        throw CImgArgumentException("histogroup::PartitionedIndex::add fingerprint of another size.\n");
+    }
+    PartitionAddition addition;
+    addition.index = this;
+    addition.hash = fingerprint->contents;
+    addition.key = key;
+    addition.time = time;
+    addition.id = -1;
+    image_io::run_blocking(PartitionAddition::run, &addition);
+    return addition.id;
+}
+
+
+int histogroup::PartitionedIndex::add_hash(const float *hash, int key, \
+        int64_t time) {
+    ScopedLock lock(mutex, false);
+    std::map<int, Partition>::iterator found = partitions.find(key);
+    if( found == partitions.end() ) {
+        found = partitions.insert(std::make_pair(key, \
+            Partition(Index(bins_per_band, screen, pivots)))).first;
+        found->second.stats.key = key;
+        found->second.stats.first_time = time;
+        found->second.stats.last_time = time;
+    }
+
+    Partition &partition = found->second;
+    partition.index.add_hash(hash);
+    partition.ids.push_back(count);
+    partition.times.push_back(time);
+    PartitionStats &stats = partition.stats;
+    ++stats.count;
+    stats.first_time = std::min(stats.first_time, time);
+    stats.last_time = std::max(stats.last_time, time);
+    stats.bytes += bins_per_band * bins_per_band * bins_per_band * sizeof(float) + \
+        sizeof(int) + sizeof(int64_t);
+    return count++;
+}
+
+
+int histogroup::PartitionedIndex::size() const {
+    return count;
+}
+
+
+// PartitionedIndex::keys() and statistics() as run by
+// image_io::run_blocking().
+struct PartitionListing {
+    const histogroup::PartitionedIndex *index;
+    bool listing_keys;                      // Else key's statistics.
+    int key;
+    std::vector<int> keys;
+    histogroup::PartitionStats stats;
+
+    static void *run(void *listing) {
+        PartitionListing *self = (PartitionListing*)listing;
+        if( self->listing_keys ) {
+            self->index->keys(self->keys);
+        } else {
+            self->index->statistics(self->key, self->stats);
+        }
+        return NULL;
+    }
+};
+
+
+std::vector<int> histogroup::PartitionedIndex::keys() const {
+    PartitionListing listing;
+    listing.index = this;
+    listing.listing_keys = true;
+    listing.key = 0;
+    image_io::run_blocking(PartitionListing::run, &listing);
+    return listing.keys;
+}
+
+
+void histogroup::PartitionedIndex::keys(std::vector<int> &keys) const {
+    ScopedLock lock(mutex, true);
+    keys.clear();
+    for( std::map<int, Partition>::const_iterator partition = partitions.begin(); \
+            partition != partitions.end(); ++partition ) {
+        keys.push_back(partition->first);
+    }
+}
+
+
+histogroup::PartitionStats histogroup::PartitionedIndex::statistics(int key) const {
+    PartitionListing listing;
+    listing.index = this;
+    listing.listing_keys = false;
+    listing.key = key;
+    image_io::run_blocking(PartitionListing::run, &listing);
+    return listing.stats;
+}
+
+
+void histogroup::PartitionedIndex::statistics(int key, \
+        PartitionStats &stats) const {
+    ScopedLock lock(mutex, true);
+    std::map<int, Partition>::const_iterator found = partitions.find(key);
+    if( found == partitions.end() ) {
+        stats = PartitionStats();
+        stats.key = key;
+        return;
+    }
+    stats = found->second.stats;
+}
+
+
+// PartitionedIndex::find() as run by image_io::run_blocking().
+struct PartitionSearch {
+    histogroup::PartitionedIndex *index;
+    const float *hash;
+    double cutoff;
+    const std::vector<int> *keys;
+    int64_t first_time, last_time;
+    std::vector<int> ids;
+    int searched, compared;
+
+    static void *run(void *search) {
+        PartitionSearch *self = (PartitionSearch*)search;
+        self->index->find(self->hash, self->cutoff, *self->keys, \
+            self->first_time, self->last_time, self->ids, &self->searched, \
+            &self->compared);
+        return NULL;
+    }
+};
+
+
+std::vector<int> histogroup::PartitionedIndex::search(Fingerprint *query, \
+        double cutoff, const std::vector<int> &keys) {
+    return search(query, cutoff, keys, std::numeric_limits<int64_t>::min(), \
+        std::numeric_limits<int64_t>::max());
+}
+
+
+std::vector<int> histogroup::PartitionedIndex::search(Fingerprint *query, \
+        double cutoff, const std::vector<int> &keys, int64_t first_time, \
+        int64_t last_time) {
+    if( query == NULL || query->bins_per_band != bins_per_band ) {
+        throw CImgArgumentException("histogroup::PartitionedIndex::search fingerprint of another size.\n");
+    }
+    PartitionSearch search;
+    search.index = this;
+    search.hash = query->contents;
+    search.cutoff = cutoff;
+    search.keys = &keys;
+    search.first_time = first_time;
+    search.last_time = last_time;
+    search.searched = search.compared = 0;
+    image_io::run_blocking(PartitionSearch::run, &search);
+    partitions_searched = search.searched;
+    verified = search.compared;
+    return search.ids;
+}
+
+
+int histogroup::PartitionedIndex::search_hash(const float *hash, \
+        double cutoff, const std::vector<int> &keys, int64_t first_time, \
+        int64_t last_time, std::vector<int> &ids) {
+    return find(hash, cutoff, keys, first_time, last_time, ids, \
+        &partitions_searched, &verified);
+}
+
+
+int histogroup::PartitionedIndex::find(const float *hash, double cutoff, \
+        const std::vector<int> &keys, int64_t first_time, int64_t last_time, \
+        std::vector<int> &ids, int *searched, int *compared) {
+    ScopedLock lock(mutex, true);
+    int probed = 0, checked = 0;
+    ids.clear();
+    std::vector<int> wanted(keys);
+    std::sort(wanted.begin(), wanted.end());
+    wanted.erase(std::unique(wanted.begin(), wanted.end()), wanted.end());
+
+    std::vector<int> found;
+    std::vector<double> distances;
+    for( size_t k = 0; k < wanted.size(); k++ ) {
+        std::map<int, Partition>::iterator partition = partitions.find(wanted[k]);
+        if( partition == partitions.end() || \
+                partition->second.stats.last_time < first_time || \
+                partition->second.stats.first_time > last_time ) {
+            continue;
+        }
+        Partition &scanned = partition->second;
+        int partition_checked = 0;
+        scanned.index.prepare();
+        scanned.index.find(hash, cutoff, found, distances, &partition_checked);
+        ++probed;
+        checked += partition_checked;
+        for( size_t n = 0; n < found.size(); n++ ) {
+            const int64_t time = scanned.times[found[n]];
+            if( time >= first_time && time <= last_time ) {
+                ids.push_back(scanned.ids[found[n]]);
+            }
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    if( searched != NULL ) {
+        *searched = probed;
+    }
+    if( compared != NULL ) {
+        *compared = checked;
+    }
+    return (int)ids.size();
+}
+
+
+
+// class histogroup::SceneIndex
+
+// Same bit counting as mwisd_fp::fast_popcount_64().
+static int popcount_64(uint64_t x) {
+    x -= (x >> 1) & 0x5555555555555555ULL;
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (int)((x * 0x0101010101010101ULL) >> 56);
+}
+
+
+// Packs an mwisd_fp fingerprint's 16-bit members four to a word.
+static void pack_mwisd_hash(const uint16_t *mwisd_hash, int size_in_bytes, \
+        uint64_t *words) {
+    for( int word = 0; word < (size_in_bytes + 7) / 8; word++ ) {
+        words[word] = 0;
+        for( int part = 0; part < 4 && (word * 4 + part) * 2 < size_in_bytes; part++ ) {
+            words[word] |= (uint64_t)mwisd_hash[word * 4 + part] << (16 * part);
+        }
+    }
+}
+
+
+histogroup::SceneIndex::SceneIndex(int hash_size_in_bins_per_dimension, \
+        int mwisd_size_in_bytes, int cell_levels) {
+    bins_per_band = hash_size_in_bins_per_dimension;
+    this->mwisd_size_in_bytes = mwisd_size_in_bytes;
+    this->cell_levels = std::max(cell_levels, 1);
+    const int bins = bins_per_band * bins_per_band * bins_per_band;
+    coarse_bins = (bins_per_band % 2 == 0) ? bins / 8 : bins;
+    cells_probed = 0;
+    verified = 0;
+}
+
+
+void histogroup::SceneIndex::coarsen(const float *hash, float *coarse) const {
+    if( coarsen_hash(hash, bins_per_band, coarse) < 0 ) {
+        std::copy(hash, hash + coarse_bins, coarse);
+    }
+}
+
+
+// SceneIndex::add_hashes() as run by image_io::run_blocking().
+struct SceneAddition {
+    histogroup::SceneIndex *index;
+    const float *hash;
+    const uint16_t *mwisd_hash;
+    int id;
+
+    static void *run(void *addition) {
+        SceneAddition *self = (SceneAddition*)addition;
+        self->id = self->index->add_hashes(self->hash, self->mwisd_hash);
+        return NULL;
+    }
+};
+
+
+int histogroup::SceneIndex::add(Fingerprint *scene, \
+        const std::vector<int> &mwisd_values) {
+    if( scene == NULL || scene->bins_per_band != bins_per_band || \
+            (int)mwisd_values.size() * 2 != mwisd_size_in_bytes ) {
+        throw CImgArgumentException("histogroup::SceneIndex::add fingerprint of another size.\n");
+    }
+    std::vector<uint16_t> mwisd_hash(mwisd_values.begin(), mwisd_values.end());
+    SceneAddition addition;
+    addition.index = this;
+    addition.hash = scene->contents;
+    addition.mwisd_hash = &mwisd_hash[0];
+    addition.id = -1;
+    image_io::run_blocking(SceneAddition::run, &addition);
+    return addition.id;
+}
+
+
+int histogroup::SceneIndex::add_hashes(const float *hash, \
+        const uint16_t *mwisd_hash) {
+    ScopedLock lock(mutex, false);
+    const int bins = bins_per_band * bins_per_band * bins_per_band;
+    const int id = size();
+    hashes.insert(hashes.end(), hash, hash + bins);
+
+    // File it under its coarse bins' levels.
+    std::vector<float> coarse(coarse_bins);
+    coarsen(hash, &coarse[0]);
+    std::string key(coarse_bins, '\0');
+    for( int bin = 0; bin < coarse_bins; bin++ ) {
+        const double root = sqrt(std::max(coarse[bin], 0.0f));
+        key[bin] = (char)std::min((int)(root * cell_levels), cell_levels - 1);
+    }
+    std::map<std::string, int>::iterator found = cell_of_key.find(key);
+    if( found == cell_of_key.end() ) {
+        found = cell_of_key.insert(std::make_pair(key, (int)cells.size())).first;
+        cells.push_back(Cell());
+        for( int bin = 0; bin < coarse_bins; bin++ ) {
+            const int level = key[bin];
+            cell_lows.push_back((float)(level * level) / (cell_levels * cell_levels));
+            cell_highs.push_back((level == cell_levels - 1) ? HUGE_VALF : \
+                (float)((level + 1) * (level + 1)) / (cell_levels * cell_levels));
+        }
+    }
+
+    Cell &cell = cells[found->second];
+    cell.ids.push_back(id);
+    const int words = (mwisd_size_in_bytes + 7) / 8;
+    cell.words.resize(cell.words.size() + words);
+    pack_mwisd_hash(mwisd_hash, mwisd_size_in_bytes, \
+        &cell.words[cell.words.size() - words]);
+    return id;
+}
+
+
+int histogroup::SceneIndex::size() const {
+    return (int)(hashes.size() / (bins_per_band * bins_per_band * bins_per_band));
+}
+
+
+int histogroup::SceneIndex::cell_count() const {
+    return (int)cells.size();
+}
+
+
+// SceneIndex::find() as run by image_io::run_blocking().
+struct SceneSearch {
+    const histogroup::SceneIndex *index;
+    const float *hash;
+    const uint16_t *mwisd_hash;
+    double cutoff, similarity;
+    std::vector<int> ids;
+    int probed, compared;
+
+    static void *run(void *search) {
+        SceneSearch *self = (SceneSearch*)search;
+        self->index->find(self->hash, self->mwisd_hash, self->cutoff, \
+            self->similarity, self->ids, &self->probed, &self->compared);
+        return NULL;
+    }
+};
+
+
+std::vector<int> histogroup::SceneIndex::search(Fingerprint *scene, \
+        const std::vector<int> &mwisd_values, double cutoff, double similarity) {
+    if( scene == NULL || scene->bins_per_band != bins_per_band || \
+            (int)mwisd_values.size() * 2 != mwisd_size_in_bytes ) {
+        throw CImgArgumentException("histogroup::SceneIndex::search fingerprint of another size.\n");
+    }
+    std::vector<uint16_t> mwisd_hash(mwisd_values.begin(), mwisd_values.end());
+    SceneSearch search;
+    search.index = this;
+    search.hash = scene->contents;
+    search.mwisd_hash = &mwisd_hash[0];
+    search.cutoff = cutoff;
+    search.similarity = similarity;
+    search.probed = search.compared = 0;
+    image_io::run_blocking(SceneSearch::run, &search);
+    cells_probed = search.probed;
+    verified = search.compared;
+    return search.ids;
+}
+
+
+int histogroup::SceneIndex::search_hashes(const float *hash, \
+        const uint16_t *mwisd_hash, double cutoff, double similarity, \
+        std::vector<int> &ids) {
+    return find(hash, mwisd_hash, cutoff, similarity, ids, &cells_probed, \
+        &verified);
+}
+
+
+int histogroup::SceneIndex::find(const float *hash, \
+        const uint16_t *mwisd_hash, double cutoff, double similarity, \
+        std::vector<int> &ids, int *probed, int *compared) const {
+    ScopedLock lock(mutex, true);
+    const int bins = bins_per_band * bins_per_band * bins_per_band;
+    const int words = (mwisd_size_in_bytes + 7) / 8;
+    const int max_bits = (int)floor((1.0 - similarity) * 8 * mwisd_size_in_bytes + 1.0e-9);
+    const double coarse_cutoff = cutoff * (1.0 + coarse_slack) + 1.0e-9;
+    int probed_cells = 0, checked = 0;
+    ids.clear();
+
+    std::vector<float> coarse(coarse_bins);
+    coarsen(hash, &coarse[0]);
+    std::vector<uint64_t> query(words);
+    pack_mwisd_hash(mwisd_hash, mwisd_size_in_bytes, &query[0]);
+
+    for( size_t c = 0; c < cells.size(); c++ ) {
+        // Each term of the chi-square sum is least at the point of the
+        // cell's range nearest the query's bin.
+        const float *low = &cell_lows[c * coarse_bins];
+        const float *high = &cell_highs[c * coarse_bins];
+        double bound = 0.0;
+        for( int bin = 0; bin < coarse_bins && bound <= coarse_cutoff; bin++ ) {
+            const float a = coarse[bin];
+            const float b = std::min(std::max(a, low[bin]), high[bin]);
+            bound += (a - b) * (a - b) / (a + b + 0.0000000001);
+        }
+        if( bound > coarse_cutoff ) {
+            continue;
+        }
+
+        const Cell &cell = cells[c];
+        ++probed_cells;
+        checked += (int)cell.ids.size();
+        for( size_t entry = 0; entry < cell.ids.size(); entry++ ) {
+            const uint64_t *packed = &cell.words[entry * words];
+            int differing = 0;
+            for( int word = 0; word < words && differing <= max_bits; word++ ) {
+                differing += popcount_64(packed[word] ^ query[word]);
+            }
+            if( differing > max_bits ) {
+                continue;
+            }
+            const int id = cell.ids[entry];
+            if( compare_chisquare((float*)hash, (float*)&hashes[(size_t)id * bins], \
+                    bins_per_band) <= cutoff ) {
+                ids.push_back(id);
+            }
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    if( probed != NULL ) {
+        *probed = probed_cells;
+    }
+    if( compared != NULL ) {
+        *compared = checked;
+    }
+    return (int)ids.size();
+}
+
+
+
+// class histogroup::Fingerprint
+
+histogroup::Fingerprint::Fingerprint(int hash_size_in_bins_per_dimension) {
+	bins_per_band = hash_size_in_bins_per_dimension;
+    size_in_bytes = bins_per_band * bins_per_band * bins_per_band * sizeof(float);
+    contents = (float*)malloc(size_in_bytes);
+    threads = 1;
+    sample_budget = 0;
+    drift_bound = 0.0;
+}
+
+
+histogroup::Fingerprint::~Fingerprint() {
+    if(contents != NULL) {
+        free(contents);
+    }
+}
+
+
+std::vector<float> histogroup::Fingerprint::as_float_array() {
+    std::vector<float> values (contents, contents+(size_in_bytes/sizeof(float)));
+    return values;
+}
+
+
+void histogroup::Fingerprint::set_from_float_array(const std::vector<float>& values) {
+    // Expects a bins_per_band**3 element vector, in the style created by ::as_float_array().
+    size_t count = std::min((size_t)size_in_bytes/sizeof(float), values.size());
+    std::copy (values.begin(), values.begin()+count, contents);
+}
+
+
+std::string histogroup::Fingerprint::as_quantized(int bits) {
+    std::string blob;
+    if( quantize_hash(contents, bins_per_band, bits, blob) < 1 ) {
+        throw CImgArgumentException("histogroup::quantize_hash supports 8 or 16 bits.\n");
+    }
+    return blob;
+}
+
+
+void histogroup::Fingerprint::set_from_quantized(const std::string &blob) {
+    if( dequantize_hash(blob, bins_per_band, contents) < 1 ) {
+        throw CImgArgumentException("histogroup::dequantize_hash unexpected quantized size.\n");
+    }
+}
+
+
+// compute_image_hash() for Fingerprint::compute_from_image_file(), as run by
+// image_io::run_blocking().
+struct HistogroupComputation {
+    histogroup::Fingerprint *fingerprint;
+    const char *filename;
+    int size_in_bytes;
+    int retval;
+
+    static void *run(void *computation) {
+        HistogroupComputation *self = (HistogroupComputation*)computation;
+        histogroup::Fingerprint *fp = self->fingerprint;
+        self->retval = histogroup::compute_image_hash(self->filename, \
+            fp->contents, self->size_in_bytes, fp->bins_per_band, \
+            fp->decode_options, fp->threads, fp->sample_budget, &fp->drift_bound);
+        return NULL;
+    }
+};
+
+
 void histogroup::Fingerprint::compute_from_image_file(const char *filename) {
-    int retval =
-        compute_image_hash(filename, contents, size_in_bytes, bins_per_band);
+    HistogroupComputation computation;
+    computation.fingerprint = this;
+    computation.filename = filename;
+    computation.size_in_bytes = size_in_bytes;
+    computation.retval = -1;
+    image_io::run_blocking(HistogroupComputation::run, &computation);
+    const int retval = computation.retval;
     if( retval < 0 ) {
         throw CImgIOException("histogroup::compute_image_hash negative return value.\n");
     }
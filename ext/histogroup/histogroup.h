@@ -10,8 +10,13 @@
 #ifndef HISTOGROUP_H_
 #define HISTOGROUP_H_
 
+#include <math.h>
+#include <pthread.h>
 #include <stdint.h>
+#include <map>
+#include <string>
 #include <vector>
+#include "image_io.h"
 
 // CImg-related settings
 #define cimg_debug 0
@@ -28,12 +33,71 @@ namespace histogroup {
 
 const int default_hash_size_in_bins = 4;
 const int default_hash_size_in_bytes = 4*4*4*sizeof(float);
+// Images are histogrammed by up to one thread per this many pixels.
+const size_t pixels_per_histogram_thread = 1 << 20;
 
 
+// threads:  most threads to histogram the image with (default 1; 0: one per
+//     online CPU).
+// sample_budget:  histogram larger images from about this many pixels, a
+//     stratified sample (0: every pixel); drift_bound, if given, is set to the
+//     chi-square distance from the full histogram the sample stays within
+//     with 99.9% confidence (0 when every pixel was used).
 int compute_image_hash(const char *filename, float* &hash, \
-        int hash_size_in_bins, int bins_per_dimension);
+        int hash_size_in_bins, int bins_per_dimension, \
+        const image_io::DecodeOptions &options=image_io::DecodeOptions(), \
+        int threads=1, uint64_t sample_budget=0, double *drift_bound=NULL);
+// The same, decoding the file's contents already read into data (see
+// PipelineOptions::read_contents) where image_io can; sampled and streamed
+// histograms still read the file.
+int compute_image_hash(const char *filename, const char *data, size_t length, \
+        float* &hash, int hash_size_in_bins, int bins_per_dimension, \
+        const image_io::DecodeOptions &options, int threads, \
+        uint64_t sample_budget, double *drift_bound);
 double compare_chisquare(float *hash_1, float *hash_2, \
         int hash_size_in_bins);
+// Distances from hash to count fingerprints stored back to back in hashes,
+// identical to compare_chisquare()'s.  Comparisons are abandoned once
+// certain to exceed cutoff, so distances above cutoff are only lower bounds
+// (still above it).  Returns how many are within cutoff.
+int compare_chisquare_many(const float *hash, const float *hashes, \
+        int count, int bins_per_dimension, double *distances, \
+        double cutoff=HUGE_VAL);
+// Sums each 2x2x2 block of bins into coarse (bins_per_dimension even).
+int coarsen_hash(const float *hash, int bins_per_dimension, float *coarse);
+// Square roots of the bins:  points whose Euclidean (Hellinger) distances
+// bound compare_chisquare()'s, d**2 <= chi-square <= 2 d**2, and, unlike it,
+// obey the triangle inequality.
+int embed_hash(const float *hash, int bins_per_dimension, float *embedding);
+double embedding_distance(const float *embedding_1, const float *embedding_2, \
+        int bins_per_dimension);
+int quantize_hash(const float *hash, int bins_per_dimension, int bits, \
+        std::string &blob);
+int dequantize_hash(const std::string &blob, int bins_per_dimension, \
+        float* &hash);
+double compare_chisquare_quantized(const uint8_t *hash_1, \
+        const uint8_t *hash_2, int bins_per_dimension);
+double compare_chisquare_quantized(const uint16_t *hash_1, \
+        const uint16_t *hash_2, int bins_per_dimension);
+double compare_quantized(const std::string &blob_1, \
+        const std::string &blob_2, int bins_per_dimension);
+// Distances (as compare_quantized()'s) from the quantized fingerprint
+// bytes_1 to each of those of its size packed back to back in bytes_2, as
+// little-endian float32s.
+std::string compare_many(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2, int bins_per_dimension);
+// Indices into bytes_2, as above, of the fingerprints within cutoff of
+// bytes_1:  nearest first (ties in packed order), and at most limit of them
+// (0:  all).
+std::vector<int> match_many(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2, int bins_per_dimension, \
+        double cutoff=HUGE_VAL, int limit=0);
+// compare_chisquare_many() for Ruby:  distances from the fingerprint bytes_1,
+// its bins as little-endian float32s, to each of those of its size packed
+// back to back in bytes_2, as little-endian float64s.
+std::string compare_chisquare_many(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2, int bins_per_dimension, \
+        double cutoff=HUGE_VAL);
 int read_hash_from_text(char *text, float* &hash, int hash_size_in_bins);
 
 
@@ -41,6 +105,10 @@ class Fingerprint {
 public:
     float* contents;
     int bins_per_band;
+    image_io::DecodeOptions decode_options;     // Limits for computing.
+    int threads;                                // See compute_image_hash().
+    uint64_t sample_budget;                     // Ditto.
+    double drift_bound;                         // Set by compute_from_image_file().
 private:
     int size_in_bytes;
 
@@ -50,10 +118,264 @@ public:
 
     std::vector<float> as_float_array();
     void set_from_float_array(const std::vector<float>& values);
+    std::string as_quantized(int bits=8);      // 8 or 16; see quantize_hash().
+    void set_from_quantized(const std::string &blob);
 
     void compute_from_image_file(const char *filename);
     double compare(Fingerprint *other);
 };
+
+
+// Readers-writer lock over an index's contents, so searches may run on
+// several threads at once (and, from Ruby, without the interpreter lock;
+// see image_io::run_blocking()) while adds wait their turn.  Copies are
+// fresh, unlocked locks, so classes holding one stay copyable.  Counters of
+// the last search (verified and the like) are set outside the lock:  from
+// Ruby, with the GVL held.
+class SharedMutex {
+public:
+    SharedMutex();
+    SharedMutex(const SharedMutex &other);
+    SharedMutex &operator=(const SharedMutex &other);
+    ~SharedMutex();
+    void lock(bool shared) const;
+    void unlock() const;
+private:
+    mutable pthread_rwlock_t rwlock;
+};
+
+// Holds a SharedMutex, shared or not, for its scope.
+class ScopedLock {
+public:
+    ScopedLock(const SharedMutex &mutex, bool shared);
+    ~ScopedLock();
+private:
+    const SharedMutex &mutex;
+};
+
+
+// In-memory collection of fingerprints searchable by distance.  With
+// screening (and an even bins_per_band), each fingerprint's histogram
+// collapsed to half the bins per dimension (see coarsen_hash()) is kept as
+// well, an eighth of the size; searches compare those first and only
+// compare fingerprints in full when their coarse distance is within the
+// cutoff.  Results are the same either way.
+//
+// With pivots, fingerprints' embeddings (see embed_hash()) are kept too,
+// along with their distances to that many pivot fingerprints, chosen far
+// apart.  By the triangle inequality, only fingerprints whose distance to
+// every pivot is within sqrt(cutoff) of the query's can be within cutoff.
+// Fingerprints are kept sorted by distance to each pivot, and only those
+// in the narrowest such range (found by binary search) are visited, so
+// searches need not visit every fingerprint.  Those left are compared in
+// full (coarse screening is not used with pivots).  Pivots are chosen at
+// the first search, and again once the index has doubled in size;
+// fingerprints added in between are visited by every search until the
+// next re-sort.
+class Index {
+public:
+    int bins_per_band;
+    int coarse_bins_per_band;   // 0 when not screening.
+    int pivots;                 // 0 when not using pivots.
+    int verified;               // Compared in full by the last search.
+private:
+    std::vector<float> hashes, coarse_hashes, embeddings;
+    std::vector<int> pivot_ids;
+    std::vector<float> pivot_distances;     // size() rows of pivot_ids.size().
+    std::vector<int> by_pivot;  // Per pivot, ids below sorted, by distance.
+    int sorted;                 // size() when by_pivot was last sorted.
+    int pivots_chosen_at;                   // size() when pivots were chosen.
+    SharedMutex mutex;
+
+    void choose_pivots();
+    void sort_by_pivots();
+    int search_pivots(const float *hash, double cutoff, \
+        std::vector<int> &candidates) const;
+
+public:
+    Index(int hash_size_in_bins_per_dimension=default_hash_size_in_bins, \
+        bool screen=true, int pivots=0);
+
+    int add(Fingerprint *fingerprint);          // Returns its id (0, 1, ...).
+    int add_hash(const float *hash);
+    int size() const;
+    const float *hash_of(int id) const;
+    // Ids, in order, of fingerprints within cutoff of query.
+    std::vector<int> search(Fingerprint *query, double cutoff);
+    int search_hash(const float *hash, double cutoff, std::vector<int> &ids, \
+        std::vector<double> &distances);
+    // Brings the pivots up to date, after which find() (search_hash() less
+    // that, and leaving verified alone) may be called from several threads
+    // at once.
+    void prepare();
+    int find(const float *hash, double cutoff, std::vector<int> &ids, \
+        std::vector<double> &distances, int *compared=NULL) const;
+};
+
+
+// Density-based grouping (DBSCAN) of fingerprints.  A fingerprint with at
+// least min_members fingerprints (itself included) within radius is a core
+// one; core fingerprints within radius of each other share a group, as do
+// the others within radius of one (joining the group of the first core
+// fingerprint, by id, to reach them).  The rest are left ungrouped (-1).
+// With min_members of 2, every fingerprint within radius of another is
+// grouped.  Groups are numbered 0, 1, ... in order of their first core
+// fingerprint, so are the same however many threads search for
+// neighbors.
+//
+// cluster() groups every fingerprint afresh.  assign() instead adds one to
+// the group of its nearest core neighbor, without re-grouping the others:
+// new fingerprints never start or merge groups until the next cluster().
+class Groups {
+public:
+    double radius;              // Largest chi-square distance of neighbors.
+    int min_members;
+    int threads;                // Most threads for cluster() (0: one per online CPU).
+    int group_count;            // Groups found by the last cluster().
+private:
+    Index index;
+    std::vector<int> group_of;
+    std::vector<int> neighbor_counts;       // Itself included; 0 if unknown.
+    SharedMutex mutex;
+
+    int regroup();
+    static void *run_regroup(void *groups);
+
+public:
+    Groups(int hash_size_in_bins_per_dimension=default_hash_size_in_bins, \
+        double radius=0.02, int min_members=2, int pivots=0);
+
+    int add(Fingerprint *fingerprint);          // Returns its id (0, 1, ...).
+    int add_hash(const float *hash);
+    int size() const;
+    int cluster();                              // Returns group_count.
+    int assign(Fingerprint *fingerprint);       // Returns its group, or -1.
+    int assign_hash(const float *hash);
+    std::vector<int> labels();                  // Group of each id, or -1.
+    void labels(std::vector<int> &labels) const;
+};
+
+
+// Where a PartitionedIndex partition's fingerprints lie, for planning.
+struct PartitionStats {
+    int key;
+    int count;                  // Fingerprints.
+    int64_t first_time;         // Earliest and latest times given them.
+    int64_t last_time;
+    uint64_t bytes;             // Held for them.
+
+    PartitionStats() : key(0), count(0), first_time(0), last_time(0), \
+        bytes(0) {}
+};
+
+// Fingerprints partitioned by an integer key (an event or uploader, say),
+// each partition an Index of its own, each fingerprint with an optional
+// time (seconds since the epoch, say).  Searches name the partitions to
+// search and read only those, skipping any whose times all lie outside
+// the range asked for.  Ids number fingerprints across all partitions in
+// the order added.
+class PartitionedIndex {
+public:
+    int bins_per_band;
+    int partitions_searched;    // By the last search.
+    int verified;               // Compared in full by the last search.
+private:
+    struct Partition {
+        Index index;
+        std::vector<int> ids;
+        std::vector<int64_t> times;
+        PartitionStats stats;
+
+        Partition(const Index &index) : index(index) {}
+    };
+    bool screen;
+    int pivots;
+    int count;
+    std::map<int, Partition> partitions;
+    SharedMutex mutex;
+
+public:
+    PartitionedIndex(int hash_size_in_bins_per_dimension=default_hash_size_in_bins, \
+        bool screen=true, int pivots=0);
+
+    int add(Fingerprint *fingerprint, int key, int64_t time=0);
+    int add_hash(const float *hash, int key, int64_t time=0);
+    int size() const;
+    std::vector<int> keys() const;
+    void keys(std::vector<int> &keys) const;
+    PartitionStats statistics(int key) const;   // count 0 if no such key.
+    void statistics(int key, PartitionStats &stats) const;
+    // Ids, in order, of fingerprints within cutoff of query in the
+    // partitions keys, given times from first_time to last_time if those
+    // are given.
+    std::vector<int> search(Fingerprint *query, double cutoff, \
+        const std::vector<int> &keys);
+    std::vector<int> search(Fingerprint *query, double cutoff, \
+        const std::vector<int> &keys, int64_t first_time, int64_t last_time);
+    int search_hash(const float *hash, double cutoff, \
+        const std::vector<int> &keys, int64_t first_time, int64_t last_time, \
+        std::vector<int> &ids);
+    // search_hash(), leaving partitions_searched and verified alone, so
+    // safe from several threads at once.
+    int find(const float *hash, double cutoff, const std::vector<int> &keys, \
+        int64_t first_time, int64_t last_time, std::vector<int> &ids, \
+        int *searched=NULL, int *compared=NULL);
+};
+
+
+// Two-level index for finding re-uploads of an image among those of the
+// same scene:  entries pair a histogroup fingerprint with the mwisd_fp one
+// of the same image (as Mwisd_fp::Fingerprint#as_int_array gives it).
+// Entries are filed in cells by their histogram collapsed as for Index
+// screening (or not, for an odd bins_per_band), each coarse bin's square
+// root cut into cell_levels levels.  A search probes only the cells whose
+// range of coarse histograms could lie within the chi-square cutoff of the
+// query's (the coarse distance never exceeds the full one), compares the
+// mwisd_fp fingerprints filed there by Hamming distance, and confirms the
+// chi-square distance of those similar enough.  Results are the same as
+// comparing every entry both ways.
+class SceneIndex {
+public:
+    int bins_per_band;
+    int mwisd_size_in_bytes;
+    int cell_levels;
+    int cells_probed;           // By the last search.
+    int verified;               // Entries compared by Hamming distance, ditto.
+private:
+    struct Cell {
+        std::vector<int> ids;
+        std::vector<uint64_t> words;        // mwisd_fp fingerprints, packed.
+    };
+    int coarse_bins;
+    std::vector<float> hashes;
+    std::vector<Cell> cells;
+    std::vector<float> cell_lows, cell_highs;   // Range of each cell's coarse bins.
+    std::map<std::string, int> cell_of_key;
+    SharedMutex mutex;
+
+    void coarsen(const float *hash, float *coarse) const;
+
+public:
+    SceneIndex(int hash_size_in_bins_per_dimension=default_hash_size_in_bins, \
+        int mwisd_size_in_bytes=128, int cell_levels=4);
+
+    int add(Fingerprint *scene, const std::vector<int> &mwisd_values);
+    int add_hashes(const float *hash, const uint16_t *mwisd_hash);
+    int size() const;
+    int cell_count() const;
+    // Ids, in order, of entries within cutoff of scene whose mwisd_fp
+    // fingerprints are at least similarity alike (as Mwisd_fp compare()
+    // gives, 1 - the fraction of bits that differ).
+    std::vector<int> search(Fingerprint *scene, \
+        const std::vector<int> &mwisd_values, double cutoff, double similarity);
+    int search_hashes(const float *hash, const uint16_t *mwisd_hash, \
+        double cutoff, double similarity, std::vector<int> &ids);
+    // search_hashes(), leaving cells_probed and verified alone, so safe
+    // from several threads at once.
+    int find(const float *hash, const uint16_t *mwisd_hash, double cutoff, \
+        double similarity, std::vector<int> &ids, int *probed=NULL, \
+        int *compared=NULL) const;
+};
 }
 
 #endif /* HISTOGROUP_H_ */
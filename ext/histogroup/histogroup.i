@@ -1,15 +1,154 @@
 %module histogroup
 %{
 #include "histogroup.h"
+#include "image_io.h"
 #include "CImg.h"
 %}
 
+%{
+#ifdef HAVE_RUBY_THREAD_H
+#include <ruby/thread.h>
+#endif
+
+// Runs long native work (see image_io::run_blocking()) without the GVL, so
+// other Ruby threads run meanwhile.  The work can't be interrupted; a
+// Thread#kill or timeout takes effect once it's done.
+#if defined(HAVE_RB_THREAD_CALL_WITHOUT_GVL)
+static void run_without_gvl(image_io::blocking_function function, void *data) {
+  rb_thread_call_without_gvl(function, data, NULL, NULL);
+}
+#elif defined(HAVE_RB_THREAD_BLOCKING_REGION)
+struct BlockingRegion {
+  image_io::blocking_function function;
+  void *data;
+};
+
+static VALUE run_blocking_region(void *region) {
+  ((BlockingRegion*)region)->function(((BlockingRegion*)region)->data);
+  return Qnil;
+}
+
+static void run_without_gvl(image_io::blocking_function function, void *data) {
+  BlockingRegion region = { function, data };
+  rb_thread_blocking_region(run_blocking_region, &region, NULL, NULL);
+}
+#endif
+%}
+
+%init %{
+#if defined(HAVE_RB_THREAD_CALL_WITHOUT_GVL) || defined(HAVE_RB_THREAD_BLOCKING_REGION)
+  image_io::set_blocking_runner(run_without_gvl);
+#endif
+  rb_define_class("HistogroupError", rb_eStandardError);
+%}
+
+%include "std_string.i"
 %include "std_vector.i"
 namespace std {
   %template(Vectorf) vector<float>;
   %template(Vectori) vector<int>;
 }
 
+%exception as_quantized {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception set_from_quantized {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception compare_quantized {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception compare_many {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception match_many {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception compare_chisquare_many {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception add {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception search {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception assign {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception cluster {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
 %exception compute_from_image_file {
   try {
     $action
@@ -28,4 +167,53 @@ namespace std {
   }
 }
 
+// Only the decode limits (Fingerprint#decode_options) are exposed here;
+// probing lives in Mwisd_fp.
+%ignore image_io::ImageInfo;
+%ignore image_io::EmbeddedPreview;
+%ignore image_io::sniff_format;
+%ignore image_io::probe_image;
+%ignore image_io::find_preview;
+%ignore image_io::probe_decoded;
+%ignore image_io::decoded_size;
+%ignore image_io::jpeg_scale_denom;
+%ignore image_io::load_image;
+%ignore image_io::set_blocking_runner;
+%ignore image_io::run_blocking;
+%ignore image_io::ComputeContext;
+%ignore image_io::thread_compute_context;
+// Ruby holds quantized fingerprints as Strings; see compare_quantized.
+%ignore histogroup::compute_image_hash(const char *, const char *, size_t, \
+        float *&, int, int, const image_io::DecodeOptions &, int, uint64_t, \
+        double *);
+%ignore histogroup::quantize_hash;
+%ignore histogroup::dequantize_hash;
+%ignore histogroup::compare_chisquare_quantized;
+%ignore histogroup::compare_chisquare_many(const float *, const float *, int, \
+        int, double *, double);
+%ignore histogroup::coarsen_hash;
+%ignore histogroup::SharedMutex;
+%ignore histogroup::ScopedLock;
+%ignore histogroup::Index::add_hash;
+%ignore histogroup::Index::search_hash;
+%ignore histogroup::Index::hash_of;
+%ignore histogroup::Index::find;
+%ignore histogroup::Groups::add_hash;
+%ignore histogroup::Groups::assign_hash;
+%ignore histogroup::Groups::labels(std::vector<int> &) const;
+%ignore histogroup::PartitionedIndex::add_hash;
+%ignore histogroup::PartitionedIndex::keys(std::vector<int> &) const;
+%ignore histogroup::PartitionedIndex::statistics(int, PartitionStats &) const;
+%ignore histogroup::PartitionedIndex::search_hash;
+%ignore histogroup::PartitionedIndex::find;
+%ignore histogroup::SceneIndex::add_hashes;
+%ignore histogroup::SceneIndex::search_hashes;
+%ignore histogroup::SceneIndex::find;
+// Packed quantized fingerprints are compared where they lie in their Ruby
+// Strings.
+%apply (char *STRING, size_t LENGTH) { (const char *bytes_1, size_t length_1) };
+%apply (char *STRING, size_t LENGTH) { (const char *bytes_2, size_t length_2) };
+
+%include "stdint.i"
+%include "image_io.h"
 %include "histogroup.h"
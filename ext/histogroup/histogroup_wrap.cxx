@@ -1819,21 +1819,37 @@ int SWIG_Ruby_arity( VALUE proc, int minimal )
 #define SWIGTYPE_p_allocator_type swig_types[0]
 #define SWIGTYPE_p_char swig_types[1]
 #define SWIGTYPE_p_difference_type swig_types[2]
-#define SWIGTYPE_p_float swig_types[3]
-#define SWIGTYPE_p_histogroup__Fingerprint swig_types[4]
-#define SWIGTYPE_p_p_float swig_types[5]
-#define SWIGTYPE_p_p_void swig_types[6]
-#define SWIGTYPE_p_size_type swig_types[7]
-#define SWIGTYPE_p_std__vectorT_float_std__allocatorT_float_t_t swig_types[8]
-#define SWIGTYPE_p_std__vectorT_float_std__allocatorT_float_t_t__allocator_type swig_types[9]
-#define SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t swig_types[10]
-#define SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t__allocator_type swig_types[11]
-#define SWIGTYPE_p_swig__ConstIterator swig_types[12]
-#define SWIGTYPE_p_swig__GC_VALUE swig_types[13]
-#define SWIGTYPE_p_swig__Iterator swig_types[14]
-#define SWIGTYPE_p_value_type swig_types[15]
-static swig_type_info *swig_types[17];
-static swig_module_info swig_module = {swig_types, 16, 0, 0, 0, 0};
+#define SWIGTYPE_p_double swig_types[3]
+#define SWIGTYPE_p_float swig_types[4]
+#define SWIGTYPE_p_histogroup__Fingerprint swig_types[5]
+#define SWIGTYPE_p_histogroup__Groups swig_types[6]
+#define SWIGTYPE_p_histogroup__Index swig_types[7]
+#define SWIGTYPE_p_histogroup__PartitionStats swig_types[8]
+#define SWIGTYPE_p_histogroup__PartitionedIndex swig_types[9]
+#define SWIGTYPE_p_histogroup__SceneIndex swig_types[10]
+#define SWIGTYPE_p_image_io__DecodeOptions swig_types[11]
+#define SWIGTYPE_p_image_io__image_format swig_types[12]
+#define SWIGTYPE_p_int swig_types[13]
+#define SWIGTYPE_p_long_long swig_types[14]
+#define SWIGTYPE_p_p_float swig_types[15]
+#define SWIGTYPE_p_p_void swig_types[16]
+#define SWIGTYPE_p_short swig_types[17]
+#define SWIGTYPE_p_signed_char swig_types[18]
+#define SWIGTYPE_p_size_type swig_types[19]
+#define SWIGTYPE_p_std__vectorT_float_std__allocatorT_float_t_t swig_types[20]
+#define SWIGTYPE_p_std__vectorT_float_std__allocatorT_float_t_t__allocator_type swig_types[21]
+#define SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t swig_types[22]
+#define SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t__allocator_type swig_types[23]
+#define SWIGTYPE_p_swig__ConstIterator swig_types[24]
+#define SWIGTYPE_p_swig__GC_VALUE swig_types[25]
+#define SWIGTYPE_p_swig__Iterator swig_types[26]
+#define SWIGTYPE_p_unsigned_char swig_types[27]
+#define SWIGTYPE_p_unsigned_int swig_types[28]
+#define SWIGTYPE_p_unsigned_long_long swig_types[29]
+#define SWIGTYPE_p_unsigned_short swig_types[30]
+#define SWIGTYPE_p_value_type swig_types[31]
+static swig_type_info *swig_types[33];
+static swig_module_info swig_module = {swig_types, 32, 0, 0, 0, 0};
 #define SWIG_TypeQuery(name) SWIG_TypeQueryModule(&swig_module, &swig_module, name)
 #define SWIG_MangledTypeQuery(name) SWIG_MangledTypeQueryModule(&swig_module, &swig_module, name)
 
@@ -1860,9 +1876,42 @@ static VALUE mHistogroup;
 
 
 #include "histogroup.h"
+#include "image_io.h"
 #include "CImg.h"
 
 
+#ifdef HAVE_RUBY_THREAD_H
+#include <ruby/thread.h>
+#endif
+
+// Runs long native work (see image_io::run_blocking()) without the GVL, so
+// other Ruby threads run meanwhile.  The work can't be interrupted; a
+// Thread#kill or timeout takes effect once it's done.
+#if defined(HAVE_RB_THREAD_CALL_WITHOUT_GVL)
+static void run_without_gvl(image_io::blocking_function function, void *data) {
+  rb_thread_call_without_gvl(function, data, NULL, NULL);
+}
+#elif defined(HAVE_RB_THREAD_BLOCKING_REGION)
+struct BlockingRegion {
+  image_io::blocking_function function;
+  void *data;
+};
+
+static VALUE run_blocking_region(void *region) {
+  ((BlockingRegion*)region)->function(((BlockingRegion*)region)->data);
+  return Qnil;
+}
+
+static void run_without_gvl(image_io::blocking_function function, void *data) {
+  BlockingRegion region = { function, data };
+  rb_thread_blocking_region(run_blocking_region, &region, NULL, NULL);
+}
+#endif
+
+
+#include <stdint.h>		// Use the C99 official header
+
+
 #include <iostream>
 
 
@@ -4803,6 +4852,158 @@ SWIG_AsCharPtrAndSize(VALUE obj, char** cptr, size_t* psize, int *alloc)
 
 
 
+
+SWIGINTERN int
+SWIG_AsVal_bool (VALUE obj, bool *val)
+{
+  if (obj == Qtrue) {
+    if (val) *val = true;
+    return SWIG_OK;
+  } else if (obj == Qfalse) {
+    if (val) *val = false;
+    return SWIG_OK;
+  } else {
+    int res = 0;
+    if (SWIG_AsVal_int (obj, &res) == SWIG_OK) {
+      if (val) *val = res ? true : false;
+      return SWIG_OK;
+    }
+  }
+  return SWIG_TypeError;
+}
+
+
+/*@SWIG:/usr/local/share/swig/2.0.2/ruby/rubyprimtypes.swg,19,%ruby_aux_method@*/
+SWIGINTERN VALUE SWIG_AUX_NUM2ULL(VALUE *args)
+{
+  VALUE obj = args[0];
+  VALUE type = TYPE(obj);
+  long long *res = (long long *)(args[1]);
+  *res = type == T_FIXNUM ? NUM2ULL(obj) : rb_big2ull(obj);
+  return obj;
+}
+/*@SWIG@*/
+
+SWIGINTERN int
+SWIG_AsVal_unsigned_SS_long_SS_long (VALUE obj, unsigned long long *val)
+{
+  VALUE type = TYPE(obj);
+  if ((type == T_FIXNUM) || (type == T_BIGNUM)) {
+    unsigned long long v;
+    VALUE a[2];
+    a[0] = obj;
+    a[1] = (VALUE)(&v);
+    if (rb_rescue(RUBY_METHOD_FUNC(SWIG_AUX_NUM2ULL), (VALUE)a, RUBY_METHOD_FUNC(SWIG_ruby_failed), 0) != Qnil) {
+      if (val) *val = v;
+      return SWIG_OK;
+    }
+  }
+  return SWIG_TypeError;
+}
+
+
+SWIGINTERNINLINE VALUE
+SWIG_From_unsigned_SS_long_SS_long  (unsigned long long value)
+{
+  return ULL2NUM(value);
+}
+
+
+/*@SWIG:/usr/local/share/swig/2.0.2/ruby/rubyprimtypes.swg,19,%ruby_aux_method@*/
+SWIGINTERN VALUE SWIG_AUX_NUM2LL(VALUE *args)
+{
+  VALUE obj = args[0];
+  VALUE type = TYPE(obj);
+  long long *res = (long long *)(args[1]);
+  *res = type == T_FIXNUM ? NUM2LL(obj) : rb_big2ll(obj);
+  return obj;
+}
+/*@SWIG@*/
+
+SWIGINTERN int
+SWIG_AsVal_long_SS_long (VALUE obj, long long *val)
+{
+  VALUE type = TYPE(obj);
+  if ((type == T_FIXNUM) || (type == T_BIGNUM)) {
+    long long v;
+    VALUE a[2];
+    a[0] = obj;
+    a[1] = (VALUE)(&v);
+    if (rb_rescue(RUBY_METHOD_FUNC(SWIG_AUX_NUM2LL), (VALUE)a, RUBY_METHOD_FUNC(SWIG_ruby_failed), 0) != Qnil) {
+      if (val) *val = v;
+      return SWIG_OK;
+    }
+  }
+  return SWIG_TypeError;
+}
+
+
+SWIGINTERNINLINE VALUE
+SWIG_From_long_SS_long  (long long value)
+{
+  return LL2NUM(value);
+}
+
+
+SWIGINTERNINLINE VALUE
+SWIG_FromCharPtrAndSize(const char* carray, size_t size)
+{
+  if (carray) {
+    if (size > LONG_MAX) {
+      swig_type_info* pchar_descriptor = SWIG_pchar_descriptor();
+      return pchar_descriptor ?
+	SWIG_NewPointerObj(const_cast< char * >(carray), pchar_descriptor, 0) : Qnil;
+    } else {
+      return rb_str_new(carray, static_cast< long >(size));
+    }
+  } else {
+    return Qnil;
+  }
+}
+
+
+SWIGINTERN int
+SWIG_AsPtr_std_string (VALUE obj, std::string **val)
+{
+  char* buf = 0 ; size_t size = 0; int alloc = SWIG_OLDOBJ;
+  if (SWIG_IsOK((SWIG_AsCharPtrAndSize(obj, &buf, &size, &alloc)))) {
+    if (buf) {
+      if (val) *val = new std::string(buf, size - 1);
+      if (alloc == SWIG_NEWOBJ) delete[] buf;
+      return SWIG_NEWOBJ;
+    } else {
+      if (val) *val = 0;
+      return SWIG_OLDOBJ;
+    }
+  } else {
+    static int init = 0;
+    static swig_type_info* descriptor = 0;
+    if (!init) {
+      descriptor = SWIG_TypeQuery("std::string" " *");
+      init = 1;
+    }
+    if (descriptor) {
+      std::string *vptr;
+      int res = SWIG_ConvertPtr(obj, (void**)&vptr, descriptor, 0);
+      if (SWIG_IsOK(res) && val) *val = vptr;
+      return res;
+    }
+  }
+  return SWIG_ERROR;
+}
+
+
+SWIGINTERNINLINE VALUE
+SWIG_From_std_string  (const std::string& s)
+{
+  if (s.size()) {
+    return SWIG_FromCharPtrAndSize(s.data(), s.size());
+  } else {
+    return SWIG_FromCharPtrAndSize(s.c_str(), 0);
+  }
+}
+
+
 swig_class SwigClassGC_VALUE;
 
 
@@ -10488,188 +10689,4826 @@ free_std_vector_Sl_int_Sg_(std::vector< int > *arg1) {
 }
 
 SWIGINTERN VALUE
-_wrap_default_hash_size_in_bins_get(VALUE self) {
+_wrap_sniff_length_get(VALUE self) {
   VALUE _val;
   
-  _val = SWIG_From_int(static_cast< int >(histogroup::default_hash_size_in_bins));
+  _val = SWIG_From_int(static_cast< int >(image_io::sniff_length));
   return _val;
 }
 
 
+swig_class SwigClassDecodeOptions;
+
 SWIGINTERN VALUE
-_wrap_default_hash_size_in_bytes_get(VALUE self) {
-  VALUE _val;
+_wrap_DecodeOptions_max_pixels_set(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  uint64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned long long val2 ;
+  int ecode2 = 0 ;
   
-  _val = SWIG_From_int(static_cast< int >(histogroup::default_hash_size_in_bytes));
-  return _val;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","max_pixels", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","max_pixels", 2, argv[0] ));
+  } 
+  arg2 = static_cast< uint64_t >(val2);
+  if (arg1) (arg1)->max_pixels = arg2;
+  return Qnil;
+fail:
+  return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_compute_image_hash(int argc, VALUE *argv, VALUE self) {
-  char *arg1 = (char *) 0 ;
-  float **arg2 = 0 ;
-  int arg3 ;
-  int arg4 ;
-  int res1 ;
-  char *buf1 = 0 ;
-  int alloc1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  int val4 ;
-  int ecode4 = 0 ;
-  int result;
+_wrap_DecodeOptions_max_pixels_get(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint64_t result;
   VALUE vresult = Qnil;
   
-  if ((argc < 4) || (argc > 4)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","histogroup::compute_image_hash", 1, argv[0] ));
-  }
-  arg1 = reinterpret_cast< char * >(buf1);
-  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_float,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *&","histogroup::compute_image_hash", 2, argv[1] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "float *&","histogroup::compute_image_hash", 2, argv[1])); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","max_pixels", 1, self )); 
   }
-  arg2 = reinterpret_cast< float ** >(argp2);
-  ecode3 = SWIG_AsVal_int(argv[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 3, argv[2] ));
-  } 
-  arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(argv[3], &val4);
-  if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 4, argv[3] ));
-  } 
-  arg4 = static_cast< int >(val4);
-  result = (int)histogroup::compute_image_hash((char const *)arg1,*arg2,arg3,arg4);
-  vresult = SWIG_From_int(static_cast< int >(result));
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  result = (uint64_t) ((arg1)->max_pixels);
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
   return vresult;
 fail:
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_compare_chisquare(int argc, VALUE *argv, VALUE self) {
-  float *arg1 = (float *) 0 ;
-  float *arg2 = (float *) 0 ;
-  int arg3 ;
+_wrap_DecodeOptions_min_dim_set(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  double result;
-  VALUE vresult = Qnil;
+  int val2 ;
+  int ecode2 = 0 ;
   
-  if ((argc < 3) || (argc > 3)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(argv[0], &argp1,SWIGTYPE_p_float, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "float *","histogroup::compare_chisquare", 1, argv[0] )); 
-  }
-  arg1 = reinterpret_cast< float * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[1], &argp2,SWIGTYPE_p_float, 0 |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *","histogroup::compare_chisquare", 2, argv[1] )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","min_dim", 1, self )); 
   }
-  arg2 = reinterpret_cast< float * >(argp2);
-  ecode3 = SWIG_AsVal_int(argv[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::compare_chisquare", 3, argv[2] ));
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","min_dim", 2, argv[0] ));
   } 
-  arg3 = static_cast< int >(val3);
-  result = (double)histogroup::compare_chisquare(arg1,arg2,arg3);
-  vresult = SWIG_From_double(static_cast< double >(result));
-  return vresult;
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->min_dim = arg2;
+  return Qnil;
 fail:
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_read_hash_from_text(int argc, VALUE *argv, VALUE self) {
-  char *arg1 = (char *) 0 ;
-  float **arg2 = 0 ;
-  int arg3 ;
-  int res1 ;
-  char *buf1 = 0 ;
-  int alloc1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
+_wrap_DecodeOptions_min_dim_get(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
   int result;
   VALUE vresult = Qnil;
   
-  if ((argc < 3) || (argc > 3)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char *","histogroup::read_hash_from_text", 1, argv[0] ));
-  }
-  arg1 = reinterpret_cast< char * >(buf1);
-  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_float,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *&","histogroup::read_hash_from_text", 2, argv[1] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "float *&","histogroup::read_hash_from_text", 2, argv[1])); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","min_dim", 1, self )); 
   }
-  arg2 = reinterpret_cast< float ** >(argp2);
-  ecode3 = SWIG_AsVal_int(argv[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::read_hash_from_text", 3, argv[2] ));
-  } 
-  arg3 = static_cast< int >(val3);
-  result = (int)histogroup::read_hash_from_text(arg1,*arg2,arg3);
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  result = (int) ((arg1)->min_dim);
   vresult = SWIG_From_int(static_cast< int >(result));
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return vresult;
 fail:
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return Qnil;
 }
 
 
-swig_class SwigClassFingerprint;
-
 SWIGINTERN VALUE
-_wrap_Fingerprint_contents_set(int argc, VALUE *argv, VALUE self) {
-  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
-  float *arg2 = (float *) 0 ;
+_wrap_DecodeOptions_memory_cap_set(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  uint64_t arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  unsigned long long val2 ;
+  int ecode2 = 0 ;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","memory_cap", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","memory_cap", 2, argv[0] ));
+  } 
+  arg2 = static_cast< uint64_t >(val2);
+  if (arg1) (arg1)->memory_cap = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_DecodeOptions_memory_cap_get(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","memory_cap", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  result = (uint64_t) ((arg1)->memory_cap);
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_DecodeOptions_preview_min_dim_set(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","preview_min_dim", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","preview_min_dim", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->preview_min_dim = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_DecodeOptions_preview_min_dim_get(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","preview_min_dim", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  result = (int) ((arg1)->preview_min_dim);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+SWIGINTERN VALUE
+_wrap_DecodeOptions_allocate(VALUE self) {
+#else
+  SWIGINTERN VALUE
+  _wrap_DecodeOptions_allocate(int argc, VALUE *argv, VALUE self) {
+#endif
+    
+    
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_image_io__DecodeOptions);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+    rb_obj_call_init(vresult, argc, argv);
+#endif
+    return vresult;
+  }
+  
+
+SWIGINTERN VALUE
+_wrap_new_DecodeOptions(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *result = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  result = (image_io::DecodeOptions *)new image_io::DecodeOptions();
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_image_io_DecodeOptions(image_io::DecodeOptions *arg1) {
+    delete arg1;
+}
+
+SWIGINTERN VALUE
+_wrap_load_ok_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::load_ok));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_arguments_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_arguments));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_open_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_open));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_unknown_format_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_unknown_format));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_decode_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_decode));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_too_large_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_too_large));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_not_streamable_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_not_streamable));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_needs_file_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_needs_file));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_sniff_file_format(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  image_io::image_format *arg2 = 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","image_io::sniff_file_format", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_image_io__image_format,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "image_io::image_format &","image_io::sniff_file_format", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::image_format &","image_io::sniff_file_format", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< image_io::image_format * >(argp2);
+  result = (int)image_io::sniff_file_format((char const *)arg1,*arg2);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_default_hash_size_in_bins_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(histogroup::default_hash_size_in_bins));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_default_hash_size_in_bytes_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(histogroup::default_hash_size_in_bytes));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_pixels_per_histogram_thread_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_size_t(static_cast< size_t >(histogroup::pixels_per_histogram_thread));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_hash__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  float **arg2 = 0 ;
+  int arg3 ;
+  int arg4 ;
+  image_io::DecodeOptions *arg5 = 0 ;
+  int arg6 ;
+  uint64_t arg7 ;
+  double *arg8 = (double *) 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  void *argp5 = 0 ;
+  int res5 = 0 ;
+  int val6 ;
+  int ecode6 = 0 ;
+  unsigned long long val7 ;
+  int ecode7 = 0 ;
+  void *argp8 = 0 ;
+  int res8 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 8) || (argc > 8)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 8)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","histogroup::compute_image_hash", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_float,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *&","histogroup::compute_image_hash", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "float *&","histogroup::compute_image_hash", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< float ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  res5 = SWIG_ConvertPtr(argv[4], &argp5, SWIGTYPE_p_image_io__DecodeOptions,  0 );
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "image_io::DecodeOptions const &","histogroup::compute_image_hash", 5, argv[4] )); 
+  }
+  if (!argp5) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::DecodeOptions const &","histogroup::compute_image_hash", 5, argv[4])); 
+  }
+  arg5 = reinterpret_cast< image_io::DecodeOptions * >(argp5);
+  ecode6 = SWIG_AsVal_int(argv[5], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 6, argv[5] ));
+  } 
+  arg6 = static_cast< int >(val6);
+  ecode7 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "uint64_t","histogroup::compute_image_hash", 7, argv[6] ));
+  } 
+  arg7 = static_cast< uint64_t >(val7);
+  res8 = SWIG_ConvertPtr(argv[7], &argp8,SWIGTYPE_p_double, 0 |  0 );
+  if (!SWIG_IsOK(res8)) {
+    SWIG_exception_fail(SWIG_ArgError(res8), Ruby_Format_TypeError( "", "double *","histogroup::compute_image_hash", 8, argv[7] )); 
+  }
+  arg8 = reinterpret_cast< double * >(argp8);
+  result = (int)histogroup::compute_image_hash((char const *)arg1,*arg2,arg3,arg4,(image_io::DecodeOptions const &)*arg5,arg6,arg7,arg8);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_hash__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  float **arg2 = 0 ;
+  int arg3 ;
+  int arg4 ;
+  image_io::DecodeOptions *arg5 = 0 ;
+  int arg6 ;
+  uint64_t arg7 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  void *argp5 = 0 ;
+  int res5 = 0 ;
+  int val6 ;
+  int ecode6 = 0 ;
+  unsigned long long val7 ;
+  int ecode7 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 7) || (argc > 7)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 7)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","histogroup::compute_image_hash", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_float,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *&","histogroup::compute_image_hash", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "float *&","histogroup::compute_image_hash", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< float ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  res5 = SWIG_ConvertPtr(argv[4], &argp5, SWIGTYPE_p_image_io__DecodeOptions,  0 );
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "image_io::DecodeOptions const &","histogroup::compute_image_hash", 5, argv[4] )); 
+  }
+  if (!argp5) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::DecodeOptions const &","histogroup::compute_image_hash", 5, argv[4])); 
+  }
+  arg5 = reinterpret_cast< image_io::DecodeOptions * >(argp5);
+  ecode6 = SWIG_AsVal_int(argv[5], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 6, argv[5] ));
+  } 
+  arg6 = static_cast< int >(val6);
+  ecode7 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[6], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "uint64_t","histogroup::compute_image_hash", 7, argv[6] ));
+  } 
+  arg7 = static_cast< uint64_t >(val7);
+  result = (int)histogroup::compute_image_hash((char const *)arg1,*arg2,arg3,arg4,(image_io::DecodeOptions const &)*arg5,arg6,arg7);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_hash__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  float **arg2 = 0 ;
+  int arg3 ;
+  int arg4 ;
+  image_io::DecodeOptions *arg5 = 0 ;
+  int arg6 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  void *argp5 = 0 ;
+  int res5 = 0 ;
+  int val6 ;
+  int ecode6 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 6) || (argc > 6)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","histogroup::compute_image_hash", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_float,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *&","histogroup::compute_image_hash", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "float *&","histogroup::compute_image_hash", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< float ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  res5 = SWIG_ConvertPtr(argv[4], &argp5, SWIGTYPE_p_image_io__DecodeOptions,  0 );
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "image_io::DecodeOptions const &","histogroup::compute_image_hash", 5, argv[4] )); 
+  }
+  if (!argp5) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::DecodeOptions const &","histogroup::compute_image_hash", 5, argv[4])); 
+  }
+  arg5 = reinterpret_cast< image_io::DecodeOptions * >(argp5);
+  ecode6 = SWIG_AsVal_int(argv[5], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 6, argv[5] ));
+  } 
+  arg6 = static_cast< int >(val6);
+  result = (int)histogroup::compute_image_hash((char const *)arg1,*arg2,arg3,arg4,(image_io::DecodeOptions const &)*arg5,arg6);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_hash__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  float **arg2 = 0 ;
+  int arg3 ;
+  int arg4 ;
+  image_io::DecodeOptions *arg5 = 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  void *argp5 = 0 ;
+  int res5 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 5) || (argc > 5)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 5)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","histogroup::compute_image_hash", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_float,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *&","histogroup::compute_image_hash", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "float *&","histogroup::compute_image_hash", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< float ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  res5 = SWIG_ConvertPtr(argv[4], &argp5, SWIGTYPE_p_image_io__DecodeOptions,  0 );
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), Ruby_Format_TypeError( "", "image_io::DecodeOptions const &","histogroup::compute_image_hash", 5, argv[4] )); 
+  }
+  if (!argp5) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::DecodeOptions const &","histogroup::compute_image_hash", 5, argv[4])); 
+  }
+  arg5 = reinterpret_cast< image_io::DecodeOptions * >(argp5);
+  result = (int)histogroup::compute_image_hash((char const *)arg1,*arg2,arg3,arg4,(image_io::DecodeOptions const &)*arg5);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_hash__SWIG_4(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  float **arg2 = 0 ;
+  int arg3 ;
+  int arg4 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","histogroup::compute_image_hash", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_float,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *&","histogroup::compute_image_hash", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "float *&","histogroup::compute_image_hash", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< float ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","histogroup::compute_image_hash", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  result = (int)histogroup::compute_image_hash((char const *)arg1,*arg2,arg3,arg4);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_compute_image_hash(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[8];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 8) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 4) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_float, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_compute_image_hash__SWIG_4(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_float, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            void *vptr = 0;
+            int res = SWIG_ConvertPtr(argv[4], &vptr, SWIGTYPE_p_image_io__DecodeOptions, 0);
+            _v = SWIG_CheckState(res);
+            if (_v) {
+              return _wrap_compute_image_hash__SWIG_3(nargs, args, self);
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 6) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_float, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            void *vptr = 0;
+            int res = SWIG_ConvertPtr(argv[4], &vptr, SWIGTYPE_p_image_io__DecodeOptions, 0);
+            _v = SWIG_CheckState(res);
+            if (_v) {
+              {
+                int res = SWIG_AsVal_int(argv[5], NULL);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                return _wrap_compute_image_hash__SWIG_2(nargs, args, self);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 7) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_float, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            void *vptr = 0;
+            int res = SWIG_ConvertPtr(argv[4], &vptr, SWIGTYPE_p_image_io__DecodeOptions, 0);
+            _v = SWIG_CheckState(res);
+            if (_v) {
+              {
+                int res = SWIG_AsVal_int(argv[5], NULL);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_unsigned_SS_long_SS_long(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  return _wrap_compute_image_hash__SWIG_1(nargs, args, self);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 8) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_float, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            void *vptr = 0;
+            int res = SWIG_ConvertPtr(argv[4], &vptr, SWIGTYPE_p_image_io__DecodeOptions, 0);
+            _v = SWIG_CheckState(res);
+            if (_v) {
+              {
+                int res = SWIG_AsVal_int(argv[5], NULL);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                {
+                  int res = SWIG_AsVal_unsigned_SS_long_SS_long(argv[6], NULL);
+                  _v = SWIG_CheckState(res);
+                }
+                if (_v) {
+                  void *vptr = 0;
+                  int res = SWIG_ConvertPtr(argv[7], &vptr, SWIGTYPE_p_double, 0);
+                  _v = SWIG_CheckState(res);
+                  if (_v) {
+                    return _wrap_compute_image_hash__SWIG_0(nargs, args, self);
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 8, "compute_image_hash", 
+    "    int compute_image_hash(char const *filename, float *&hash, int hash_size_in_bins, int bins_per_dimension, image_io::DecodeOptions const &options, int threads, uint64_t sample_budget, double *drift_bound)\n"
+    "    int compute_image_hash(char const *filename, float *&hash, int hash_size_in_bins, int bins_per_dimension, image_io::DecodeOptions const &options, int threads, uint64_t sample_budget)\n"
+    "    int compute_image_hash(char const *filename, float *&hash, int hash_size_in_bins, int bins_per_dimension, image_io::DecodeOptions const &options, int threads)\n"
+    "    int compute_image_hash(char const *filename, float *&hash, int hash_size_in_bins, int bins_per_dimension, image_io::DecodeOptions const &options)\n"
+    "    int compute_image_hash(char const *filename, float *&hash, int hash_size_in_bins, int bins_per_dimension)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compare_chisquare(int argc, VALUE *argv, VALUE self) {
+  float *arg1 = (float *) 0 ;
+  float *arg2 = (float *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  double result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1,SWIGTYPE_p_float, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "float *","histogroup::compare_chisquare", 1, argv[0] )); 
+  }
+  arg1 = reinterpret_cast< float * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2,SWIGTYPE_p_float, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *","histogroup::compare_chisquare", 2, argv[1] )); 
+  }
+  arg2 = reinterpret_cast< float * >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::compare_chisquare", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  result = (double)histogroup::compare_chisquare(arg1,arg2,arg3);
+  vresult = SWIG_From_double(static_cast< double >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_embed_hash(int argc, VALUE *argv, VALUE self) {
+  float *arg1 = (float *) 0 ;
+  int arg2 ;
+  float *arg3 = (float *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1,SWIGTYPE_p_float, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "float const *","histogroup::embed_hash", 1, argv[0] )); 
+  }
+  arg1 = reinterpret_cast< float * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","histogroup::embed_hash", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  res3 = SWIG_ConvertPtr(argv[2], &argp3,SWIGTYPE_p_float, 0 |  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "float *","histogroup::embed_hash", 3, argv[2] )); 
+  }
+  arg3 = reinterpret_cast< float * >(argp3);
+  result = (int)histogroup::embed_hash((float const *)arg1,arg2,arg3);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_embedding_distance(int argc, VALUE *argv, VALUE self) {
+  float *arg1 = (float *) 0 ;
+  float *arg2 = (float *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  double result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1,SWIGTYPE_p_float, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "float const *","histogroup::embedding_distance", 1, argv[0] )); 
+  }
+  arg1 = reinterpret_cast< float * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2,SWIGTYPE_p_float, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float const *","histogroup::embedding_distance", 2, argv[1] )); 
+  }
+  arg2 = reinterpret_cast< float * >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::embedding_distance", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  result = (double)histogroup::embedding_distance((float const *)arg1,(float const *)arg2,arg3);
+  vresult = SWIG_From_double(static_cast< double >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compare_quantized(int argc, VALUE *argv, VALUE self) {
+  std::string *arg1 = 0 ;
+  std::string *arg2 = 0 ;
+  int arg3 ;
+  int res1 = SWIG_OLDOBJ ;
+  int res2 = SWIG_OLDOBJ ;
+  int val3 ;
+  int ecode3 = 0 ;
+  double result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res1 = SWIG_AsPtr_std_string(argv[0], &ptr);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::string const &","histogroup::compare_quantized", 1, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","histogroup::compare_quantized", 1, argv[0])); 
+    }
+    arg1 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[1], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::string const &","histogroup::compare_quantized", 2, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","histogroup::compare_quantized", 2, argv[1])); 
+    }
+    arg2 = ptr;
+  }
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::compare_quantized", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  {
+    try {
+      result = (double)histogroup::compare_quantized((std::string const &)*arg1,(std::string const &)*arg2,arg3);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_double(static_cast< double >(result));
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return vresult;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compare_many(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  int arg5 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  std::string result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::compare_many", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::compare_many", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  ecode5 = SWIG_AsVal_int(argv[2], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","histogroup::compare_many", 5, argv[2] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  {
+    try {
+      result = histogroup::compare_many((char const *)arg1,arg2,(char const *)arg3,arg4,arg5);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_match_many__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  int arg5 ;
+  double arg6 ;
+  int arg7 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  double val6 ;
+  int ecode6 = 0 ;
+  int val7 ;
+  int ecode7 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 5) || (argc > 5)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 5)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::match_many", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::match_many", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  ecode5 = SWIG_AsVal_int(argv[2], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","histogroup::match_many", 5, argv[2] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  ecode6 = SWIG_AsVal_double(argv[3], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "double","histogroup::match_many", 6, argv[3] ));
+  } 
+  arg6 = static_cast< double >(val6);
+  ecode7 = SWIG_AsVal_int(argv[4], &val7);
+  if (!SWIG_IsOK(ecode7)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode7), Ruby_Format_TypeError( "", "int","histogroup::match_many", 7, argv[4] ));
+  } 
+  arg7 = static_cast< int >(val7);
+  {
+    try {
+      result = histogroup::match_many((char const *)arg1,arg2,(char const *)arg3,arg4,arg5,arg6,arg7);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_match_many__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  int arg5 ;
+  double arg6 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  double val6 ;
+  int ecode6 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::match_many", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::match_many", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  ecode5 = SWIG_AsVal_int(argv[2], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","histogroup::match_many", 5, argv[2] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  ecode6 = SWIG_AsVal_double(argv[3], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "double","histogroup::match_many", 6, argv[3] ));
+  } 
+  arg6 = static_cast< double >(val6);
+  {
+    try {
+      result = histogroup::match_many((char const *)arg1,arg2,(char const *)arg3,arg4,arg5,arg6);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_match_many__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  int arg5 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::match_many", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::match_many", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  ecode5 = SWIG_AsVal_int(argv[2], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","histogroup::match_many", 5, argv[2] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  {
+    try {
+      result = histogroup::match_many((char const *)arg1,arg2,(char const *)arg3,arg4,arg5);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_match_many(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[5];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 5) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 3) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_match_many__SWIG_2(nargs, args, self);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_double(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_match_many__SWIG_1(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_double(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_match_many__SWIG_0(nargs, args, self);
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 5, "match_many", 
+    "    std::vector< int,std::allocator< int > > match_many(char const *bytes_1, size_t length_1, char const *bytes_2, size_t length_2, int bins_per_dimension, double cutoff, int limit)\n"
+    "    std::vector< int,std::allocator< int > > match_many(char const *bytes_1, size_t length_1, char const *bytes_2, size_t length_2, int bins_per_dimension, double cutoff)\n"
+    "    std::vector< int,std::allocator< int > > match_many(char const *bytes_1, size_t length_1, char const *bytes_2, size_t length_2, int bins_per_dimension)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compare_chisquare_many__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  int arg5 ;
+  double arg6 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  double val6 ;
+  int ecode6 = 0 ;
+  std::string result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::compare_chisquare_many", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::compare_chisquare_many", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  ecode5 = SWIG_AsVal_int(argv[2], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","histogroup::compare_chisquare_many", 5, argv[2] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  ecode6 = SWIG_AsVal_double(argv[3], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "double","histogroup::compare_chisquare_many", 6, argv[3] ));
+  } 
+  arg6 = static_cast< double >(val6);
+  {
+    try {
+      result = histogroup::compare_chisquare_many((char const *)arg1,arg2,(char const *)arg3,arg4,arg5,arg6);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compare_chisquare_many__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  int arg5 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  std::string result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::compare_chisquare_many", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","histogroup::compare_chisquare_many", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  ecode5 = SWIG_AsVal_int(argv[2], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","histogroup::compare_chisquare_many", 5, argv[2] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  {
+    try {
+      result = histogroup::compare_chisquare_many((char const *)arg1,arg2,(char const *)arg3,arg4,arg5);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_compare_chisquare_many(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[4];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 4) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 3) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_compare_chisquare_many__SWIG_1(nargs, args, self);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_double(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_compare_chisquare_many__SWIG_0(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 4, "compare_chisquare_many", 
+    "    std::string compare_chisquare_many(char const *bytes_1, size_t length_1, char const *bytes_2, size_t length_2, int bins_per_dimension, double cutoff)\n"
+    "    std::string compare_chisquare_many(char const *bytes_1, size_t length_1, char const *bytes_2, size_t length_2, int bins_per_dimension)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_read_hash_from_text(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  float **arg2 = 0 ;
+  int arg3 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char *","histogroup::read_hash_from_text", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_float,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *&","histogroup::read_hash_from_text", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "float *&","histogroup::read_hash_from_text", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< float ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::read_hash_from_text", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  result = (int)histogroup::read_hash_from_text(arg1,*arg2,arg3);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+swig_class SwigClassFingerprint;
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_contents_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  float *arg2 = (float *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","contents", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_float, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *","contents", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< float * >(argp2);
+  if (arg1) (arg1)->contents = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_contents_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  float *result = 0 ;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","contents", 1, self )); 
   }
-  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_float, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *","contents", 2, argv[0] )); 
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  result = (float *) ((arg1)->contents);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_float, 0 |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_bins_per_band_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","bins_per_band", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","bins_per_band", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->bins_per_band = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_bins_per_band_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","bins_per_band", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  result = (int) ((arg1)->bins_per_band);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_decode_options_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  image_io::DecodeOptions *arg2 = (image_io::DecodeOptions *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","decode_options", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","decode_options", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< image_io::DecodeOptions * >(argp2);
+  if (arg1) (arg1)->decode_options = *arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_decode_options_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  image_io::DecodeOptions *result = 0 ;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","decode_options", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  result = (image_io::DecodeOptions *)& ((arg1)->decode_options);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_threads_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","threads", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","threads", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->threads = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_threads_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","threads", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  result = (int) ((arg1)->threads);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_sample_budget_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  uint64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned long long val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","sample_budget", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","sample_budget", 2, argv[0] ));
+  } 
+  arg2 = static_cast< uint64_t >(val2);
+  if (arg1) (arg1)->sample_budget = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_sample_budget_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","sample_budget", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  result = (uint64_t) ((arg1)->sample_budget);
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_drift_bound_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","drift_bound", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  ecode2 = SWIG_AsVal_double(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","drift_bound", 2, argv[0] ));
+  } 
+  arg2 = static_cast< double >(val2);
+  if (arg1) (arg1)->drift_bound = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_drift_bound_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","drift_bound", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  result = (double) ((arg1)->drift_bound);
+  vresult = SWIG_From_double(static_cast< double >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_Fingerprint__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  histogroup::Fingerprint *result = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::Fingerprint", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  result = (histogroup::Fingerprint *)new histogroup::Fingerprint(arg1);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+SWIGINTERN VALUE
+_wrap_Fingerprint_allocate(VALUE self) {
+#else
+  SWIGINTERN VALUE
+  _wrap_Fingerprint_allocate(int argc, VALUE *argv, VALUE self) {
+#endif
+    
+    
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_histogroup__Fingerprint);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+    rb_obj_call_init(vresult, argc, argv);
+#endif
+    return vresult;
+  }
+  
+
+SWIGINTERN VALUE
+_wrap_new_Fingerprint__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *result = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  result = (histogroup::Fingerprint *)new histogroup::Fingerprint();
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_new_Fingerprint(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[1];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 1) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 0) {
+    return _wrap_new_Fingerprint__SWIG_1(nargs, args, self);
+  }
+  if (argc == 1) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      return _wrap_new_Fingerprint__SWIG_0(nargs, args, self);
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 1, "Fingerprint.new", 
+    "    Fingerprint.new(int hash_size_in_bins_per_dimension)\n"
+    "    Fingerprint.new()\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_histogroup_Fingerprint(histogroup::Fingerprint *arg1) {
+    delete arg1;
+}
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_as_float_array(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< float,std::allocator< float > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","as_float_array", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  result = (arg1)->as_float_array();
+  vresult = swig::from(static_cast< std::vector<float,std::allocator< float > > >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_set_from_float_array(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  std::vector< float,std::allocator< float > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","set_from_float_array", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  {
+    std::vector<float,std::allocator< float > > *ptr = (std::vector<float,std::allocator< float > > *)0;
+    res2 = swig::asptr(argv[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< float,std::allocator< float > > const &","set_from_float_array", 2, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< float,std::allocator< float > > const &","set_from_float_array", 2, argv[0])); 
+    }
+    arg2 = ptr;
+  }
+  (arg1)->set_from_float_array((std::vector< float,std::allocator< float > > const &)*arg2);
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_as_quantized__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  std::string result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","as_quantized", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","as_quantized", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      result = (arg1)->as_quantized(arg2);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_as_quantized__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::string result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","as_quantized", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  {
+    try {
+      result = (arg1)->as_quantized();
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_Fingerprint_as_quantized(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[3];
+  int ii;
+  
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 3) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
+  }
+  if (argc == 1) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_histogroup__Fingerprint, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_Fingerprint_as_quantized__SWIG_1(nargs, args, self);
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_histogroup__Fingerprint, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_Fingerprint_as_quantized__SWIG_0(nargs, args, self);
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 3, "Fingerprint.as_quantized", 
+    "    std::string Fingerprint.as_quantized(int bits)\n"
+    "    std::string Fingerprint.as_quantized()\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_set_from_quantized(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","set_from_quantized", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::string const &","set_from_quantized", 2, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","set_from_quantized", 2, argv[0])); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->set_from_quantized((std::string const &)*arg2);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_compute_from_image_file(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","compute_from_image_file", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","compute_from_image_file", 2, argv[0] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  {
+    try {
+      (arg1)->compute_from_image_file((char const *)arg2);
+    }
+    catch(cimg_library::CImgIOException &cioe) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, cioe.what());
+    }
+    catch(cimg_library::CImgInstanceException &cie) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, cie.what());
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_compare(int argc, VALUE *argv, VALUE self) {
+  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+  histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  double result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","compare", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","compare", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
+  result = (double)(arg1)->compare(arg2);
+  vresult = SWIG_From_double(static_cast< double >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+swig_class SwigClassIndex;
+
+SWIGINTERN VALUE
+_wrap_Index_bins_per_band_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","bins_per_band", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","bins_per_band", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->bins_per_band = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_bins_per_band_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","bins_per_band", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  result = (int) ((arg1)->bins_per_band);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_coarse_bins_per_band_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","coarse_bins_per_band", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","coarse_bins_per_band", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->coarse_bins_per_band = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_coarse_bins_per_band_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","coarse_bins_per_band", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  result = (int) ((arg1)->coarse_bins_per_band);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_pivots_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","pivots", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","pivots", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->pivots = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_pivots_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","pivots", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  result = (int) ((arg1)->pivots);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_verified_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","verified", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","verified", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->verified = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_verified_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","verified", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  result = (int) ((arg1)->verified);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_Index__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  bool arg2 ;
+  int arg3 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  histogroup::Index *result = 0 ;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::Index", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_bool(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "bool","histogroup::Index", 2, argv[1] ));
+  } 
+  arg2 = static_cast< bool >(val2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::Index", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  result = (histogroup::Index *)new histogroup::Index(arg1,arg2,arg3);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_Index__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  bool arg2 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  histogroup::Index *result = 0 ;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::Index", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_bool(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "bool","histogroup::Index", 2, argv[1] ));
+  } 
+  arg2 = static_cast< bool >(val2);
+  result = (histogroup::Index *)new histogroup::Index(arg1,arg2);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_Index__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  histogroup::Index *result = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::Index", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  result = (histogroup::Index *)new histogroup::Index(arg1);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+SWIGINTERN VALUE
+_wrap_Index_allocate(VALUE self) {
+#else
+  SWIGINTERN VALUE
+  _wrap_Index_allocate(int argc, VALUE *argv, VALUE self) {
+#endif
+    
+    
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_histogroup__Index);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+    rb_obj_call_init(vresult, argc, argv);
+#endif
+    return vresult;
+  }
+  
+
+SWIGINTERN VALUE
+_wrap_new_Index__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *result = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  result = (histogroup::Index *)new histogroup::Index();
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_new_Index(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[3];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 3) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 0) {
+    return _wrap_new_Index__SWIG_3(nargs, args, self);
+  }
+  if (argc == 1) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      return _wrap_new_Index__SWIG_2(nargs, args, self);
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_bool(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_new_Index__SWIG_1(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_bool(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_new_Index__SWIG_0(nargs, args, self);
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 3, "Index.new", 
+    "    Index.new(int hash_size_in_bins_per_dimension, bool screen, int pivots)\n"
+    "    Index.new(int hash_size_in_bins_per_dimension, bool screen)\n"
+    "    Index.new(int hash_size_in_bins_per_dimension)\n"
+    "    Index.new()\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_add(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","add", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","add", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
+  {
+    try {
+      result = (int)(arg1)->add(arg2);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_size(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index const *","size", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  result = (int)((histogroup::Index const *)arg1)->size();
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_search(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  double arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","search", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","search", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
+  ecode3 = SWIG_AsVal_double(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "double","search", 3, argv[1] ));
+  } 
+  arg3 = static_cast< double >(val3);
+  {
+    try {
+      result = (arg1)->search(arg2,arg3);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Index_prepare(int argc, VALUE *argv, VALUE self) {
+  histogroup::Index *arg1 = (histogroup::Index *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Index, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Index *","prepare", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Index * >(argp1);
+  (arg1)->prepare();
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_histogroup_Index(histogroup::Index *arg1) {
+    delete arg1;
+}
+
+swig_class SwigClassGroups;
+
+SWIGINTERN VALUE
+_wrap_Groups_radius_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","radius", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  ecode2 = SWIG_AsVal_double(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","radius", 2, argv[0] ));
+  } 
+  arg2 = static_cast< double >(val2);
+  if (arg1) (arg1)->radius = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_radius_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","radius", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  result = (double) ((arg1)->radius);
+  vresult = SWIG_From_double(static_cast< double >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_min_members_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","min_members", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","min_members", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->min_members = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_min_members_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","min_members", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  result = (int) ((arg1)->min_members);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_threads_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","threads", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","threads", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->threads = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_threads_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","threads", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  result = (int) ((arg1)->threads);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_group_count_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","group_count", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","group_count", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->group_count = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_group_count_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","group_count", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  result = (int) ((arg1)->group_count);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_Groups__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  double arg2 ;
+  int arg3 ;
+  int arg4 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  histogroup::Groups *result = 0 ;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::Groups", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_double(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","histogroup::Groups", 2, argv[1] ));
+  } 
+  arg2 = static_cast< double >(val2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::Groups", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","histogroup::Groups", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  result = (histogroup::Groups *)new histogroup::Groups(arg1,arg2,arg3,arg4);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_Groups__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  double arg2 ;
+  int arg3 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  histogroup::Groups *result = 0 ;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::Groups", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_double(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","histogroup::Groups", 2, argv[1] ));
+  } 
+  arg2 = static_cast< double >(val2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::Groups", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  result = (histogroup::Groups *)new histogroup::Groups(arg1,arg2,arg3);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_Groups__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  double arg2 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  histogroup::Groups *result = 0 ;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::Groups", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_double(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","histogroup::Groups", 2, argv[1] ));
+  } 
+  arg2 = static_cast< double >(val2);
+  result = (histogroup::Groups *)new histogroup::Groups(arg1,arg2);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_Groups__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  histogroup::Groups *result = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::Groups", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  result = (histogroup::Groups *)new histogroup::Groups(arg1);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+SWIGINTERN VALUE
+_wrap_Groups_allocate(VALUE self) {
+#else
+  SWIGINTERN VALUE
+  _wrap_Groups_allocate(int argc, VALUE *argv, VALUE self) {
+#endif
+    
+    
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_histogroup__Groups);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+    rb_obj_call_init(vresult, argc, argv);
+#endif
+    return vresult;
+  }
+  
+
+SWIGINTERN VALUE
+_wrap_new_Groups__SWIG_4(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *result = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  result = (histogroup::Groups *)new histogroup::Groups();
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_new_Groups(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[4];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 4) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 0) {
+    return _wrap_new_Groups__SWIG_4(nargs, args, self);
+  }
+  if (argc == 1) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      return _wrap_new_Groups__SWIG_3(nargs, args, self);
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_double(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_new_Groups__SWIG_2(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_double(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_new_Groups__SWIG_1(nargs, args, self);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_double(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_new_Groups__SWIG_0(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 4, "Groups.new", 
+    "    Groups.new(int hash_size_in_bins_per_dimension, double radius, int min_members, int pivots)\n"
+    "    Groups.new(int hash_size_in_bins_per_dimension, double radius, int min_members)\n"
+    "    Groups.new(int hash_size_in_bins_per_dimension, double radius)\n"
+    "    Groups.new(int hash_size_in_bins_per_dimension)\n"
+    "    Groups.new()\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_add(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","add", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","add", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
+  {
+    try {
+      result = (int)(arg1)->add(arg2);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_size(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups const *","size", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  result = (int)((histogroup::Groups const *)arg1)->size();
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_cluster(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","cluster", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  {
+    try {
+      result = (int)(arg1)->cluster();
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_assign(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","assign", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","assign", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
+  {
+    try {
+      result = (int)(arg1)->assign(arg2);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Groups_labels(int argc, VALUE *argv, VALUE self) {
+  histogroup::Groups *arg1 = (histogroup::Groups *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Groups, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Groups *","labels", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::Groups * >(argp1);
+  result = (arg1)->labels();
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_histogroup_Groups(histogroup::Groups *arg1) {
+    delete arg1;
+}
+
+swig_class SwigClassPartitionStats;
+
+SWIGINTERN VALUE
+_wrap_PartitionStats_key_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *arg1 = (histogroup::PartitionStats *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionStats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionStats *","key", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionStats * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","key", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->key = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionStats_key_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *arg1 = (histogroup::PartitionStats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionStats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionStats *","key", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionStats * >(argp1);
+  result = (int) ((arg1)->key);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionStats_count_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *arg1 = (histogroup::PartitionStats *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionStats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionStats *","count", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionStats * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","count", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->count = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionStats_count_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *arg1 = (histogroup::PartitionStats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionStats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionStats *","count", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionStats * >(argp1);
+  result = (int) ((arg1)->count);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionStats_first_time_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *arg1 = (histogroup::PartitionStats *) 0 ;
+  int64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  long long val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionStats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionStats *","first_time", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionStats * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int64_t","first_time", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int64_t >(val2);
+  if (arg1) (arg1)->first_time = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionStats_first_time_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *arg1 = (histogroup::PartitionStats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionStats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionStats *","first_time", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionStats * >(argp1);
+  result = (int64_t) ((arg1)->first_time);
+  vresult = SWIG_From_long_SS_long(static_cast< long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionStats_last_time_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *arg1 = (histogroup::PartitionStats *) 0 ;
+  int64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  long long val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionStats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionStats *","last_time", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionStats * >(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int64_t","last_time", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int64_t >(val2);
+  if (arg1) (arg1)->last_time = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionStats_last_time_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *arg1 = (histogroup::PartitionStats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionStats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionStats *","last_time", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionStats * >(argp1);
+  result = (int64_t) ((arg1)->last_time);
+  vresult = SWIG_From_long_SS_long(static_cast< long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionStats_bytes_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *arg1 = (histogroup::PartitionStats *) 0 ;
+  uint64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned long long val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionStats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionStats *","bytes", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionStats * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","bytes", 2, argv[0] ));
+  } 
+  arg2 = static_cast< uint64_t >(val2);
+  if (arg1) (arg1)->bytes = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionStats_bytes_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *arg1 = (histogroup::PartitionStats *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionStats, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionStats *","bytes", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionStats * >(argp1);
+  result = (uint64_t) ((arg1)->bytes);
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+SWIGINTERN VALUE
+_wrap_PartitionStats_allocate(VALUE self) {
+#else
+  SWIGINTERN VALUE
+  _wrap_PartitionStats_allocate(int argc, VALUE *argv, VALUE self) {
+#endif
+    
+    
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_histogroup__PartitionStats);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+    rb_obj_call_init(vresult, argc, argv);
+#endif
+    return vresult;
+  }
+  
+
+SWIGINTERN VALUE
+_wrap_new_PartitionStats(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionStats *result = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  result = (histogroup::PartitionStats *)new histogroup::PartitionStats();
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_histogroup_PartitionStats(histogroup::PartitionStats *arg1) {
+    delete arg1;
+}
+
+swig_class SwigClassPartitionedIndex;
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_bins_per_band_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex *","bins_per_band", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","bins_per_band", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->bins_per_band = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_bins_per_band_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex *","bins_per_band", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  result = (int) ((arg1)->bins_per_band);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_partitions_searched_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex *","partitions_searched", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","partitions_searched", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->partitions_searched = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_partitions_searched_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex *","partitions_searched", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  result = (int) ((arg1)->partitions_searched);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_verified_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex *","verified", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","verified", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->verified = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_verified_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex *","verified", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  result = (int) ((arg1)->verified);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_PartitionedIndex__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  bool arg2 ;
+  int arg3 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  histogroup::PartitionedIndex *result = 0 ;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::PartitionedIndex", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_bool(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "bool","histogroup::PartitionedIndex", 2, argv[1] ));
+  } 
+  arg2 = static_cast< bool >(val2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::PartitionedIndex", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  result = (histogroup::PartitionedIndex *)new histogroup::PartitionedIndex(arg1,arg2,arg3);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_PartitionedIndex__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  bool arg2 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
+  histogroup::PartitionedIndex *result = 0 ;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::PartitionedIndex", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_bool(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "bool","histogroup::PartitionedIndex", 2, argv[1] ));
+  } 
+  arg2 = static_cast< bool >(val2);
+  result = (histogroup::PartitionedIndex *)new histogroup::PartitionedIndex(arg1,arg2);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_PartitionedIndex__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  histogroup::PartitionedIndex *result = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::PartitionedIndex", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  result = (histogroup::PartitionedIndex *)new histogroup::PartitionedIndex(arg1);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_allocate(VALUE self) {
+#else
+  SWIGINTERN VALUE
+  _wrap_PartitionedIndex_allocate(int argc, VALUE *argv, VALUE self) {
+#endif
+    
+    
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_histogroup__PartitionedIndex);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+    rb_obj_call_init(vresult, argc, argv);
+#endif
+    return vresult;
+  }
+  
+
+SWIGINTERN VALUE
+_wrap_new_PartitionedIndex__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *result = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  result = (histogroup::PartitionedIndex *)new histogroup::PartitionedIndex();
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_new_PartitionedIndex(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[3];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 3) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 0) {
+    return _wrap_new_PartitionedIndex__SWIG_3(nargs, args, self);
+  }
+  if (argc == 1) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      return _wrap_new_PartitionedIndex__SWIG_2(nargs, args, self);
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_bool(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_new_PartitionedIndex__SWIG_1(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_bool(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_new_PartitionedIndex__SWIG_0(nargs, args, self);
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 3, "PartitionedIndex.new", 
+    "    PartitionedIndex.new(int hash_size_in_bins_per_dimension, bool screen, int pivots)\n"
+    "    PartitionedIndex.new(int hash_size_in_bins_per_dimension, bool screen)\n"
+    "    PartitionedIndex.new(int hash_size_in_bins_per_dimension)\n"
+    "    PartitionedIndex.new()\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_add__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  int arg3 ;
+  int64_t arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  long long val4 ;
+  int ecode4 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex *","add", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","add", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","add", 3, argv[1] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_long_SS_long(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int64_t","add", 4, argv[2] ));
+  } 
+  arg4 = static_cast< int64_t >(val4);
+  {
+    try {
+      result = (int)(arg1)->add(arg2,arg3,arg4);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_add__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex *","add", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","add", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","add", 3, argv[1] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  {
+    try {
+      result = (int)(arg1)->add(arg2,arg3);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_PartitionedIndex_add(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[5];
+  int ii;
+  
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 5) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
+  }
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_histogroup__PartitionedIndex, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_histogroup__Fingerprint, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_PartitionedIndex_add__SWIG_1(nargs, args, self);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_histogroup__PartitionedIndex, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_histogroup__Fingerprint, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_long_SS_long(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_PartitionedIndex_add__SWIG_0(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 5, "PartitionedIndex.add", 
+    "    int PartitionedIndex.add(histogroup::Fingerprint *fingerprint, int key, int64_t time)\n"
+    "    int PartitionedIndex.add(histogroup::Fingerprint *fingerprint, int key)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_size(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex const *","size", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  result = (int)((histogroup::PartitionedIndex const *)arg1)->size();
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_keys(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex const *","keys", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  result = ((histogroup::PartitionedIndex const *)arg1)->keys();
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_statistics(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  histogroup::PartitionStats result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex const *","statistics", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","statistics", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  result = ((histogroup::PartitionedIndex const *)arg1)->statistics(arg2);
+  vresult = SWIG_NewPointerObj((new histogroup::PartitionStats(static_cast< const histogroup::PartitionStats& >(result))), SWIGTYPE_p_histogroup__PartitionStats, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_search__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  double arg3 ;
+  std::vector< int,std::allocator< int > > *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  int res4 = SWIG_OLDOBJ ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex *","search", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","search", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
+  ecode3 = SWIG_AsVal_double(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "double","search", 3, argv[1] ));
+  } 
+  arg3 = static_cast< double >(val3);
+  {
+    std::vector<int,std::allocator< int > > *ptr = (std::vector<int,std::allocator< int > > *)0;
+    res4 = swig::asptr(argv[2], &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "std::vector< int,std::allocator< int > > const &","search", 4, argv[2] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< int,std::allocator< int > > const &","search", 4, argv[2])); 
+    }
+    arg4 = ptr;
+  }
+  {
+    try {
+      result = (arg1)->search(arg2,arg3,(std::vector< int,std::allocator< int > > const &)*arg4);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return vresult;
+fail:
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_PartitionedIndex_search__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  histogroup::PartitionedIndex *arg1 = (histogroup::PartitionedIndex *) 0 ;
+  histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  double arg3 ;
+  std::vector< int,std::allocator< int > > *arg4 = 0 ;
+  int64_t arg5 ;
+  int64_t arg6 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  int res4 = SWIG_OLDOBJ ;
+  long long val5 ;
+  int ecode5 = 0 ;
+  long long val6 ;
+  int ecode6 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 5) || (argc > 5)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 5)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__PartitionedIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::PartitionedIndex *","search", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::PartitionedIndex * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","search", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
+  ecode3 = SWIG_AsVal_double(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "double","search", 3, argv[1] ));
+  } 
+  arg3 = static_cast< double >(val3);
+  {
+    std::vector<int,std::allocator< int > > *ptr = (std::vector<int,std::allocator< int > > *)0;
+    res4 = swig::asptr(argv[2], &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), Ruby_Format_TypeError( "", "std::vector< int,std::allocator< int > > const &","search", 4, argv[2] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< int,std::allocator< int > > const &","search", 4, argv[2])); 
+    }
+    arg4 = ptr;
+  }
+  ecode5 = SWIG_AsVal_long_SS_long(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int64_t","search", 5, argv[3] ));
+  } 
+  arg5 = static_cast< int64_t >(val5);
+  ecode6 = SWIG_AsVal_long_SS_long(argv[4], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "int64_t","search", 6, argv[4] ));
+  } 
+  arg6 = static_cast< int64_t >(val6);
+  {
+    try {
+      result = (arg1)->search(arg2,arg3,(std::vector< int,std::allocator< int > > const &)*arg4,arg5,arg6);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return vresult;
+fail:
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_PartitionedIndex_search(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[7];
+  int ii;
+  
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 7) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
+  }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_histogroup__PartitionedIndex, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_histogroup__Fingerprint, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          int res = swig::asptr(argv[3], (std::vector<int,std::allocator< int > >**)(0));
+          _v = SWIG_CheckState(res);
+          if (_v) {
+            return _wrap_PartitionedIndex_search__SWIG_0(nargs, args, self);
+          }
+        }
+      }
+    }
   }
-  arg2 = reinterpret_cast< float * >(argp2);
-  if (arg1) (arg1)->contents = arg2;
+  if (argc == 6) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_histogroup__PartitionedIndex, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_histogroup__Fingerprint, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          int res = swig::asptr(argv[3], (std::vector<int,std::allocator< int > >**)(0));
+          _v = SWIG_CheckState(res);
+          if (_v) {
+            {
+              int res = SWIG_AsVal_long_SS_long(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                int res = SWIG_AsVal_long_SS_long(argv[5], NULL);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                return _wrap_PartitionedIndex_search__SWIG_1(nargs, args, self);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 7, "PartitionedIndex.search", 
+    "    std::vector< int,std::allocator< int > > PartitionedIndex.search(histogroup::Fingerprint *query, double cutoff, std::vector< int,std::allocator< int > > const &keys)\n"
+    "    std::vector< int,std::allocator< int > > PartitionedIndex.search(histogroup::Fingerprint *query, double cutoff, std::vector< int,std::allocator< int > > const &keys, int64_t first_time, int64_t last_time)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_histogroup_PartitionedIndex(histogroup::PartitionedIndex *arg1) {
+    delete arg1;
+}
+
+swig_class SwigClassSceneIndex;
+
+SWIGINTERN VALUE
+_wrap_SceneIndex_bins_per_band_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","bins_per_band", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","bins_per_band", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->bins_per_band = arg2;
   return Qnil;
 fail:
   return Qnil;
@@ -10677,23 +15516,23 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_contents_get(int argc, VALUE *argv, VALUE self) {
-  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+_wrap_SceneIndex_bins_per_band_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  float *result = 0 ;
+  int result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","contents", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","bins_per_band", 1, self )); 
   }
-  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
-  result = (float *) ((arg1)->contents);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_float, 0 |  0 );
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  result = (int) ((arg1)->bins_per_band);
+  vresult = SWIG_From_int(static_cast< int >(result));
   return vresult;
 fail:
   return Qnil;
@@ -10701,8 +15540,8 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_bins_per_band_set(int argc, VALUE *argv, VALUE self) {
-  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+_wrap_SceneIndex_mwisd_size_in_bytes_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
   int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -10712,63 +15551,292 @@ _wrap_Fingerprint_bins_per_band_set(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","bins_per_band", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","mwisd_size_in_bytes", 1, self )); 
   }
-  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","mwisd_size_in_bytes", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->mwisd_size_in_bytes = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_SceneIndex_mwisd_size_in_bytes_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","mwisd_size_in_bytes", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  result = (int) ((arg1)->mwisd_size_in_bytes);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_SceneIndex_cell_levels_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","cell_levels", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","cell_levels", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->cell_levels = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_SceneIndex_cell_levels_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","cell_levels", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  result = (int) ((arg1)->cell_levels);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_SceneIndex_cells_probed_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","cells_probed", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","cells_probed", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->cells_probed = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_SceneIndex_cells_probed_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","cells_probed", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  result = (int) ((arg1)->cells_probed);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_SceneIndex_verified_set(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","verified", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
   ecode2 = SWIG_AsVal_int(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","bins_per_band", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","verified", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->verified = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_SceneIndex_verified_get(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","verified", 1, self )); 
+  }
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  result = (int) ((arg1)->verified);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_SceneIndex__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int arg2 ;
+  int arg3 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  histogroup::SceneIndex *result = 0 ;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::SceneIndex", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","histogroup::SceneIndex", 2, argv[1] ));
   } 
   arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->bins_per_band = arg2;
-  return Qnil;
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","histogroup::SceneIndex", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  result = (histogroup::SceneIndex *)new histogroup::SceneIndex(arg1,arg2,arg3);
+  DATA_PTR(self) = result;
+  return self;
 fail:
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_bins_per_band_get(int argc, VALUE *argv, VALUE self) {
-  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int result;
-  VALUE vresult = Qnil;
+_wrap_new_SceneIndex__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int arg2 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  histogroup::SceneIndex *result = 0 ;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","bins_per_band", 1, self )); 
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
-  result = (int) ((arg1)->bins_per_band);
-  vresult = SWIG_From_int(static_cast< int >(result));
-  return vresult;
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::SceneIndex", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","histogroup::SceneIndex", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  result = (histogroup::SceneIndex *)new histogroup::SceneIndex(arg1,arg2);
+  DATA_PTR(self) = result;
+  return self;
 fail:
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_new_Fingerprint__SWIG_0(int argc, VALUE *argv, VALUE self) {
+_wrap_new_SceneIndex__SWIG_2(int argc, VALUE *argv, VALUE self) {
   int arg1 ;
   int val1 ;
   int ecode1 = 0 ;
-  histogroup::Fingerprint *result = 0 ;
+  histogroup::SceneIndex *result = 0 ;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
   ecode1 = SWIG_AsVal_int(argv[0], &val1);
   if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::Fingerprint", 1, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","histogroup::SceneIndex", 1, argv[0] ));
   } 
   arg1 = static_cast< int >(val1);
-  result = (histogroup::Fingerprint *)new histogroup::Fingerprint(arg1);
+  result = (histogroup::SceneIndex *)new histogroup::SceneIndex(arg1);
   DATA_PTR(self) = result;
   return self;
 fail:
@@ -10778,14 +15846,14 @@ fail:
 
 #ifdef HAVE_RB_DEFINE_ALLOC_FUNC
 SWIGINTERN VALUE
-_wrap_Fingerprint_allocate(VALUE self) {
+_wrap_SceneIndex_allocate(VALUE self) {
 #else
   SWIGINTERN VALUE
-  _wrap_Fingerprint_allocate(int argc, VALUE *argv, VALUE self) {
+  _wrap_SceneIndex_allocate(int argc, VALUE *argv, VALUE self) {
 #endif
     
     
-    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_histogroup__Fingerprint);
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_histogroup__SceneIndex);
 #ifndef HAVE_RB_DEFINE_ALLOC_FUNC
     rb_obj_call_init(vresult, argc, argv);
 #endif
@@ -10794,13 +15862,13 @@ _wrap_Fingerprint_allocate(VALUE self) {
   
 
 SWIGINTERN VALUE
-_wrap_new_Fingerprint__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  histogroup::Fingerprint *result = 0 ;
+_wrap_new_SceneIndex__SWIG_3(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *result = 0 ;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  result = (histogroup::Fingerprint *)new histogroup::Fingerprint();
+  result = (histogroup::SceneIndex *)new histogroup::SceneIndex();
   DATA_PTR(self) = result;
   return self;
 fail:
@@ -10808,18 +15876,18 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_new_Fingerprint(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_new_SceneIndex(int nargs, VALUE *args, VALUE self) {
   int argc;
-  VALUE argv[1];
+  VALUE argv[3];
   int ii;
   
   argc = nargs;
-  if (argc > 1) SWIG_fail;
+  if (argc > 3) SWIG_fail;
   for (ii = 0; (ii < argc); ++ii) {
     argv[ii] = args[ii];
   }
   if (argc == 0) {
-    return _wrap_new_Fingerprint__SWIG_1(nargs, args, self);
+    return _wrap_new_SceneIndex__SWIG_3(nargs, args, self);
   }
   if (argc == 1) {
     int _v;
@@ -10828,164 +15896,238 @@ SWIGINTERN VALUE _wrap_new_Fingerprint(int nargs, VALUE *args, VALUE self) {
       _v = SWIG_CheckState(res);
     }
     if (_v) {
-      return _wrap_new_Fingerprint__SWIG_0(nargs, args, self);
+      return _wrap_new_SceneIndex__SWIG_2(nargs, args, self);
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_new_SceneIndex__SWIG_1(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_new_SceneIndex__SWIG_0(nargs, args, self);
+        }
+      }
     }
   }
   
 fail:
-  Ruby_Format_OverloadedError( argc, 1, "Fingerprint.new", 
-    "    Fingerprint.new(int hash_size_in_bins_per_dimension)\n"
-    "    Fingerprint.new()\n");
+  Ruby_Format_OverloadedError( argc, 3, "SceneIndex.new", 
+    "    SceneIndex.new(int hash_size_in_bins_per_dimension, int mwisd_size_in_bytes, int cell_levels)\n"
+    "    SceneIndex.new(int hash_size_in_bins_per_dimension, int mwisd_size_in_bytes)\n"
+    "    SceneIndex.new(int hash_size_in_bins_per_dimension)\n"
+    "    SceneIndex.new()\n");
   
   return Qnil;
 }
 
 
-SWIGINTERN void
-free_histogroup_Fingerprint(histogroup::Fingerprint *arg1) {
-    delete arg1;
-}
-
 SWIGINTERN VALUE
-_wrap_Fingerprint_as_float_array(int argc, VALUE *argv, VALUE self) {
-  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+_wrap_SceneIndex_add(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
+  histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  std::vector< int,std::allocator< int > > *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< float,std::allocator< float > > result;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  int result;
   VALUE vresult = Qnil;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","as_float_array", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","add", 1, self )); 
   }
-  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
-  result = (arg1)->as_float_array();
-  vresult = swig::from(static_cast< std::vector<float,std::allocator< float > > >(result));
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","add", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
+  {
+    std::vector<int,std::allocator< int > > *ptr = (std::vector<int,std::allocator< int > > *)0;
+    res3 = swig::asptr(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< int,std::allocator< int > > const &","add", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< int,std::allocator< int > > const &","add", 3, argv[1])); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      result = (int)(arg1)->add(arg2,(std::vector< int,std::allocator< int > > const &)*arg3);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return vresult;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_set_from_float_array(int argc, VALUE *argv, VALUE self) {
-  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
-  std::vector< float,std::allocator< float > > *arg2 = 0 ;
+_wrap_SceneIndex_size(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
+  int result;
+  VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","set_from_float_array", 1, self )); 
-  }
-  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
-  {
-    std::vector<float,std::allocator< float > > *ptr = (std::vector<float,std::allocator< float > > *)0;
-    res2 = swig::asptr(argv[0], &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< float,std::allocator< float > > const &","set_from_float_array", 2, argv[0] )); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< float,std::allocator< float > > const &","set_from_float_array", 2, argv[0])); 
-    }
-    arg2 = ptr;
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex const *","size", 1, self )); 
   }
-  (arg1)->set_from_float_array((std::vector< float,std::allocator< float > > const &)*arg2);
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  return Qnil;
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  result = (int)((histogroup::SceneIndex const *)arg1)->size();
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
 fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_compute_from_image_file(int argc, VALUE *argv, VALUE self) {
-  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
-  char *arg2 = (char *) 0 ;
+_wrap_SceneIndex_cell_count(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","compute_from_image_file", 1, self )); 
-  }
-  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","compute_from_image_file", 2, argv[0] ));
-  }
-  arg2 = reinterpret_cast< char * >(buf2);
-  {
-    try {
-      (arg1)->compute_from_image_file((char const *)arg2);
-    }
-    catch(cimg_library::CImgIOException &cioe) {
-      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
-      rb_raise(cimgerror, cioe.what());
-    }
-    catch(cimg_library::CImgInstanceException &cie) {
-      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
-      rb_raise(cimgerror, cie.what());
-    }
-    catch(cimg_library::CImgException &ce) {
-      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
-      rb_raise(cimgerror, ce.what());
-    }
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex const *","cell_count", 1, self )); 
   }
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  return Qnil;
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
+  result = (int)((histogroup::SceneIndex const *)arg1)->cell_count();
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_compare(int argc, VALUE *argv, VALUE self) {
-  histogroup::Fingerprint *arg1 = (histogroup::Fingerprint *) 0 ;
+_wrap_SceneIndex_search(int argc, VALUE *argv, VALUE self) {
+  histogroup::SceneIndex *arg1 = (histogroup::SceneIndex *) 0 ;
   histogroup::Fingerprint *arg2 = (histogroup::Fingerprint *) 0 ;
+  std::vector< int,std::allocator< int > > *arg3 = 0 ;
+  double arg4 ;
+  double arg5 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 = 0 ;
   int res2 = 0 ;
-  double result;
+  int res3 = SWIG_OLDOBJ ;
+  double val4 ;
+  int ecode4 = 0 ;
+  double val5 ;
+  int ecode5 = 0 ;
+  std::vector< int,std::allocator< int > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_histogroup__SceneIndex, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","compare", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "histogroup::SceneIndex *","search", 1, self )); 
   }
-  arg1 = reinterpret_cast< histogroup::Fingerprint * >(argp1);
+  arg1 = reinterpret_cast< histogroup::SceneIndex * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_histogroup__Fingerprint, 0 |  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","compare", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "histogroup::Fingerprint *","search", 2, argv[0] )); 
   }
   arg2 = reinterpret_cast< histogroup::Fingerprint * >(argp2);
-  result = (double)(arg1)->compare(arg2);
-  vresult = SWIG_From_double(static_cast< double >(result));
+  {
+    std::vector<int,std::allocator< int > > *ptr = (std::vector<int,std::allocator< int > > *)0;
+    res3 = swig::asptr(argv[1], &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::vector< int,std::allocator< int > > const &","search", 3, argv[1] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< int,std::allocator< int > > const &","search", 3, argv[1])); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_double(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "double","search", 4, argv[2] ));
+  } 
+  arg4 = static_cast< double >(val4);
+  ecode5 = SWIG_AsVal_double(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "double","search", 5, argv[3] ));
+  } 
+  arg5 = static_cast< double >(val5);
+  {
+    try {
+      result = (arg1)->search(arg2,(std::vector< int,std::allocator< int > > const &)*arg3,arg4,arg5);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("HistogroupError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return vresult;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return Qnil;
 }
 
 
+SWIGINTERN void
+free_histogroup_SceneIndex(histogroup::SceneIndex *arg1) {
+    delete arg1;
+}
+
 
 /* -------- TYPE CONVERSION AND EQUIVALENCE RULES (BEGIN) -------- */
 
@@ -10995,10 +16137,22 @@ static void *_p_swig__IteratorTo_p_swig__ConstIterator(void *x, int *SWIGUNUSEDP
 static swig_type_info _swigt__p_allocator_type = {"_p_allocator_type", "allocator_type *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_char = {"_p_char", "char *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_difference_type = {"_p_difference_type", "difference_type *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_double = {"_p_double", "double *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_float = {"_p_float", "float *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_histogroup__Fingerprint = {"_p_histogroup__Fingerprint", "histogroup::Fingerprint *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_histogroup__Groups = {"_p_histogroup__Groups", "histogroup::Groups *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_histogroup__Index = {"_p_histogroup__Index", "histogroup::Index *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_histogroup__PartitionStats = {"_p_histogroup__PartitionStats", "histogroup::PartitionStats *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_histogroup__PartitionedIndex = {"_p_histogroup__PartitionedIndex", "histogroup::PartitionedIndex *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_histogroup__SceneIndex = {"_p_histogroup__SceneIndex", "histogroup::SceneIndex *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_image_io__DecodeOptions = {"_p_image_io__DecodeOptions", "image_io::DecodeOptions *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_image_io__image_format = {"_p_image_io__image_format", "enum image_io::image_format *|image_io::image_format *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_int = {"_p_int", "intptr_t *|int *|int_least32_t *|int_fast32_t *|int32_t *|int_fast16_t *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_long_long = {"_p_long_long", "int_least64_t *|int_fast64_t *|int64_t *|long long *|intmax_t *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_p_float = {"_p_p_float", "float **", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_p_void = {"_p_p_void", "void **|VALUE *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_short = {"_p_short", "short *|int_least16_t *|int16_t *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_signed_char = {"_p_signed_char", "signed char *|int_least8_t *|int_fast8_t *|int8_t *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_size_type = {"_p_size_type", "size_type *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__vectorT_float_std__allocatorT_float_t_t = {"_p_std__vectorT_float_std__allocatorT_float_t_t", "std::vector< float > *|std::vector< float,std::allocator< float > > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__vectorT_float_std__allocatorT_float_t_t__allocator_type = {"_p_std__vectorT_float_std__allocatorT_float_t_t__allocator_type", "std::vector< float >::allocator_type *|std::allocator< float > *", 0, 0, (void*)0, 0};
@@ -11007,16 +16161,32 @@ static swig_type_info _swigt__p_std__vectorT_int_std__allocatorT_int_t_t__alloca
 static swig_type_info _swigt__p_swig__ConstIterator = {"_p_swig__ConstIterator", "swig::ConstIterator *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_swig__GC_VALUE = {"_p_swig__GC_VALUE", "swig::GC_VALUE *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_swig__Iterator = {"_p_swig__Iterator", "swig::Iterator *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_unsigned_char = {"_p_unsigned_char", "unsigned char *|uint_least8_t *|uint_fast8_t *|uint8_t *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_unsigned_int = {"_p_unsigned_int", "uintptr_t *|uint_least32_t *|uint_fast32_t *|uint32_t *|unsigned int *|uint_fast16_t *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_unsigned_long_long = {"_p_unsigned_long_long", "uint_least64_t *|uint_fast64_t *|uint64_t *|unsigned long long *|uintmax_t *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_unsigned_short = {"_p_unsigned_short", "unsigned short *|uint_least16_t *|uint16_t *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_value_type = {"_p_value_type", "value_type *", 0, 0, (void*)0, 0};
 
 static swig_type_info *swig_type_initial[] = {
   &_swigt__p_allocator_type,
   &_swigt__p_char,
   &_swigt__p_difference_type,
+  &_swigt__p_double,
   &_swigt__p_float,
   &_swigt__p_histogroup__Fingerprint,
+  &_swigt__p_histogroup__Groups,
+  &_swigt__p_histogroup__Index,
+  &_swigt__p_histogroup__PartitionStats,
+  &_swigt__p_histogroup__PartitionedIndex,
+  &_swigt__p_histogroup__SceneIndex,
+  &_swigt__p_image_io__DecodeOptions,
+  &_swigt__p_image_io__image_format,
+  &_swigt__p_int,
+  &_swigt__p_long_long,
   &_swigt__p_p_float,
   &_swigt__p_p_void,
+  &_swigt__p_short,
+  &_swigt__p_signed_char,
   &_swigt__p_size_type,
   &_swigt__p_std__vectorT_float_std__allocatorT_float_t_t,
   &_swigt__p_std__vectorT_float_std__allocatorT_float_t_t__allocator_type,
@@ -11025,16 +16195,32 @@ static swig_type_info *swig_type_initial[] = {
   &_swigt__p_swig__ConstIterator,
   &_swigt__p_swig__GC_VALUE,
   &_swigt__p_swig__Iterator,
+  &_swigt__p_unsigned_char,
+  &_swigt__p_unsigned_int,
+  &_swigt__p_unsigned_long_long,
+  &_swigt__p_unsigned_short,
   &_swigt__p_value_type,
 };
 
 static swig_cast_info _swigc__p_allocator_type[] = {  {&_swigt__p_allocator_type, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_char[] = {  {&_swigt__p_char, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_difference_type[] = {  {&_swigt__p_difference_type, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_double[] = {  {&_swigt__p_double, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_float[] = {  {&_swigt__p_float, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_histogroup__Fingerprint[] = {  {&_swigt__p_histogroup__Fingerprint, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_histogroup__Groups[] = {  {&_swigt__p_histogroup__Groups, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_histogroup__Index[] = {  {&_swigt__p_histogroup__Index, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_histogroup__PartitionStats[] = {  {&_swigt__p_histogroup__PartitionStats, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_histogroup__PartitionedIndex[] = {  {&_swigt__p_histogroup__PartitionedIndex, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_histogroup__SceneIndex[] = {  {&_swigt__p_histogroup__SceneIndex, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_image_io__DecodeOptions[] = {  {&_swigt__p_image_io__DecodeOptions, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_image_io__image_format[] = {  {&_swigt__p_image_io__image_format, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_int[] = {  {&_swigt__p_int, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_long_long[] = {  {&_swigt__p_long_long, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_p_float[] = {  {&_swigt__p_p_float, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_p_void[] = {  {&_swigt__p_p_void, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_short[] = {  {&_swigt__p_short, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_signed_char[] = {  {&_swigt__p_signed_char, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_size_type[] = {  {&_swigt__p_size_type, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__vectorT_float_std__allocatorT_float_t_t[] = {  {&_swigt__p_std__vectorT_float_std__allocatorT_float_t_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__vectorT_float_std__allocatorT_float_t_t__allocator_type[] = {  {&_swigt__p_std__vectorT_float_std__allocatorT_float_t_t__allocator_type, 0, 0, 0},{0, 0, 0, 0}};
@@ -11043,16 +16229,32 @@ static swig_cast_info _swigc__p_std__vectorT_int_std__allocatorT_int_t_t__alloca
 static swig_cast_info _swigc__p_swig__ConstIterator[] = {  {&_swigt__p_swig__ConstIterator, 0, 0, 0},  {&_swigt__p_swig__Iterator, _p_swig__IteratorTo_p_swig__ConstIterator, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_swig__GC_VALUE[] = {  {&_swigt__p_swig__GC_VALUE, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_swig__Iterator[] = {  {&_swigt__p_swig__Iterator, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_unsigned_char[] = {  {&_swigt__p_unsigned_char, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_unsigned_int[] = {  {&_swigt__p_unsigned_int, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_unsigned_long_long[] = {  {&_swigt__p_unsigned_long_long, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_unsigned_short[] = {  {&_swigt__p_unsigned_short, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_value_type[] = {  {&_swigt__p_value_type, 0, 0, 0},{0, 0, 0, 0}};
 
 static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_allocator_type,
   _swigc__p_char,
   _swigc__p_difference_type,
+  _swigc__p_double,
   _swigc__p_float,
   _swigc__p_histogroup__Fingerprint,
+  _swigc__p_histogroup__Groups,
+  _swigc__p_histogroup__Index,
+  _swigc__p_histogroup__PartitionStats,
+  _swigc__p_histogroup__PartitionedIndex,
+  _swigc__p_histogroup__SceneIndex,
+  _swigc__p_image_io__DecodeOptions,
+  _swigc__p_image_io__image_format,
+  _swigc__p_int,
+  _swigc__p_long_long,
   _swigc__p_p_float,
   _swigc__p_p_void,
+  _swigc__p_short,
+  _swigc__p_signed_char,
   _swigc__p_size_type,
   _swigc__p_std__vectorT_float_std__allocatorT_float_t_t,
   _swigc__p_std__vectorT_float_std__allocatorT_float_t_t__allocator_type,
@@ -11061,6 +16263,10 @@ static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_swig__ConstIterator,
   _swigc__p_swig__GC_VALUE,
   _swigc__p_swig__Iterator,
+  _swigc__p_unsigned_char,
+  _swigc__p_unsigned_int,
+  _swigc__p_unsigned_long_long,
+  _swigc__p_unsigned_short,
   _swigc__p_value_type,
 };
 
@@ -11323,6 +16529,11 @@ SWIGEXPORT void Init_histogroup(void) {
   
   SWIG_RubyInitializeTrackings();
   
+#if defined(HAVE_RB_THREAD_CALL_WITHOUT_GVL) || defined(HAVE_RB_THREAD_BLOCKING_REGION)
+  image_io::set_blocking_runner(run_without_gvl);
+#endif
+  rb_define_class("HistogroupError", rb_eStandardError);
+  
   SwigClassGC_VALUE.klass = rb_define_class_under(mHistogroup, "GC_VALUE", rb_cObject);
   SWIG_TypeClientData(SWIGTYPE_p_swig__GC_VALUE, (void *) &SwigClassGC_VALUE);
   rb_undef_alloc_func(SwigClassGC_VALUE.klass);
@@ -11464,10 +16675,47 @@ SWIGEXPORT void Init_histogroup(void) {
   rb_define_const(mHistogroup, "Cimg_debug", SWIG_From_int(static_cast< int >(0)));
   rb_define_const(mHistogroup, "Cimg_display", SWIG_From_int(static_cast< int >(0)));
   rb_define_const(mHistogroup, "Cimg_verbosity", SWIG_From_int(static_cast< int >(1)));
+  rb_define_singleton_method(mHistogroup, "sniff_length", VALUEFUNC(_wrap_sniff_length_get), 0);
+  rb_define_const(mHistogroup, "Format_unknown", SWIG_From_int(static_cast< int >(image_io::format_unknown)));
+  rb_define_const(mHistogroup, "Format_jpeg", SWIG_From_int(static_cast< int >(image_io::format_jpeg)));
+  rb_define_const(mHistogroup, "Format_png", SWIG_From_int(static_cast< int >(image_io::format_png)));
+  rb_define_const(mHistogroup, "Format_tiff", SWIG_From_int(static_cast< int >(image_io::format_tiff)));
+  
+  SwigClassDecodeOptions.klass = rb_define_class_under(mHistogroup, "DecodeOptions", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_image_io__DecodeOptions, (void *) &SwigClassDecodeOptions);
+  rb_define_alloc_func(SwigClassDecodeOptions.klass, _wrap_DecodeOptions_allocate);
+  rb_define_method(SwigClassDecodeOptions.klass, "initialize", VALUEFUNC(_wrap_new_DecodeOptions), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "max_pixels=", VALUEFUNC(_wrap_DecodeOptions_max_pixels_set), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "max_pixels", VALUEFUNC(_wrap_DecodeOptions_max_pixels_get), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "min_dim=", VALUEFUNC(_wrap_DecodeOptions_min_dim_set), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "min_dim", VALUEFUNC(_wrap_DecodeOptions_min_dim_get), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "memory_cap=", VALUEFUNC(_wrap_DecodeOptions_memory_cap_set), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "memory_cap", VALUEFUNC(_wrap_DecodeOptions_memory_cap_get), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "preview_min_dim=", VALUEFUNC(_wrap_DecodeOptions_preview_min_dim_set), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "preview_min_dim", VALUEFUNC(_wrap_DecodeOptions_preview_min_dim_get), -1);
+  SwigClassDecodeOptions.mark = 0;
+  SwigClassDecodeOptions.destroy = (void (*)(void *)) free_image_io_DecodeOptions;
+  SwigClassDecodeOptions.trackObjects = 0;
+  rb_define_singleton_method(mHistogroup, "load_ok", VALUEFUNC(_wrap_load_ok_get), 0);
+  rb_define_singleton_method(mHistogroup, "error_arguments", VALUEFUNC(_wrap_error_arguments_get), 0);
+  rb_define_singleton_method(mHistogroup, "error_open", VALUEFUNC(_wrap_error_open_get), 0);
+  rb_define_singleton_method(mHistogroup, "error_unknown_format", VALUEFUNC(_wrap_error_unknown_format_get), 0);
+  rb_define_singleton_method(mHistogroup, "error_decode", VALUEFUNC(_wrap_error_decode_get), 0);
+  rb_define_singleton_method(mHistogroup, "error_too_large", VALUEFUNC(_wrap_error_too_large_get), 0);
+  rb_define_singleton_method(mHistogroup, "error_not_streamable", VALUEFUNC(_wrap_error_not_streamable_get), 0);
+  rb_define_singleton_method(mHistogroup, "error_needs_file", VALUEFUNC(_wrap_error_needs_file_get), 0);
+  rb_define_module_function(mHistogroup, "sniff_file_format", VALUEFUNC(_wrap_sniff_file_format), -1);
   rb_define_singleton_method(mHistogroup, "default_hash_size_in_bins", VALUEFUNC(_wrap_default_hash_size_in_bins_get), 0);
   rb_define_singleton_method(mHistogroup, "default_hash_size_in_bytes", VALUEFUNC(_wrap_default_hash_size_in_bytes_get), 0);
+  rb_define_singleton_method(mHistogroup, "pixels_per_histogram_thread", VALUEFUNC(_wrap_pixels_per_histogram_thread_get), 0);
   rb_define_module_function(mHistogroup, "compute_image_hash", VALUEFUNC(_wrap_compute_image_hash), -1);
   rb_define_module_function(mHistogroup, "compare_chisquare", VALUEFUNC(_wrap_compare_chisquare), -1);
+  rb_define_module_function(mHistogroup, "embed_hash", VALUEFUNC(_wrap_embed_hash), -1);
+  rb_define_module_function(mHistogroup, "embedding_distance", VALUEFUNC(_wrap_embedding_distance), -1);
+  rb_define_module_function(mHistogroup, "compare_quantized", VALUEFUNC(_wrap_compare_quantized), -1);
+  rb_define_module_function(mHistogroup, "compare_many", VALUEFUNC(_wrap_compare_many), -1);
+  rb_define_module_function(mHistogroup, "match_many", VALUEFUNC(_wrap_match_many), -1);
+  rb_define_module_function(mHistogroup, "compare_chisquare_many", VALUEFUNC(_wrap_compare_chisquare_many), -1);
   rb_define_module_function(mHistogroup, "read_hash_from_text", VALUEFUNC(_wrap_read_hash_from_text), -1);
   
   SwigClassFingerprint.klass = rb_define_class_under(mHistogroup, "Fingerprint", rb_cObject);
@@ -11478,12 +16726,122 @@ SWIGEXPORT void Init_histogroup(void) {
   rb_define_method(SwigClassFingerprint.klass, "contents", VALUEFUNC(_wrap_Fingerprint_contents_get), -1);
   rb_define_method(SwigClassFingerprint.klass, "bins_per_band=", VALUEFUNC(_wrap_Fingerprint_bins_per_band_set), -1);
   rb_define_method(SwigClassFingerprint.klass, "bins_per_band", VALUEFUNC(_wrap_Fingerprint_bins_per_band_get), -1);
+  rb_define_method(SwigClassFingerprint.klass, "decode_options=", VALUEFUNC(_wrap_Fingerprint_decode_options_set), -1);
+  rb_define_method(SwigClassFingerprint.klass, "decode_options", VALUEFUNC(_wrap_Fingerprint_decode_options_get), -1);
+  rb_define_method(SwigClassFingerprint.klass, "threads=", VALUEFUNC(_wrap_Fingerprint_threads_set), -1);
+  rb_define_method(SwigClassFingerprint.klass, "threads", VALUEFUNC(_wrap_Fingerprint_threads_get), -1);
+  rb_define_method(SwigClassFingerprint.klass, "sample_budget=", VALUEFUNC(_wrap_Fingerprint_sample_budget_set), -1);
+  rb_define_method(SwigClassFingerprint.klass, "sample_budget", VALUEFUNC(_wrap_Fingerprint_sample_budget_get), -1);
+  rb_define_method(SwigClassFingerprint.klass, "drift_bound=", VALUEFUNC(_wrap_Fingerprint_drift_bound_set), -1);
+  rb_define_method(SwigClassFingerprint.klass, "drift_bound", VALUEFUNC(_wrap_Fingerprint_drift_bound_get), -1);
   rb_define_method(SwigClassFingerprint.klass, "as_float_array", VALUEFUNC(_wrap_Fingerprint_as_float_array), -1);
   rb_define_method(SwigClassFingerprint.klass, "set_from_float_array", VALUEFUNC(_wrap_Fingerprint_set_from_float_array), -1);
+  rb_define_method(SwigClassFingerprint.klass, "as_quantized", VALUEFUNC(_wrap_Fingerprint_as_quantized), -1);
+  rb_define_method(SwigClassFingerprint.klass, "set_from_quantized", VALUEFUNC(_wrap_Fingerprint_set_from_quantized), -1);
   rb_define_method(SwigClassFingerprint.klass, "compute_from_image_file", VALUEFUNC(_wrap_Fingerprint_compute_from_image_file), -1);
   rb_define_method(SwigClassFingerprint.klass, "compare", VALUEFUNC(_wrap_Fingerprint_compare), -1);
   SwigClassFingerprint.mark = 0;
   SwigClassFingerprint.destroy = (void (*)(void *)) free_histogroup_Fingerprint;
   SwigClassFingerprint.trackObjects = 0;
+  
+  SwigClassIndex.klass = rb_define_class_under(mHistogroup, "Index", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_histogroup__Index, (void *) &SwigClassIndex);
+  rb_define_alloc_func(SwigClassIndex.klass, _wrap_Index_allocate);
+  rb_define_method(SwigClassIndex.klass, "initialize", VALUEFUNC(_wrap_new_Index), -1);
+  rb_define_method(SwigClassIndex.klass, "bins_per_band=", VALUEFUNC(_wrap_Index_bins_per_band_set), -1);
+  rb_define_method(SwigClassIndex.klass, "bins_per_band", VALUEFUNC(_wrap_Index_bins_per_band_get), -1);
+  rb_define_method(SwigClassIndex.klass, "coarse_bins_per_band=", VALUEFUNC(_wrap_Index_coarse_bins_per_band_set), -1);
+  rb_define_method(SwigClassIndex.klass, "coarse_bins_per_band", VALUEFUNC(_wrap_Index_coarse_bins_per_band_get), -1);
+  rb_define_method(SwigClassIndex.klass, "pivots=", VALUEFUNC(_wrap_Index_pivots_set), -1);
+  rb_define_method(SwigClassIndex.klass, "pivots", VALUEFUNC(_wrap_Index_pivots_get), -1);
+  rb_define_method(SwigClassIndex.klass, "verified=", VALUEFUNC(_wrap_Index_verified_set), -1);
+  rb_define_method(SwigClassIndex.klass, "verified", VALUEFUNC(_wrap_Index_verified_get), -1);
+  rb_define_method(SwigClassIndex.klass, "add", VALUEFUNC(_wrap_Index_add), -1);
+  rb_define_method(SwigClassIndex.klass, "size", VALUEFUNC(_wrap_Index_size), -1);
+  rb_define_method(SwigClassIndex.klass, "search", VALUEFUNC(_wrap_Index_search), -1);
+  rb_define_method(SwigClassIndex.klass, "prepare", VALUEFUNC(_wrap_Index_prepare), -1);
+  SwigClassIndex.mark = 0;
+  SwigClassIndex.destroy = (void (*)(void *)) free_histogroup_Index;
+  SwigClassIndex.trackObjects = 0;
+  
+  SwigClassGroups.klass = rb_define_class_under(mHistogroup, "Groups", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_histogroup__Groups, (void *) &SwigClassGroups);
+  rb_define_alloc_func(SwigClassGroups.klass, _wrap_Groups_allocate);
+  rb_define_method(SwigClassGroups.klass, "initialize", VALUEFUNC(_wrap_new_Groups), -1);
+  rb_define_method(SwigClassGroups.klass, "radius=", VALUEFUNC(_wrap_Groups_radius_set), -1);
+  rb_define_method(SwigClassGroups.klass, "radius", VALUEFUNC(_wrap_Groups_radius_get), -1);
+  rb_define_method(SwigClassGroups.klass, "min_members=", VALUEFUNC(_wrap_Groups_min_members_set), -1);
+  rb_define_method(SwigClassGroups.klass, "min_members", VALUEFUNC(_wrap_Groups_min_members_get), -1);
+  rb_define_method(SwigClassGroups.klass, "threads=", VALUEFUNC(_wrap_Groups_threads_set), -1);
+  rb_define_method(SwigClassGroups.klass, "threads", VALUEFUNC(_wrap_Groups_threads_get), -1);
+  rb_define_method(SwigClassGroups.klass, "group_count=", VALUEFUNC(_wrap_Groups_group_count_set), -1);
+  rb_define_method(SwigClassGroups.klass, "group_count", VALUEFUNC(_wrap_Groups_group_count_get), -1);
+  rb_define_method(SwigClassGroups.klass, "add", VALUEFUNC(_wrap_Groups_add), -1);
+  rb_define_method(SwigClassGroups.klass, "size", VALUEFUNC(_wrap_Groups_size), -1);
+  rb_define_method(SwigClassGroups.klass, "cluster", VALUEFUNC(_wrap_Groups_cluster), -1);
+  rb_define_method(SwigClassGroups.klass, "assign", VALUEFUNC(_wrap_Groups_assign), -1);
+  rb_define_method(SwigClassGroups.klass, "labels", VALUEFUNC(_wrap_Groups_labels), -1);
+  SwigClassGroups.mark = 0;
+  SwigClassGroups.destroy = (void (*)(void *)) free_histogroup_Groups;
+  SwigClassGroups.trackObjects = 0;
+  
+  SwigClassPartitionStats.klass = rb_define_class_under(mHistogroup, "PartitionStats", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_histogroup__PartitionStats, (void *) &SwigClassPartitionStats);
+  rb_define_alloc_func(SwigClassPartitionStats.klass, _wrap_PartitionStats_allocate);
+  rb_define_method(SwigClassPartitionStats.klass, "initialize", VALUEFUNC(_wrap_new_PartitionStats), -1);
+  rb_define_method(SwigClassPartitionStats.klass, "key=", VALUEFUNC(_wrap_PartitionStats_key_set), -1);
+  rb_define_method(SwigClassPartitionStats.klass, "key", VALUEFUNC(_wrap_PartitionStats_key_get), -1);
+  rb_define_method(SwigClassPartitionStats.klass, "count=", VALUEFUNC(_wrap_PartitionStats_count_set), -1);
+  rb_define_method(SwigClassPartitionStats.klass, "count", VALUEFUNC(_wrap_PartitionStats_count_get), -1);
+  rb_define_method(SwigClassPartitionStats.klass, "first_time=", VALUEFUNC(_wrap_PartitionStats_first_time_set), -1);
+  rb_define_method(SwigClassPartitionStats.klass, "first_time", VALUEFUNC(_wrap_PartitionStats_first_time_get), -1);
+  rb_define_method(SwigClassPartitionStats.klass, "last_time=", VALUEFUNC(_wrap_PartitionStats_last_time_set), -1);
+  rb_define_method(SwigClassPartitionStats.klass, "last_time", VALUEFUNC(_wrap_PartitionStats_last_time_get), -1);
+  rb_define_method(SwigClassPartitionStats.klass, "bytes=", VALUEFUNC(_wrap_PartitionStats_bytes_set), -1);
+  rb_define_method(SwigClassPartitionStats.klass, "bytes", VALUEFUNC(_wrap_PartitionStats_bytes_get), -1);
+  SwigClassPartitionStats.mark = 0;
+  SwigClassPartitionStats.destroy = (void (*)(void *)) free_histogroup_PartitionStats;
+  SwigClassPartitionStats.trackObjects = 0;
+  
+  SwigClassPartitionedIndex.klass = rb_define_class_under(mHistogroup, "PartitionedIndex", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_histogroup__PartitionedIndex, (void *) &SwigClassPartitionedIndex);
+  rb_define_alloc_func(SwigClassPartitionedIndex.klass, _wrap_PartitionedIndex_allocate);
+  rb_define_method(SwigClassPartitionedIndex.klass, "initialize", VALUEFUNC(_wrap_new_PartitionedIndex), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "bins_per_band=", VALUEFUNC(_wrap_PartitionedIndex_bins_per_band_set), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "bins_per_band", VALUEFUNC(_wrap_PartitionedIndex_bins_per_band_get), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "partitions_searched=", VALUEFUNC(_wrap_PartitionedIndex_partitions_searched_set), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "partitions_searched", VALUEFUNC(_wrap_PartitionedIndex_partitions_searched_get), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "verified=", VALUEFUNC(_wrap_PartitionedIndex_verified_set), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "verified", VALUEFUNC(_wrap_PartitionedIndex_verified_get), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "add", VALUEFUNC(_wrap_PartitionedIndex_add), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "size", VALUEFUNC(_wrap_PartitionedIndex_size), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "keys", VALUEFUNC(_wrap_PartitionedIndex_keys), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "statistics", VALUEFUNC(_wrap_PartitionedIndex_statistics), -1);
+  rb_define_method(SwigClassPartitionedIndex.klass, "search", VALUEFUNC(_wrap_PartitionedIndex_search), -1);
+  SwigClassPartitionedIndex.mark = 0;
+  SwigClassPartitionedIndex.destroy = (void (*)(void *)) free_histogroup_PartitionedIndex;
+  SwigClassPartitionedIndex.trackObjects = 0;
+  
+  SwigClassSceneIndex.klass = rb_define_class_under(mHistogroup, "SceneIndex", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_histogroup__SceneIndex, (void *) &SwigClassSceneIndex);
+  rb_define_alloc_func(SwigClassSceneIndex.klass, _wrap_SceneIndex_allocate);
+  rb_define_method(SwigClassSceneIndex.klass, "initialize", VALUEFUNC(_wrap_new_SceneIndex), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "bins_per_band=", VALUEFUNC(_wrap_SceneIndex_bins_per_band_set), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "bins_per_band", VALUEFUNC(_wrap_SceneIndex_bins_per_band_get), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "mwisd_size_in_bytes=", VALUEFUNC(_wrap_SceneIndex_mwisd_size_in_bytes_set), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "mwisd_size_in_bytes", VALUEFUNC(_wrap_SceneIndex_mwisd_size_in_bytes_get), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "cell_levels=", VALUEFUNC(_wrap_SceneIndex_cell_levels_set), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "cell_levels", VALUEFUNC(_wrap_SceneIndex_cell_levels_get), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "cells_probed=", VALUEFUNC(_wrap_SceneIndex_cells_probed_set), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "cells_probed", VALUEFUNC(_wrap_SceneIndex_cells_probed_get), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "verified=", VALUEFUNC(_wrap_SceneIndex_verified_set), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "verified", VALUEFUNC(_wrap_SceneIndex_verified_get), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "add", VALUEFUNC(_wrap_SceneIndex_add), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "size", VALUEFUNC(_wrap_SceneIndex_size), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "cell_count", VALUEFUNC(_wrap_SceneIndex_cell_count), -1);
+  rb_define_method(SwigClassSceneIndex.klass, "search", VALUEFUNC(_wrap_SceneIndex_search), -1);
+  SwigClassSceneIndex.mark = 0;
+  SwigClassSceneIndex.destroy = (void (*)(void *)) free_histogroup_SceneIndex;
+  SwigClassSceneIndex.trackObjects = 0;
 }
 
@@ -29,6 +29,12 @@ have_library('png', 'png_sig_cmp') || missing('libpng')
 have_library('jpeg', 'jpeg_set_defaults') || missing('libjpeg')
 
 have_library('tiff', 'TIFFSetDirectory') || missing('libtiff')
+# Fingerprinting and index searches run without the GVL where Ruby allows
+# (see image_io::run_blocking()).
+have_header('ruby/thread.h')
+have_func('rb_thread_call_without_gvl', 'ruby/thread.h') or
+  have_func('rb_thread_blocking_region')
+
 
 # For some reason, mkmf falls back to using gcc to link c++ binaries.
 # Use a big hammer and force it to use g++ for everything.
@@ -48,6 +54,19 @@ if have_library('X11')
   RbConfig::MAKEFILE_CONFIG['LDSHAREDXX'] << " -pthread -lX11"
 end
 
+# mwisd_fp and histogroup both wrap a class named Fingerprint:  keep each
+# extension's symbols (SWIG's class records among them) to itself, so both
+# may be loaded in one process.  Init_* stays visible via SWIGEXPORT.
+$CPPFLAGS << " -fvisibility=hidden -DGCC_HASCLASSVISIBILITY"
+
+# Sources shared by all fingerprint types (image loading, etc.) live in
+# ext/common and are compiled into each extension.
+COMMON_DIR = File.expand_path('../common', File.dirname(__FILE__))
+$INCFLAGS << " -I#{COMMON_DIR}"
+$VPATH << COMMON_DIR
+$srcs = Dir.glob(File.join($srcdir, '*.{c,cpp,cxx}')).map { |f| File.basename(f) } +
+        Dir.glob(File.join(COMMON_DIR, '*.cpp')).map { |f| File.basename(f) }
+
 # Why does this fail, even when explicitly giving the correct path?
 # It's found just fine during compilation.
 #unless find_header('CImg.h')
@@ -10,9 +10,12 @@
 #define cimg_display 0
 
 #include "mwisd_fp.h"
+#include "image_io.h"
+#include "scanline_reader.h"
 #include "popcounts.h"
 #include "CImg.h"
 #include <math.h>
+#include <algorithm>
 
 #ifdef DEBUG
 #include <iostream.h>
@@ -22,50 +25,386 @@ using namespace cimg_library;
 
 #define cimg_display 0
 
+// Slots of the thread's image_io::ComputeContext used here.
+enum { context_original = 0, context_grayscale = 1 };
+enum { context_norm = 0, context_mask = 1, context_filtered = 2, \
+    context_heat_map = 3 };
+
 int mwisd_fp::compute_image_hash(const char *filename, uint16_t* &hash, \
         int hash_size_in_bytes, int wavelet_scale_base, \
-        int wavelet_scale_exponent) {
+        int wavelet_scale_exponent, const image_io::DecodeOptions &options) {
     // Recommended:  wavelet_scale_base=2, wavelet_scale_exponent=1
+    return compute_image_hashes(filename, &hash, &hash_size_in_bytes, 1, \
+            wavelet_scale_base, wavelet_scale_exponent, options);
+}
+
+
+int mwisd_fp::compute_image_hashes(const char *filename, uint16_t **hashes, \
+        const int *hash_sizes_in_bytes, int count, int wavelet_scale_base, \
+        int wavelet_scale_exponent, const image_io::DecodeOptions &options) {
+    // Computes fingerprints of several sizes (e.g. a small one for in-RAM
+    // filtering plus a large one for verification) from a single decode and
+    // wavelet transform:  the heat map is computed at the finest grid needed
+    // and coarser fingerprints collapse it.
 
     // Input sanity check.
-    if( filename == NULL || wavelet_scale_exponent < 0 ) {
-        // Invalid method call parameters.
+    if( hashes == NULL || hash_sizes_in_bytes == NULL || count < 1 ) {
         return -1;
     }
+    int heat_map_dim = 0;
+    for( int index=0; index < count; index++ ) {
+        int width, height;
+        if( hashes[index] == NULL || \
+                hash_layout(hash_sizes_in_bytes[index], width, height) < 1 ) {
+            return -1;
+        }
+        heat_map_dim = std::max(heat_map_dim, width);
+    }
+    for( int index=0; index < count; index++ ) {
+        int width, height;
+        hash_layout(hash_sizes_in_bytes[index], width, height);
+        if( (heat_map_dim % width) != 0 || (heat_map_dim % height) != 0 ) {
+            // Only power-of-two layouts nest within one another.
+            return -1;
+        }
+    }
 
-    int original_width, original_height;
-    // Load original image into CImg structure.
-    CImg<uint8_t> original_image(filename);
+    CImg<float> &heat_map_values = \
+        image_io::thread_compute_context().floats(context_heat_map);
+    heat_map_values.assign(heat_map_dim, heat_map_dim);
+    float *heat_map = heat_map_values.data();
+    int retval = compute_image_heat_map(filename, heat_map, heat_map_dim, \
+            wavelet_scale_base, wavelet_scale_exponent, options);
+    if( retval < 1 ) {
+        return retval;
+    }
 
-    original_width = original_image.width();
-    original_height = original_image.height();
+    for( int index=0; index < count; index++ ) {
+        retval = hash_from_heat_map(heat_map, heat_map_dim, hashes[index], \
+                hash_sizes_in_bytes[index], default_block_dim, threshold_mean);
+        if( retval < 1 ) {
+            return retval;
+        }
+    }
+    return 1;
+}
 
-    if( not ((original_width > 0) && \
-            (original_height > 0) && \
-            (original_image.depth() == 1)) ) {
-        // Input image is in an incompatible format.
-        return 0;
+
+int mwisd_fp::hash_layout(int hash_size_in_bytes, int &heat_map_width, \
+        int &heat_map_height) {
+    // One heat map cell per fingerprint bit, arranged as close to square as
+    // possible:  e.g. 256 bits -> 16x16, 1024 bits -> 32x32 (the classic
+    // layout), 2048 bits -> 64x32.  Only power-of-two sizes are supported.
+    const int bits = 8 * hash_size_in_bytes;
+    if( hash_size_in_bytes < 2 || (bits & (bits - 1)) != 0 ) {
+        heat_map_width = heat_map_height = 0;
+        return -1;
     }
 
-    CImg<uint8_t> grayscale_image;
+    int log2_bits = 0;
+    while( (1 << log2_bits) < bits ) {
+        ++log2_bits;
+    }
+    heat_map_height = 1 << (log2_bits / 2);
+    heat_map_width = bits / heat_map_height;
+    return 1;
+}
 
+
+// Standardized size (square) that images are resized to before the wavelet
+// transform.
+static int standard_resize_dim(int width, int height, int heat_map_dim) {
     int resize_dim;
 
-    if( original_width >= 512 && original_height >= 512 ) {
+    if( width >= 512 && height >= 512 ) {
         resize_dim = 512;
-    } else if( original_width >= 256 && original_height >= 256 ) {
+    } else if( width >= 256 && height >= 256 ) {
         resize_dim = 256;
-    } else if( original_width >= 128 && original_height >= 128) {
+    } else if( width >= 128 && height >= 128) {
         resize_dim = 128;
-    } else if( original_width >= 64 && original_height >= 64) {
+    } else if( width >= 64 && height >= 64) {
         resize_dim = 64;
     } else {
         resize_dim = 32;
     }
-    
+    // Heat map cells must each cover at least one pixel (upsizing if needed).
+    while( resize_dim < heat_map_dim ) {
+        resize_dim *= 2;
+    }
+    return resize_dim;
+}
+
+
+// Streams the image through a box filter into a grayscale image just large
+// enough for the resize in compute_image_heat_map() (at least resize_dim
+// pixels on its short side, twice that when memory_cap allows), so that only
+// a few decoded rows are ever in memory.  Pixels are converted to gray exactly
+// as the in-memory chain does (4-channel images keep luminance and alpha as
+// two planes); only the area averaging ahead of the final resize differs, so
+// fingerprints agree closely but not bit for bit.
+static int stream_reduced_grayscale(const char *filename, int resize_dim, \
+        const image_io::DecodeOptions &options, CImg<float> &reduced, \
+        int &spectrum) {
+    image_io::DecodeOptions stream_options = options;
+    stream_options.min_dim = 2 * resize_dim;
+    image_io::ScanlineReader reader;
+    int retval = reader.open(filename, stream_options);
+    if( retval != image_io::load_ok ) {
+        return retval;
+    }
+    const int width = reader.info.width, height = reader.info.height;
+    spectrum = reader.info.channels;
+    if( spectrum != 1 && spectrum != 3 && spectrum != 4 ) {
+        return 1;   // Like the in-memory chain, no grayscale image results.
+    }
+    const int planes = (spectrum == 4) ? 2 : 1;
+
+    const int short_side = std::min(width, height);
+    const int max_factor = std::max(1, short_side / resize_dim);
+    int factor = std::max(1, short_side / (2 * resize_dim));
+    const uint64_t budget = options.memory_cap / 2;
+    while( factor < max_factor && (uint64_t)((width + factor - 1) / factor) * \
+            ((height + factor - 1) / factor) * planes * 2 * sizeof(float) > \
+            budget ) {
+        ++factor;
+    }
+    const int reduced_width = (width + factor - 1) / factor;
+    const int reduced_height = (height + factor - 1) / factor;
+    reduced.assign(reduced_width, reduced_height, 1, planes, 0);
+
+    std::vector<uint16_t> row((size_t)width * spectrum);
+    std::vector<double> sums((size_t)reduced_width * planes, 0.0);
+    for( int y = 0; y < height; y++ ) {
+        if( (retval = reader.read_row(&row[0])) != 1 ) {
+            return (retval == 0) ? image_io::error_decode : retval;
+        }
+        const uint16_t *sample = &row[0];
+        for( int x = 0; x < width; x++, sample += spectrum ) {
+            // Samples pass through uint8_t, as in CImg<uint8_t>::load().
+            double *sum = &sums[(size_t)(x / factor) * planes];
+            if( spectrum == 3 ) {
+                const float r = (uint8_t)sample[0], g = (uint8_t)sample[1], \
+                    b = (uint8_t)sample[2];
+                sum[0] += std::sqrt(r*r + g*g + b*b);
+            } else if( spectrum == 4 ) {
+                const float r = (uint8_t)sample[0], g = (uint8_t)sample[1], \
+                    b = (uint8_t)sample[2];
+                const float luma = (66*r + 129*g + 25*b + 128)/256 + 16;
+                sum[0] += (uint8_t)(luma > 255 ? 255 : luma);
+                sum[1] += (uint8_t)sample[3];
+            } else {
+                sum[0] += (uint8_t)sample[0];
+            }
+        }
+        if( (y + 1) % factor == 0 || y + 1 == height ) {
+            const int rows = y % factor + 1;
+            for( int x = 0; x < reduced_width; x++ ) {
+                const int cols = std::min(factor, width - x * factor);
+                for( int c = 0; c < planes; c++ ) {
+                    double &sum = sums[(size_t)x * planes + c];
+                    reduced(x, y / factor, 0, c) = (float)(sum / (rows * cols));
+                    sum = 0.0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+
+// The L2 norm over channels of each pixel, as image.get_norm() computes it,
+// into norm's buffer.
+static void norm_into(const CImg<uint8_t> &image, CImg<float> &norm) {
+    const size_t pixels = (size_t)image.width() * image.height();
+    norm.assign(image.width(), image.height());
+    float *ptrd = norm.data();
+    for( size_t i = 0; i < pixels; i++ ) {
+        float n = 0;
+        for( int c = 0; c < image.spectrum(); c++ ) {
+            const float value = image[c*pixels + i];
+            n += value * value;
+        }
+        *(ptrd++) = std::sqrt(n);
+    }
+}
+
+
+// image.get_correlate(mask) for odd square masks, into filtered's buffer:
+// the same float sums in the same order as CImg's generic path, with
+// samples beyond the border replicating the nearest (Neumann boundary
+// conditions), so the result is bit for bit the same.
+static void correlate_into(const CImg<uint8_t> &image, const CImg<float> &mask, \
+        CImg<float> &filtered) {
+    const int width = image.width(), height = image.height();
+    const int half = mask.width() / 2;
+    filtered.assign(width, height, 1, image.spectrum());
+    cimg_forC(image, c) {
+        for( int y = 0; y < height; y++ ) {
+            const bool border_row = (y < half || y >= height - half);
+            for( int x = 0; x < width; x++ ) {
+                float val = 0;
+                if( border_row || x < half || x >= width - half ) {
+                    for( int ym = -half; ym <= half; ym++ ) {
+                        const int yy = std::min(std::max(y + ym, 0), height - 1);
+                        for( int xm = -half; xm <= half; xm++ ) {
+                            const int xx = std::min(std::max(x + xm, 0), width - 1);
+                            val += image(xx, yy, 0, c) * mask(half + xm, half + ym);
+                        }
+                    }
+                } else {
+                    for( int ym = -half; ym <= half; ym++ ) {
+                        const uint8_t *ptrs = image.data(x - half, y + ym, 0, c);
+                        const float *ptrm = mask.data(0, half + ym);
+                        for( int xm = 0; xm < mask.width(); xm++ ) {
+                            val += ptrs[xm] * ptrm[xm];
+                        }
+                    }
+                }
+                filtered(x, y, 0, c) = val;
+            }
+        }
+    }
+}
+
+
+int mwisd_fp::compute_image_heat_map(const char *filename, float* &heat_map, \
+        int heat_map_dim, int wavelet_scale_base, int wavelet_scale_exponent, \
+        const image_io::DecodeOptions &options) {
+    // Recommended:  wavelet_scale_base=2, wavelet_scale_exponent=1
+
+    // Input sanity check.
+    if( filename == NULL || heat_map == NULL || heat_map_dim < 1 || \
+            wavelet_scale_exponent < 0 ) {
+        // Invalid method call parameters.
+        return -1;
+    }
+
+    CImg<uint8_t> &grayscale_image = \
+        image_io::thread_compute_context().bytes(context_grayscale);
+    int retval = prepare_grayscale(filename, grayscale_image, heat_map_dim, \
+            options);
+    if( retval < 1 ) {
+        return retval;
+    }
+    return heat_map_from_grayscale(grayscale_image, heat_map, heat_map_dim, \
+            wavelet_scale_base, wavelet_scale_exponent);
+}
+
+
+int mwisd_fp::prepare_grayscale(const char *filename, \
+        CImg<uint8_t> &grayscale_image, int heat_map_dim, \
+        const image_io::DecodeOptions &options) {
+    return prepare_grayscale(filename, NULL, 0, grayscale_image, \
+        heat_map_dim, options);
+}
+
+
+int mwisd_fp::prepare_grayscale(const char *filename, const char *data, \
+        size_t length, CImg<uint8_t> &grayscale_image, int heat_map_dim, \
+        const image_io::DecodeOptions &options) {
+    // Input sanity check.
+    if( filename == NULL || heat_map_dim < 1 ) {
+        // Invalid method call parameters.
+        return -1;
+    }
+
+    // The full image's size sets the standardized size, also when a smaller
+    // copy of it (embedded preview, pyramid level) is what gets decoded.
+    // Without decode options the image itself is decoded, at full size, and
+    // its headers aren't read twice.
+    image_io::ImageInfo image_info;
+    bool probed = false;
+    if( options.min_dim > 0 || options.max_pixels > 0 || \
+            options.memory_cap > 0 || options.preview_min_dim > 0 ) {
+        probed = ((data != NULL) ? \
+            image_io::probe_image(data, length, image_info) : \
+            image_io::probe_image(filename, image_info)) == image_io::load_ok;
+    }
+
+    // Images whose decode (plus the float temporaries of the grayscale
+    // conversion) would exceed memory_cap are streamed instead.
+    image_io::ImageInfo info;
+    bool stream = false;
+    int retval;
+    if( options.memory_cap > 0 ) {
+        retval = image_io::probe_decoded(filename, options, info);
+        if( retval < 1 ) {
+            return retval;
+        }
+        stream = image_io::decoded_size(info, sizeof(uint8_t)) + \
+            (uint64_t)info.width * info.height * 2 * sizeof(float) > \
+            options.memory_cap;
+    }
+    // Pyramidal TIFFs are read from the smallest stored resolution that still
+    // covers the standardized size (once probed, i.e. given decode options).
+    image_io::DecodeOptions load_options = options;
+    if( probed && image_info.format == image_io::format_tiff && \
+            load_options.min_dim <= 0 ) {
+        load_options.min_dim = standard_resize_dim(image_info.width, \
+            image_info.height, heat_map_dim);
+    }
+
+    // Images and intermediates live in the thread's context, and so keep
+    // their buffers from one image of a given size to the next.
+    image_io::ComputeContext &context = image_io::thread_compute_context();
+
+    int original_width, original_height;
+    // Load original image into CImg structure (format detected by content).
+    CImg<uint8_t> &original_image = context.bytes(context_original);
+    if( stream ) {
+        original_width = info.width;
+        original_height = info.height;
+    } else {
+        retval = image_io::error_needs_file;
+        if( data != NULL ) {
+            retval = image_io::load_image(data, length, original_image, \
+                load_options);
+        }
+        if( retval == image_io::error_needs_file ) {
+            retval = image_io::load_image(filename, original_image, \
+                load_options);
+        }
+        if( retval < 1 ) {
+            return retval;
+        }
+
+        original_width = original_image.width();
+        original_height = original_image.height();
+
+        if( not ((original_width > 0) && \
+                (original_height > 0) && \
+                (original_image.depth() == 1)) ) {
+            // Input image is in an incompatible format.
+            context.trim();
+            return 0;
+        }
+    }
+
+    int resize_dim = probed ? standard_resize_dim(image_info.width, \
+        image_info.height, heat_map_dim) : standard_resize_dim(original_width, \
+        original_height, heat_map_dim);
+
     // Resize to a standardized dimension, convert to grayscale, and blur.
-    if( original_image.spectrum() == 3 ) {
-        grayscale_image = (CImg<uint8_t>)original_image.get_norm(0).quantize(255).normalize(0,255).resize(resize_dim, resize_dim, 1, 1, 5).blur(1.0).blur(1.0).blur(1.0);
+    if( stream ) {
+        CImg<float> reduced;
+        int spectrum = 0;
+        retval = stream_reduced_grayscale(filename, resize_dim, options, \
+                reduced, spectrum);
+        if( retval < 1 ) {
+            return retval;
+        }
+        if( spectrum == 3 ) {
+            grayscale_image = (CImg<uint8_t>)reduced.quantize(255).normalize(0,255).resize(resize_dim, resize_dim, 1, 1, 5).blur(1.0).blur(1.0).blur(1.0);
+        } else if( spectrum == 1 || spectrum == 4 ) {
+            grayscale_image = (CImg<uint8_t>)(reduced += 0.5f);
+            grayscale_image.resize(resize_dim, resize_dim, 1, 1, 5).blur(1.0).blur(1.0).blur(1.0);
+        } else {
+            grayscale_image.assign();
+        }
+    } else if( original_image.spectrum() == 3 ) {
+        CImg<float> &norm = context.floats(context_norm);
+        norm_into(original_image, norm);
+        grayscale_image.assign(norm.quantize(255).normalize(0,255).get_resize(resize_dim, resize_dim, 1, 1, 5).blur(1.0).blur(1.0).blur(1.0));
     } else if( original_image.spectrum() == 1 ) {
         grayscale_image = original_image.get_resize(resize_dim, resize_dim, 1, 1, 5).blur(1.0).blur(1.0).blur(1.0);
     } else if ( original_image.spectrum() == 4 ) {
@@ -77,16 +416,38 @@ int mwisd_fp::compute_image_hash(const char *filename, uint16_t* &hash, \
           
         grayscale_image = (luminance, alpha) > 'c';
         grayscale_image.resize(resize_dim, resize_dim, 1, 1, 5).blur(1.0).blur(1.0).blur(1.0);
+    } else {
+        // No grayscale conversion for this image (nor any earlier one).
+        grayscale_image.assign();
+    }
+    context.trim();
+    if( grayscale_image.is_empty() ) {
+        // Input image is in an incompatible format (e.g. gray with alpha).
+        return 0;
     }
 #ifdef DEBUG
     grayscale_image.save_png("temp.gray.png");
 #endif
+    return 1;
+}
+
+
+int mwisd_fp::heat_map_from_grayscale(const CImg<uint8_t> &grayscale_image, \
+        float *heat_map, int heat_map_dim, int wavelet_scale_base, \
+        int wavelet_scale_exponent) {
+    // Input sanity check.
+    if( heat_map == NULL || heat_map_dim < 1 || wavelet_scale_exponent < 0 ) {
+        // Invalid method call parameters.
+        return -1;
+    }
+    image_io::ComputeContext &context = image_io::thread_compute_context();
 
     // Define the correlation mask for performing a Marr wavelet transformation.
     int sigma = mwisd_fp::fast_pow(wavelet_scale_base, wavelet_scale_exponent);
     float inv_sigma = 1.0 / (float)sigma;
     float x, y, r2;
-    CImg<float> mask(8*sigma+1, 8*sigma+1, 1, 1, 0);
+    CImg<float> &mask = context.floats(context_mask);
+    mask.assign(8*sigma+1, 8*sigma+1, 1, 1, 0);
     cimg_forXY(mask, X, Y) {
         x = inv_sigma * (float)(X - 4*sigma);
         y = inv_sigma * (float)(Y - 4*sigma);
@@ -95,49 +456,280 @@ int mwisd_fp::compute_image_hash(const char *filename, uint16_t* &hash, \
     }
 
     // Perform wavelet decomposition (multiply LoG matrix against image matrix).
-    CImg<float> filtered_image = grayscale_image.get_correlate(mask);
+    CImg<float> &filtered_image = context.floats(context_filtered);
+    correlate_into(grayscale_image, mask, filtered_image);
+    if( filtered_image.is_empty() ) {
+        throw CImgInstanceException("mwisd_fp::compute_image_heat_map(): Empty grayscale image.");
+    }
 #ifdef DEBUG
     filtered_image.save_png("temp.filt.png");
 #endif
 
     // Downscale the filtered image (as it contains inherently sparse info).
-    CImg<float> heat_map(32, 32, 1, 1, 0);
+    // The heat map shares the caller's buffer:  index = col*heat_map_dim + row.
+    CImg<float> heat_map_image(heat_map, heat_map_dim, heat_map_dim, 1, 1, true);
     
-    int crop_offset = filtered_image.height() / 32;
-    float sum;
+    int crop_offset = filtered_image.height() / heat_map_dim;
     
-    for( int row=0; row < 32; row++ ) {
-        for( int col=0; col < 32; col++ ) {
-            sum = filtered_image.get_crop(crop_offset*row, crop_offset*col, crop_offset*row+(crop_offset - 1), crop_offset*col+(crop_offset - 1)).sum();
-            heat_map(row, col) = sum;
+    for( int row=0; row < heat_map_dim; row++ ) {
+        for( int col=0; col < heat_map_dim; col++ ) {
+            // Sums the cell in place, in the order (and double precision)
+            // of get_crop(...).sum():  channel by channel, x fastest.
+            double sum = 0;
+            cimg_forC(filtered_image, c) {
+                for( int y=crop_offset*col; y < crop_offset*(col+1); y++ ) {
+                    const float *ptr = filtered_image.data(crop_offset*row, y, 0, c);
+                    for( int x=0; x < crop_offset; x++ ) {
+                        sum += (double)ptr[x];
+                    }
+                }
+            }
+            heat_map_image(row, col) = (float)sum;
         }
     }
 
 #ifdef DEBUG
-    heat_map.save_png("temp.heat.png");
+    heat_map_image.save_png("temp.heat.png");
 #endif
 
-    // Convert heat_map into an image hash (fingerprint).
+    // Success.
+    return 1;
+}
+
+
+int mwisd_fp::hash_from_heat_map(const float *heat_map, int heat_map_dim, \
+        uint16_t* &hash, int hash_size_in_bytes, int block_dim, int rule) {
+    // Each block_dim x block_dim block of the heat map contributes one bit
+    // per cell:  set if the cell is above the block's mean (or median).
+    // With the defaults (32x32 heat map, 4x4 blocks, mean) this is the
+    // classic 1024-bit mwisd_fp fingerprint.  A heat map finer than the
+    // fingerprint's layout (see hash_layout) is first collapsed by summing
+    // adjacent cells.
+
+    // Input sanity check.
+    int width, height;
+    if( heat_map == NULL || hash == NULL || block_dim < 1 || \
+            hash_layout(hash_size_in_bytes, width, height) < 1 || \
+            (width % block_dim) != 0 || (height % block_dim) != 0 || \
+            heat_map_dim < width || (heat_map_dim % width) != 0 || \
+            (heat_map_dim % height) != 0 || \
+            (rule != threshold_mean && rule != threshold_median) ) {
+        return -1;
+    }
+
+    // Collapse the heat map onto the fingerprint's layout, if needed.
+    const float *cells = heat_map;
+    std::vector<float> collapsed;
+    const int factor_x = heat_map_dim / width, factor_y = heat_map_dim / height;
+    if( factor_x > 1 || factor_y > 1 ) {
+        collapsed.resize(width*height);
+        for( int y=0; y < height; y++ ) {
+            for( int x=0; x < width; x++ ) {
+                double sum = 0.0;
+                for( int dy=0; dy < factor_y; dy++ ) {
+                    const float *ptr = heat_map + \
+                        (y*factor_y + dy)*heat_map_dim + x*factor_x;
+                    for( int dx=0; dx < factor_x; dx++ ) {
+                        sum += (double)ptr[dx];
+                    }
+                }
+                collapsed[y*width + x] = (float)sum;
+            }
+        }
+        cells = &collapsed[0];
+    }
+
+    const int cells_per_block = block_dim * block_dim;
+    std::vector<float> block(cells_per_block);
+    std::vector<float> sorted_block(cells_per_block);
+
+    // Convert heat_map into an image hash (fingerprint), bits in block order.
     uint16_t hash_short = 0;
-    int index = 0;
-    // TODO does cimg_4x4 work here?
-    for( int row=0; row < 32; row += 4 ) {
-        CImg<float> four_by_four;
-        float average_in_four_by_four;
-        for( int col=0; col < 32; col += 4 ) {
-            four_by_four = heat_map.get_crop(row, col, row+3, col+3).unroll('x');
-            average_in_four_by_four = four_by_four.mean();
-            cimg_forX(four_by_four, X) {
+    int bits = 0, index = 0;
+    for( int row=0; row < width; row += block_dim ) {
+        for( int col=0; col < height; col += block_dim ) {
+            // Gather the block (x fastest, as CImg's unroll('x') would).
+            double block_sum = 0.0;
+            int cell = 0;
+            for( int dy=0; dy < block_dim; dy++ ) {
+                const float *ptr = cells + (col+dy)*width + row;
+                for( int dx=0; dx < block_dim; dx++ ) {
+                    block[cell] = ptr[dx];
+                    block_sum += (double)ptr[dx];
+                    ++cell;
+                }
+            }
+
+            float threshold;
+            if( rule == threshold_median ) {
+                sorted_block = block;
+                std::sort(sorted_block.begin(), sorted_block.end());
+                threshold = 0.5f * (sorted_block[(cells_per_block-1)/2] + \
+                        sorted_block[cells_per_block/2]);
+            } else {
+                threshold = (float)(block_sum / cells_per_block);
+            }
+
+            for( cell=0; cell < cells_per_block; cell++ ) {
                 hash_short = hash_short << 1;
-                if( four_by_four(X) > average_in_four_by_four ) {
+                if( block[cell] > threshold ) {
                     hash_short |= 0x01;
                 }
+                if( ++bits == 16 ) {
+                    hash[index] = hash_short;
+                    index++;
+                    bits = 0;
+                }
+            }
+        }
+    }
+
+    // Success.
+    return 1;
+}
+
+
+// IEEE 754 half precision conversions (round to nearest even); the heat map
+// is scaled into half range before packing so overflow cannot occur.
+static uint16_t float_to_half(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const uint16_t sign = (bits >> 16) & 0x8000;
+    const int exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x007FFFFF;
+
+    if( exponent >= 31 ) {
+        return sign | 0x7C00;
+    }
+    if( exponent <= 0 ) {
+        if( exponent < -10 ) {
+            return sign;
+        }
+        // Subnormal half.
+        mantissa |= 0x00800000;
+        const int shift = 14 - exponent;
+        uint32_t half_mantissa = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1U << shift) - 1);
+        const uint32_t halfway = 1U << (shift - 1);
+        if( remainder > halfway || \
+                (remainder == halfway && (half_mantissa & 1)) ) {
+            ++half_mantissa;
+        }
+        return sign | half_mantissa;
+    }
+
+    uint32_t half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+    const uint32_t remainder = mantissa & 0x1FFF;
+    if( remainder > 0x1000 || (remainder == 0x1000 && (half & 1)) ) {
+        ++half;  // May carry into the exponent, which is still correct.
+    }
+    return sign | (uint16_t)half;
+}
+
+
+static float half_to_float(uint16_t half) {
+    const uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+    int exponent = (half >> 10) & 0x1F;
+    uint32_t mantissa = half & 0x03FF;
+    uint32_t bits;
+
+    if( exponent == 0 ) {
+        if( mantissa == 0 ) {
+            bits = sign;
+        } else {
+            // Renormalize a subnormal half.
+            exponent = 1;
+            while( not (mantissa & 0x0400) ) {
+                mantissa <<= 1;
+                --exponent;
             }
-            hash[index] = hash_short;
-            index++;
+            mantissa &= 0x03FF;
+            bits = sign | ((uint32_t)(exponent - 15 + 127) << 23) | \
+                (mantissa << 13);
         }
+    } else if( exponent == 31 ) {
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    } else {
+        bits = sign | ((uint32_t)(exponent - 15 + 127) << 23) | \
+            (mantissa << 13);
+    }
+
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+
+// Packed heat map layout (little-endian):  uint8 version, uint8 reserved,
+// uint16 heat_map_dim, float32 scale, then heat_map_dim**2 float16 values
+// (value = scale * float16), in the same order as the unpacked heat map.
+
+int mwisd_fp::pack_heat_map(const float *heat_map, int heat_map_dim, \
+        std::string &blob) {
+    if( heat_map == NULL || heat_map_dim < 1 || heat_map_dim > 0xFFFF ) {
+        return -1;
     }
 
+    const int count = heat_map_dim * heat_map_dim;
+    float max_magnitude = 0.0;
+    for( int index=0; index < count; index++ ) {
+        max_magnitude = std::max(max_magnitude, (float)fabs(heat_map[index]));
+    }
+    // Map the largest magnitude to 2**15, well inside half range.
+    const float scale = max_magnitude / 32768.0f;
+    const float inv_scale = (scale > 0.0f) ? 1.0f / scale : 0.0f;
+
+    blob.resize(heat_map_blob_header_size + 2*count);
+    uint8_t *out = (uint8_t*)&blob[0];
+    uint32_t scale_bits;
+    memcpy(&scale_bits, &scale, sizeof(scale_bits));
+    out[0] = heat_map_blob_version;
+    out[1] = 0;
+    out[2] = heat_map_dim & 0xFF;
+    out[3] = (heat_map_dim >> 8) & 0xFF;
+    for( int shift=0; shift < 4; shift++ ) {
+        out[4+shift] = (scale_bits >> (8*shift)) & 0xFF;
+    }
+    out += heat_map_blob_header_size;
+    for( int index=0; index < count; index++ ) {
+        uint16_t value = float_to_half(heat_map[index] * inv_scale);
+        out[2*index] = value & 0xFF;
+        out[2*index+1] = (value >> 8) & 0xFF;
+    }
+
+    // Success.
+    return 1;
+}
+
+
+int mwisd_fp::unpack_heat_map(const std::string &blob, \
+        std::vector<float> &heat_map, int &heat_map_dim) {
+    const uint8_t *in = (const uint8_t*)blob.data();
+    if( blob.size() < (size_t)heat_map_blob_header_size || \
+            in[0] != heat_map_blob_version ) {
+        return -1;
+    }
+
+    heat_map_dim = in[2] | (in[3] << 8);
+    const int count = heat_map_dim * heat_map_dim;
+    if( heat_map_dim < 1 || \
+            blob.size() != (size_t)(heat_map_blob_header_size + 2*count) ) {
+        return -1;
+    }
+
+    uint32_t scale_bits = 0;
+    for( int shift=0; shift < 4; shift++ ) {
+        scale_bits |= (uint32_t)in[4+shift] << (8*shift);
+    }
+    float scale;
+    memcpy(&scale, &scale_bits, sizeof(scale));
+
+    in += heat_map_blob_header_size;
+    heat_map.resize(count);
+    for( int index=0; index < count; index++ ) {
+        uint16_t value = in[2*index] | (in[2*index+1] << 8);
+        heat_map[index] = scale * half_to_float(value);
+    }
 
     // Success.
     return 1;
@@ -200,6 +792,129 @@ double mwisd_fp::hamming_distance(uint16_t *hash_1, uint16_t *hash_2, int hash_s
 }
 
 
+double mwisd_fp::hamming_distance_bytes(const char *bytes_1, \
+        const char *bytes_2, int hash_size_in_bytes) {
+
+    // Validate inputs.
+    if( (bytes_1 == NULL) || (bytes_2 == NULL) || (hash_size_in_bytes <= 0) ) {
+        return -1.0;
+    }
+
+    // Compute hamming distance, eight bytes at a time.
+    int distance = 0;
+    for( int offset=0; offset < hash_size_in_bytes; offset += 8 ) {
+        const int count = std::min(8, hash_size_in_bytes - offset);
+        uint64_t word_1 = 0, word_2 = 0;
+        memcpy(&word_1, bytes_1 + offset, count);
+        memcpy(&word_2, bytes_2 + offset, count);
+        distance += fast_popcount_64(word_1 ^ word_2);
+    }
+
+    // Normalize the distance.
+    return (double)distance / (8 * hash_size_in_bytes);
+}
+
+
+double mwisd_fp::compare_bytes(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2) {
+    if( length_1 != length_2 || length_1 == 0 ) {
+        throw CImgArgumentException("mwisd_fp::compare_bytes fingerprints of different sizes.\n");
+    }
+    return 1.0 - hamming_distance_bytes(bytes_1, bytes_2, (int)length_1);
+}
+
+
+// Returns how many fingerprints the size of the one at bytes_1 are packed
+// in bytes_2, throwing if that's not a whole number of them.
+static int packed_count(size_t length_1, size_t length_2) {
+    if( length_1 == 0 || length_2 % length_1 != 0 ) {
+        throw CImgArgumentException("mwisd_fp::compare_many fingerprints of different sizes.\n");
+    }
+    return (int)(length_2 / length_1);
+}
+
+
+// Hamming distances of the fingerprint bytes_1 to each of the count packed
+// in bytes_2, as run by image_io::run_blocking() for compare_many() and
+// match_many().  Holds its own copy of the bytes:  a Ruby caller's Strings
+// may be changed or moved by other threads while the GVL is released.
+struct PackedComparison {
+    std::string bytes_1, bytes_2;
+    int count;
+    std::vector<double> distances;
+
+    static void *run(void *comparison) {
+        PackedComparison *self = (PackedComparison*)comparison;
+        const size_t length_1 = self->bytes_1.size();
+        self->distances.resize(self->count);
+        for( int index=0; index < self->count; index++ ) {
+            self->distances[index] = mwisd_fp::hamming_distance_bytes( \
+                self->bytes_1.data(), self->bytes_2.data() + (size_t)index * length_1, \
+                (int)length_1);
+        }
+        return NULL;
+    }
+};
+
+
+static std::vector<double> compare_packed(const char *bytes_1, \
+        size_t length_1, const char *bytes_2, size_t length_2) {
+    PackedComparison comparison;
+    comparison.count = packed_count(length_1, length_2);
+    comparison.bytes_1.assign(bytes_1, length_1);
+    comparison.bytes_2.assign(bytes_2, length_2);
+    image_io::run_blocking(PackedComparison::run, &comparison);
+    return comparison.distances;
+}
+
+
+std::string mwisd_fp::compare_many(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2) {
+    const std::vector<double> distances = compare_packed(bytes_1, length_1, \
+        bytes_2, length_2);
+    const int count = (int)distances.size();
+    std::string similarities(4 * (size_t)count, '\0');
+    for( int index=0; index < count; index++ ) {
+        const float similarity = (float)(1.0 - distances[index]);
+        uint32_t bits;
+        memcpy(&bits, &similarity, sizeof(bits));
+        for( int shift=0; shift < 4; shift++ ) {
+            similarities[4*(size_t)index + shift] = (char)((bits >> (8*shift)) & 0xFF);
+        }
+    }
+    return similarities;
+}
+
+
+std::vector<int> mwisd_fp::match_many(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2, double threshold, int limit) {
+    const std::vector<double> distances = compare_packed(bytes_1, length_1, \
+        bytes_2, length_2);
+    const int count = (int)distances.size();
+
+    // Distances of the matches, paired with their indices to break ties.
+    std::vector< std::pair<double,int> > matches;
+    for( int index=0; index < count; index++ ) {
+        const double distance = distances[index];
+        if( 1.0 - distance >= threshold ) {
+            matches.push_back(std::make_pair(distance, index));
+        }
+    }
+    if( limit > 0 && limit < (int)matches.size() ) {
+        std::partial_sort(matches.begin(), matches.begin() + limit, matches.end());
+        matches.resize(limit);
+    } else {
+        std::sort(matches.begin(), matches.end());
+    }
+
+    std::vector<int> indices(matches.size());
+    for( size_t match=0; match < matches.size(); match++ ) {
+        indices[match] = matches[match].second;
+    }
+    return indices;
+}
+
+
 int mwisd_fp::read_hash_from_text(char *text, uint16_t* &hash, int hash_size_in_bytes) {
 
     // Read first block of hash data, accommodating irregular leading spaces.
@@ -239,13 +954,19 @@ void mwisd_fp::convert_to_mirror_flip(uint16_t* &hash, int hash_size_in_bytes) {
     // Reorder the four-by-four hash blocks to mirror order.
     uint16_t *u16ptr = hash;
     uint16_t swap_value;
-    int blocks_per_axis = (int)(sqrt(hash_size_in_bytes / 2) + 0.001);
-    for( int column = 0; column < blocks_per_axis / 2; column++ ) {
-        for( int row = 0; row < blocks_per_axis; row++ ) {
-            swap_value = *(u16ptr + blocks_per_axis*column + row);
-            *(u16ptr + blocks_per_axis*column + row) = \
-                *(u16ptr + blocks_per_axis*(blocks_per_axis-column-1) + row);
-            *(u16ptr + blocks_per_axis*(blocks_per_axis-column-1) + row) = \
+    int heat_map_width, heat_map_height;
+    if( hash_layout(hash_size_in_bytes, heat_map_width, heat_map_height) < 1 || \
+            heat_map_height < 4 ) {
+        return;
+    }
+    int blocks_per_row = heat_map_width / 4;
+    int blocks_per_column = heat_map_height / 4;
+    for( int column = 0; column < blocks_per_row / 2; column++ ) {
+        for( int row = 0; row < blocks_per_column; row++ ) {
+            swap_value = *(u16ptr + blocks_per_column*column + row);
+            *(u16ptr + blocks_per_column*column + row) = \
+                *(u16ptr + blocks_per_column*(blocks_per_row-column-1) + row);
+            *(u16ptr + blocks_per_column*(blocks_per_row-column-1) + row) = \
                 swap_value;
         }
     }
@@ -272,17 +993,76 @@ void mwisd_fp::convert_to_mirror_flip(uint16_t* &hash, int hash_size_in_bytes) {
 
 mwisd_fp::Fingerprint::Fingerprint(int hash_size_in_bytes) {
     size_in_bytes = hash_size_in_bytes;
-    contents = (uint16_t*)malloc(hash_size_in_bytes*sizeof(uint8_t));
+    if( size_in_bytes == ClassicFingerprint::size_in_bytes ) {
+        contents = classic.contents;
+    } else {
+        contents = (uint16_t*)malloc(hash_size_in_bytes*sizeof(uint8_t));
+    }
+}
+
+
+mwisd_fp::Fingerprint::Fingerprint(const mwisd_fp::Fingerprint &other) : \
+        size_in_bytes(other.size_in_bytes), heat_map_blob(other.heat_map_blob), \
+        decode_options(other.decode_options), classic(other.classic) {
+    if( size_in_bytes == ClassicFingerprint::size_in_bytes ) {
+        contents = classic.contents;
+    } else {
+        contents = (uint16_t*)malloc(size_in_bytes*sizeof(uint8_t));
+        if( contents != NULL && other.contents != NULL ) {
+            memcpy(contents, other.contents, size_in_bytes);
+        }
+    }
+}
+
+
+mwisd_fp::Fingerprint &mwisd_fp::Fingerprint::operator=( \
+        const mwisd_fp::Fingerprint &other) {
+    if( this == &other ) {
+        return *this;
+    }
+    if( size_in_bytes != other.size_in_bytes ) {
+        if( contents != classic.contents && contents != NULL ) {
+            free(contents);
+        }
+        size_in_bytes = other.size_in_bytes;
+        if( size_in_bytes == ClassicFingerprint::size_in_bytes ) {
+            contents = classic.contents;
+        } else {
+            contents = (uint16_t*)malloc(size_in_bytes*sizeof(uint8_t));
+        }
+    }
+    if( contents != NULL && other.contents != NULL ) {
+        memcpy(contents, other.contents, size_in_bytes);
+    }
+    heat_map_blob = other.heat_map_blob;
+    decode_options = other.decode_options;
+    return *this;
 }
 
 
 mwisd_fp::Fingerprint::~Fingerprint() {
-    if(contents != NULL) {
+    if(contents != NULL && contents != classic.contents) {
         free(contents);
     }
 }
 
 
+mwisd_fp::ClassicFingerprint mwisd_fp::Fingerprint::as_classic() const {
+    if( size_in_bytes != ClassicFingerprint::size_in_bytes ) {
+        throw CImgArgumentException("mwisd_fp::Fingerprint::as_classic fingerprint not of the classic size.\n");
+    }
+    return classic;
+}
+
+
+void mwisd_fp::Fingerprint::set_from_classic(const mwisd_fp::ClassicFingerprint &value) {
+    if( size_in_bytes != ClassicFingerprint::size_in_bytes ) {
+        throw CImgArgumentException("mwisd_fp::Fingerprint::set_from_classic fingerprint not of the classic size.\n");
+    }
+    classic = value;
+}
+
+
 char* mwisd_fp::Fingerprint::as_char_array() {
     char *duplicate = (char*)malloc((1+size_in_bytes)*sizeof(uint8_t));
     memcpy(duplicate, contents, size_in_bytes);
@@ -315,11 +1095,109 @@ void mwisd_fp::Fingerprint::set_from_int_array(const std::vector<int>& values) {
 }
 
 
+std::string mwisd_fp::Fingerprint::to_bytes() {
+    std::string bytes(size_in_bytes, '\0');
+    for( int index=0; index < size_in_bytes/(int)sizeof(uint16_t); index++ ) {
+        bytes[2*index] = (char)(contents[index] & 0xFF);
+        bytes[2*index+1] = (char)(contents[index] >> 8);
+    }
+    return bytes;
+}
+
+
+void mwisd_fp::Fingerprint::from_bytes(const std::string &bytes) {
+    if( (int)bytes.size() != size_in_bytes ) {
+        throw CImgArgumentException("mwisd_fp::Fingerprint::from_bytes bytes of another size.\n");
+    }
+    for( int index=0; index < size_in_bytes/(int)sizeof(uint16_t); index++ ) {
+        uint16_t low = (unsigned char)bytes[2*index];
+        uint16_t high = (unsigned char)bytes[2*index+1];
+        contents[index] = (high << 8) + low;
+    }
+}
+
+
+// compute_image_hash() (or, with heat_map, compute_image_heat_map()) for
+// Fingerprint::compute_from_image_file(), as run by image_io::run_blocking().
+struct MwisdComputation {
+    mwisd_fp::Fingerprint *fingerprint;
+    const char *filename;
+    int wavelet_scale_base, wavelet_scale_exponent;
+    float *heat_map;
+    int heat_map_dim;
+    int retval;
+
+    static void *run(void *computation) {
+        MwisdComputation *self = (MwisdComputation*)computation;
+        mwisd_fp::Fingerprint *fp = self->fingerprint;
+        if( self->heat_map == NULL ) {
+            self->retval = mwisd_fp::compute_image_hash(self->filename, \
+                fp->contents, fp->size_in_bytes, self->wavelet_scale_base, \
+                self->wavelet_scale_exponent, fp->decode_options);
+        } else {
+            self->retval = mwisd_fp::compute_image_heat_map(self->filename, \
+                self->heat_map, self->heat_map_dim, self->wavelet_scale_base, \
+                self->wavelet_scale_exponent, fp->decode_options);
+        }
+        return NULL;
+    }
+};
+
+
 void mwisd_fp::Fingerprint::compute_from_image_file(const char *filename, \
-        int wavelet_scale_base, int wavelet_scale_exponent) {
+        int wavelet_scale_base, int wavelet_scale_exponent, \
+        bool keep_heat_map) {
     // Recommended:  wavelet_scale_base=2, wavelet_scale_exponent=1
-    compute_image_hash(filename, contents, size_in_bytes, wavelet_scale_base, \
-            wavelet_scale_exponent);
+    heat_map_blob.clear();
+    MwisdComputation computation;
+    computation.fingerprint = this;
+    computation.filename = filename;
+    computation.wavelet_scale_base = wavelet_scale_base;
+    computation.wavelet_scale_exponent = wavelet_scale_exponent;
+    computation.heat_map = NULL;
+    computation.heat_map_dim = 0;
+    computation.retval = -1;
+    if( not keep_heat_map ) {
+        image_io::run_blocking(MwisdComputation::run, &computation);
+        if( computation.retval < 1 ) {
+            throw CImgIOException("mwisd_fp::compute_image_hash failed.\n");
+        }
+        return;
+    }
+
+    int heat_map_dim, heat_map_height;
+    if( hash_layout(size_in_bytes, heat_map_dim, heat_map_height) < 1 ) {
+        throw CImgArgumentException("mwisd_fp::hash_layout unsupported fingerprint size.\n");
+    }
+    std::vector<float> heat_map_values(heat_map_dim*heat_map_dim);
+    float *heat_map = &heat_map_values[0];
+    computation.heat_map = heat_map;
+    computation.heat_map_dim = heat_map_dim;
+    image_io::run_blocking(MwisdComputation::run, &computation);
+    if( computation.retval < 1 ) {
+        throw CImgIOException("mwisd_fp::compute_image_heat_map failed.\n");
+    }
+    hash_from_heat_map(heat_map, heat_map_dim, contents, \
+            size_in_bytes, default_block_dim, threshold_mean);
+    pack_heat_map(heat_map, heat_map_dim, heat_map_blob);
+}
+
+
+void mwisd_fp::Fingerprint::set_from_heat_map_blob(const std::string &blob, \
+        int block_dim, int rule) {
+    // Re-derives the fingerprint from a heat map kept by an earlier
+    // compute_from_image_file(..., true) without decoding the image again.
+    std::vector<float> heat_map;
+    int heat_map_dim;
+    if( unpack_heat_map(blob, heat_map, heat_map_dim) < 1 ) {
+        throw CImgArgumentException("mwisd_fp::unpack_heat_map failed.\n");
+    }
+    const float *values = &heat_map[0];
+    if( hash_from_heat_map(values, heat_map_dim, contents, size_in_bytes, \
+            block_dim, rule) < 1 ) {
+        throw CImgArgumentException("mwisd_fp::hash_from_heat_map failed.\n");
+    }
+    heat_map_blob = blob;
 }
 
 
@@ -329,6 +1207,15 @@ double mwisd_fp::Fingerprint::compare(mwisd_fp::Fingerprint *other) {
     return (1.0 - distance);
 }
 
+double mwisd_fp::Fingerprint::compare_bytes(const char *data, size_t length) {
+    if( (int)length != size_in_bytes ) {
+        throw CImgArgumentException("mwisd_fp::Fingerprint::compare_bytes bytes of another size.\n");
+    }
+    // Bytes of our own to compare with, in the same order.
+    std::string bytes = to_bytes();
+    return 1.0 - hamming_distance_bytes(bytes.data(), data, size_in_bytes);
+}
+
 uint8_t mwisd_fp::Fingerprint::compare_compressed_hash(uint64_t other_hash) {
   uint64_t hash_xor = compressed_hash() ^ other_hash;
 
@@ -339,7 +1226,8 @@ uint64_t mwisd_fp::Fingerprint::compressed_hash() {
    uint16_t average;
    uint32_t sum = 0;
    uint64_t hash = 0;
-   const uint16_t fp_member_count = size_in_bytes / sizeof(uint16_t);
+   // Only the first 64 members contribute to larger fingerprints.
+   const uint16_t fp_member_count = std::min(size_in_bytes / (int)sizeof(uint16_t), 64);
    uint16_t i;
 
    if(contents == NULL) {
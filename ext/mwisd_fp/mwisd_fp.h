@@ -11,7 +11,10 @@
 #define MWISD_FP_H_
 
 #include <stdint.h>
+#include <string.h>
+#include <string>
 #include <vector>
+#include "image_io.h"
 
 // CImg-related settings
 #define cimg_debug 0
@@ -44,37 +47,157 @@
 namespace mwisd_fp {
 
 const int default_hash_size_in_bytes = 128;
+const int default_heat_map_dim = 32;
+const int default_block_dim = 4;
+
+const int heat_map_blob_version = 1;
+const int heat_map_blob_header_size = 8;
+
+// Rules for thresholding each heat map block into fingerprint bits.
+enum threshold_rule {
+    threshold_mean = 0,     // Cell above the mean of its block (classic).
+    threshold_median = 1    // Cell above the median of its block.
+};
 
 
 int compute_image_hash(const char *filename, uint16_t* &hash, \
         int hash_size_in_bytes, int wavelet_scale_base, \
+        int wavelet_scale_exponent, \
+        const image_io::DecodeOptions &options=image_io::DecodeOptions());
+int compute_image_hashes(const char *filename, uint16_t **hashes, \
+        const int *hash_sizes_in_bytes, int count, int wavelet_scale_base, \
+        int wavelet_scale_exponent, \
+        const image_io::DecodeOptions &options=image_io::DecodeOptions());
+int hash_layout(int hash_size_in_bytes, int &heat_map_width, \
+        int &heat_map_height);
+int compute_image_heat_map(const char *filename, float* &heat_map, \
+        int heat_map_dim, int wavelet_scale_base, int wavelet_scale_exponent, \
+        const image_io::DecodeOptions &options=image_io::DecodeOptions());
+// compute_image_heat_map() in two halves, for pipelines that decode and
+// transform on different threads:  the standardized grayscale image
+// (decoding through resize and blur), then the heat map of its wavelet
+// transform.  prepare_grayscale() returns 0 for images of incompatible
+// layout, like compute_image_heat_map().
+int prepare_grayscale(const char *filename, \
+        cimg_library::CImg<uint8_t> &grayscale_image, int heat_map_dim, \
+        const image_io::DecodeOptions &options=image_io::DecodeOptions());
+// The same, decoding the file's contents already read into data (see
+// PipelineOptions::read_contents) where image_io can; the file is read
+// again only for what it can't (TIFFs, previews, streamed decodes).
+int prepare_grayscale(const char *filename, const char *data, size_t length, \
+        cimg_library::CImg<uint8_t> &grayscale_image, int heat_map_dim, \
+        const image_io::DecodeOptions &options=image_io::DecodeOptions());
+int heat_map_from_grayscale(const cimg_library::CImg<uint8_t> &grayscale_image, \
+        float *heat_map, int heat_map_dim, int wavelet_scale_base, \
         int wavelet_scale_exponent);
+int hash_from_heat_map(const float *heat_map, int heat_map_dim, \
+        uint16_t* &hash, int hash_size_in_bytes, \
+        int block_dim=default_block_dim, int rule=threshold_mean);
+int pack_heat_map(const float *heat_map, int heat_map_dim, std::string &blob);
+int unpack_heat_map(const std::string &blob, std::vector<float> &heat_map, \
+        int &heat_map_dim);
 int fast_pow(int base, int exponent);
 uint8_t fast_popcount_64(uint64_t val);
 double hamming_distance(uint16_t *hash_1, uint16_t *hash_2, \
         int hash_size_in_bytes);
+// As hamming_distance(), for fingerprints held as bytes (see
+// Fingerprint::to_bytes()); byte order doesn't change which bits differ, so
+// they are read in place, at any alignment.
+double hamming_distance_bytes(const char *bytes_1, const char *bytes_2, \
+        int hash_size_in_bytes);
+double compare_bytes(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2);
+// Similarities (as compare_bytes()'s) of the fingerprint bytes_1 to each
+// of those packed back to back in bytes_2, as little-endian float32s.
+std::string compare_many(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2);
+// Indices into bytes_2, as above, of the fingerprints at least threshold
+// similar to bytes_1:  most similar first (ties in packed order), and at
+// most limit of them (0:  all).
+std::vector<int> match_many(const char *bytes_1, size_t length_1, \
+        const char *bytes_2, size_t length_2, double threshold=0.0, \
+        int limit=0);
 int read_hash_from_text(char *text, uint16_t* &hash, int hash_size_in_bytes );
 void convert_to_mirror_flip(uint16_t* &hash, int hash_size_in_bytes);
 
 
+// Fingerprint of Bits bits (a power of two, at least 64) held inline as a
+// value:  trivially copyable, so containers of them are one contiguous
+// block.  Where the compiler aligns allocations beyond malloc()'s, each is
+// aligned to a cache line, else to 8 bytes for the 64-bit loads of
+// compare().
+#if defined(__cpp_aligned_new)
+#define MWISD_FP_CACHE_ALIGNED alignas(64)
+#else
+#define MWISD_FP_CACHE_ALIGNED
+#endif
+
+template<int Bits>
+struct MWISD_FP_CACHE_ALIGNED BasicFingerprint {
+    static const int size_in_bytes = Bits / 8;
+    union {
+        uint16_t contents[Bits / 16];       // As Fingerprint::contents.
+        uint64_t aligner;                   // Unused; aligns contents.
+    };
+
+    BasicFingerprint() {
+        memset(contents, 0, size_in_bytes);
+    }
+    bool operator==(const BasicFingerprint &other) const {
+        return memcmp(contents, other.contents, size_in_bytes) == 0;
+    }
+    bool operator!=(const BasicFingerprint &other) const {
+        return !(*this == other);
+    }
+    double compare(const BasicFingerprint &other) const {
+        return 1.0 - hamming_distance_bytes((const char*)contents, \
+            (const char*)other.contents, size_in_bytes);
+    }
+};
+
+// The classic 1024-bit (128-byte) fingerprint.
+typedef BasicFingerprint<8 * default_hash_size_in_bytes> ClassicFingerprint;
+
+
+// A fingerprint of any supported size.  contents points into inline storage
+// at the classic size (into the heap at others), and copies copy it, so
+// fingerprints may be passed and held by value.
 class Fingerprint {
 public:
     uint16_t* contents;
     int size_in_bytes;
+    std::string heat_map_blob;  // Packed heat map, if kept when computed.
+    image_io::DecodeOptions decode_options;     // Limits for computing.
+private:
+    ClassicFingerprint classic;
 
+public:
     Fingerprint(int hash_size_in_bytes=default_hash_size_in_bytes);
+    Fingerprint(const Fingerprint &other);
+    Fingerprint &operator=(const Fingerprint &other);
     ~Fingerprint();
 
+    // The value of a classic-size fingerprint, and back.
+    ClassicFingerprint as_classic() const;
+    void set_from_classic(const ClassicFingerprint &value);
+
     char* as_char_array();
     void set_from_char_array(const char* buf);
 
     std::vector<int> as_int_array();
     void set_from_int_array(const std::vector<int>& values);
 
+    // size_in_bytes bytes, each 16-bit member little-endian whatever the host.
+    std::string to_bytes();
+    void from_bytes(const std::string &bytes);
+
 
     void compute_from_image_file(const char *filename, int wavelet_scale_base, \
-            int wavelet_scale_exponent);
+            int wavelet_scale_exponent, bool keep_heat_map=false);
+    void set_from_heat_map_blob(const std::string &blob, \
+            int block_dim=default_block_dim, int rule=threshold_mean);
     double compare(Fingerprint *other);
+    double compare_bytes(const char *data, size_t length);  // With to_bytes() of another.
     uint8_t compare_compressed_hash(uint64_t other_hash);
 
     uint64_t compressed_hash();
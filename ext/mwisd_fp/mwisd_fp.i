@@ -1,10 +1,49 @@
 %module mwisd_fp
 %{
 #include "mwisd_fp.h"
+#include "image_io.h"
 #include "CImg.h"
 %}
 
+%{
+#ifdef HAVE_RUBY_THREAD_H
+#include <ruby/thread.h>
+#endif
+
+// Runs long native work (see image_io::run_blocking()) without the GVL, so
+// other Ruby threads run meanwhile.  The work can't be interrupted; a
+// Thread#kill or timeout takes effect once it's done.
+#if defined(HAVE_RB_THREAD_CALL_WITHOUT_GVL)
+static void run_without_gvl(image_io::blocking_function function, void *data) {
+  rb_thread_call_without_gvl(function, data, NULL, NULL);
+}
+#elif defined(HAVE_RB_THREAD_BLOCKING_REGION)
+struct BlockingRegion {
+  image_io::blocking_function function;
+  void *data;
+};
+
+static VALUE run_blocking_region(void *region) {
+  ((BlockingRegion*)region)->function(((BlockingRegion*)region)->data);
+  return Qnil;
+}
+
+static void run_without_gvl(image_io::blocking_function function, void *data) {
+  BlockingRegion region = { function, data };
+  rb_thread_blocking_region(run_blocking_region, &region, NULL, NULL);
+}
+#endif
+%}
+
+%init %{
+#if defined(HAVE_RB_THREAD_CALL_WITHOUT_GVL) || defined(HAVE_RB_THREAD_BLOCKING_REGION)
+  image_io::set_blocking_runner(run_without_gvl);
+#endif
+  rb_define_class("Mwisd_fpError", rb_eStandardError);
+%}
+
 %include "stdint.i"
+%include "std_string.i"
 %include "std_vector.i"
 namespace std {
   %template(Vectori) vector<int>;
@@ -28,4 +67,79 @@ namespace std {
   }
 }
 
+%exception set_from_heat_map_blob {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception from_bytes {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception compare_bytes {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception compare_many {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+%exception match_many {
+  try {
+    $action
+  }
+  catch(cimg_library::CImgException &ce) {
+    static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+    rb_raise(cimgerror, ce.what());
+  }
+}
+
+// Header probing and decode limits only; decoding stays behind the
+// fingerprint types.
+%ignore image_io::sniff_format;
+%ignore image_io::decoded_size;
+%ignore image_io::probe_decoded;
+%ignore image_io::load_image;
+%ignore image_io::set_blocking_runner;
+%ignore image_io::run_blocking;
+%ignore image_io::ComputeContext;
+%ignore image_io::thread_compute_context;
+%apply (char *STRING, size_t LENGTH) { (const char *data, size_t length) };
+// Packed fingerprints are compared where they lie in their Ruby Strings.
+%ignore mwisd_fp::hamming_distance_bytes;
+%ignore mwisd_fp::prepare_grayscale;
+%ignore mwisd_fp::heat_map_from_grayscale;
+// Fixed-size values are for C++ containers; Ruby copies via Fingerprint.new.
+%ignore mwisd_fp::BasicFingerprint;
+%ignore mwisd_fp::Fingerprint::as_classic;
+%ignore mwisd_fp::Fingerprint::set_from_classic;
+%ignore mwisd_fp::Fingerprint::operator=;
+%apply (char *STRING, size_t LENGTH) { (const char *bytes_1, size_t length_1) };
+%apply (char *STRING, size_t LENGTH) { (const char *bytes_2, size_t length_2) };
+%rename(probe_image_data) image_io::probe_image(const char *, size_t, image_io::ImageInfo &);
+
+%include "image_io.h"
 %include "mwisd_fp.h"
@@ -1819,27 +1819,35 @@ int SWIG_Ruby_arity( VALUE proc, int minimal )
 #define SWIGTYPE_p_allocator_type swig_types[0]
 #define SWIGTYPE_p_char swig_types[1]
 #define SWIGTYPE_p_difference_type swig_types[2]
-#define SWIGTYPE_p_int swig_types[3]
-#define SWIGTYPE_p_long_long swig_types[4]
-#define SWIGTYPE_p_mwisd_fp__Fingerprint swig_types[5]
-#define SWIGTYPE_p_p_unsigned_short swig_types[6]
-#define SWIGTYPE_p_p_void swig_types[7]
-#define SWIGTYPE_p_short swig_types[8]
-#define SWIGTYPE_p_signed_char swig_types[9]
-#define SWIGTYPE_p_size_type swig_types[10]
-#define SWIGTYPE_p_std__allocatorT_int_t swig_types[11]
-#define SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t swig_types[12]
-#define SWIGTYPE_p_swig__ConstIterator swig_types[13]
-#define SWIGTYPE_p_swig__GC_VALUE swig_types[14]
-#define SWIGTYPE_p_swig__Iterator swig_types[15]
-#define SWIGTYPE_p_unsigned_char swig_types[16]
-#define SWIGTYPE_p_unsigned_int swig_types[17]
-#define SWIGTYPE_p_unsigned_long_long swig_types[18]
-#define SWIGTYPE_p_unsigned_short swig_types[19]
-#define SWIGTYPE_p_value_type swig_types[20]
-#define SWIGTYPE_p_void swig_types[21]
-static swig_type_info *swig_types[23];
-static swig_module_info swig_module = {swig_types, 22, 0, 0, 0, 0};
+#define SWIGTYPE_p_float swig_types[3]
+#define SWIGTYPE_p_image_io__DecodeOptions swig_types[4]
+#define SWIGTYPE_p_image_io__EmbeddedPreview swig_types[5]
+#define SWIGTYPE_p_image_io__ImageInfo swig_types[6]
+#define SWIGTYPE_p_image_io__image_format swig_types[7]
+#define SWIGTYPE_p_int swig_types[8]
+#define SWIGTYPE_p_long_long swig_types[9]
+#define SWIGTYPE_p_mwisd_fp__Fingerprint swig_types[10]
+#define SWIGTYPE_p_p_float swig_types[11]
+#define SWIGTYPE_p_p_unsigned_short swig_types[12]
+#define SWIGTYPE_p_p_void swig_types[13]
+#define SWIGTYPE_p_short swig_types[14]
+#define SWIGTYPE_p_signed_char swig_types[15]
+#define SWIGTYPE_p_size_type swig_types[16]
+#define SWIGTYPE_p_std__allocatorT_int_t swig_types[17]
+#define SWIGTYPE_p_std__string swig_types[18]
+#define SWIGTYPE_p_std__vectorT_float_std__allocatorT_float_t_t swig_types[19]
+#define SWIGTYPE_p_std__vectorT_int_std__allocatorT_int_t_t swig_types[20]
+#define SWIGTYPE_p_swig__ConstIterator swig_types[21]
+#define SWIGTYPE_p_swig__GC_VALUE swig_types[22]
+#define SWIGTYPE_p_swig__Iterator swig_types[23]
+#define SWIGTYPE_p_unsigned_char swig_types[24]
+#define SWIGTYPE_p_unsigned_int swig_types[25]
+#define SWIGTYPE_p_unsigned_long_long swig_types[26]
+#define SWIGTYPE_p_unsigned_short swig_types[27]
+#define SWIGTYPE_p_value_type swig_types[28]
+#define SWIGTYPE_p_void swig_types[29]
+static swig_type_info *swig_types[31];
+static swig_module_info swig_module = {swig_types, 30, 0, 0, 0, 0};
 #define SWIG_TypeQuery(name) SWIG_TypeQueryModule(&swig_module, &swig_module, name)
 #define SWIG_MangledTypeQuery(name) SWIG_MangledTypeQueryModule(&swig_module, &swig_module, name)
 
@@ -1866,9 +1874,39 @@ static VALUE mMwisd_fp;
 
 
 #include "mwisd_fp.h"
+#include "image_io.h"
 #include "CImg.h"
 
 
+#ifdef HAVE_RUBY_THREAD_H
+#include <ruby/thread.h>
+#endif
+
+// Runs long native work (see image_io::run_blocking()) without the GVL, so
+// other Ruby threads run meanwhile.  The work can't be interrupted; a
+// Thread#kill or timeout takes effect once it's done.
+#if defined(HAVE_RB_THREAD_CALL_WITHOUT_GVL)
+static void run_without_gvl(image_io::blocking_function function, void *data) {
+  rb_thread_call_without_gvl(function, data, NULL, NULL);
+}
+#elif defined(HAVE_RB_THREAD_BLOCKING_REGION)
+struct BlockingRegion {
+  image_io::blocking_function function;
+  void *data;
+};
+
+static VALUE run_blocking_region(void *region) {
+  ((BlockingRegion*)region)->function(((BlockingRegion*)region)->data);
+  return Qnil;
+}
+
+static void run_without_gvl(image_io::blocking_function function, void *data) {
+  BlockingRegion region = { function, data };
+  rb_thread_blocking_region(run_blocking_region, &region, NULL, NULL);
+}
+#endif
+
+
 #include <stdint.h>		// Use the C99 official header
 
 
@@ -4461,6 +4499,98 @@ SWIG_From_unsigned_SS_long_SS_long  (unsigned long long value)
   return ULL2NUM(value);
 }
 
+
+SWIGINTERN int
+SWIG_AsVal_bool (VALUE obj, bool *val)
+{
+  if (obj == Qtrue) {
+    if (val) *val = true;
+    return SWIG_OK;
+  } else if (obj == Qfalse) {
+    if (val) *val = false;
+    return SWIG_OK;
+  } else {
+    int res = 0;
+    if (SWIG_AsVal_int (obj, &res) == SWIG_OK) {
+      if (val) *val = res ? true : false;
+      return SWIG_OK;
+    }
+  }
+  return SWIG_TypeError;
+}
+
+
+/*@SWIG:/usr/local/share/swig/2.0.2/ruby/rubyprimtypes.swg,19,%ruby_aux_method@*/
+SWIGINTERN VALUE SWIG_AUX_NUM2DBL(VALUE *args)
+{
+  VALUE obj = args[0];
+  VALUE type = TYPE(obj);
+  double *res = (double *)(args[1]);
+  *res = NUM2DBL(obj);
+  return obj;
+}
+/*@SWIG@*/
+
+SWIGINTERN int
+SWIG_AsVal_double (VALUE obj, double *val)
+{
+  VALUE type = TYPE(obj);
+  if ((type == T_FLOAT) || (type == T_FIXNUM) || (type == T_BIGNUM)) {
+    double v;
+    VALUE a[2];
+    a[0] = obj;
+    a[1] = (VALUE)(&v);
+    if (rb_rescue(RUBY_METHOD_FUNC(SWIG_AUX_NUM2DBL), (VALUE)a, RUBY_METHOD_FUNC(SWIG_ruby_failed), 0) != Qnil) {
+      if (val) *val = v;
+      return SWIG_OK;
+    }
+  }
+  return SWIG_TypeError;
+}
+
+
+SWIGINTERN int
+SWIG_AsPtr_std_string (VALUE obj, std::string **val)
+{
+  char* buf = 0 ; size_t size = 0; int alloc = SWIG_OLDOBJ;
+  if (SWIG_IsOK((SWIG_AsCharPtrAndSize(obj, &buf, &size, &alloc)))) {
+    if (buf) {
+      if (val) *val = new std::string(buf, size - 1);
+      if (alloc == SWIG_NEWOBJ) delete[] buf;
+      return SWIG_NEWOBJ;
+    } else {
+      if (val) *val = 0;
+      return SWIG_OLDOBJ;
+    }
+  } else {
+    static int init = 0;
+    static swig_type_info* descriptor = 0;
+    if (!init) {
+      descriptor = SWIG_TypeQuery("std::string" " *");
+      init = 1;
+    }
+    if (descriptor) {
+      std::string *vptr;
+      int res = SWIG_ConvertPtr(obj, (void**)&vptr, descriptor, 0);
+      if (SWIG_IsOK(res) && val) *val = vptr;
+      return res;
+    }
+  }
+  return SWIG_ERROR;
+}
+
+
+SWIGINTERNINLINE VALUE
+SWIG_From_std_string  (const std::string& s)
+{
+  if (s.size()) {
+    return SWIG_FromCharPtrAndSize(s.data(), s.size());
+  } else {
+    return SWIG_FromCharPtrAndSize(s.c_str(), 0);
+  }
+}
+
+
 swig_class SwigClassGC_VALUE;
 
 
@@ -7929,126 +8059,63 @@ free_std_vector_Sl_int_Sg_(std::vector< int > *arg1) {
 }
 
 SWIGINTERN VALUE
-_wrap_default_hash_size_in_bytes_get(VALUE self) {
+_wrap_sniff_length_get(VALUE self) {
   VALUE _val;
   
-  _val = SWIG_From_int(static_cast< int >(mwisd_fp::default_hash_size_in_bytes));
+  _val = SWIG_From_int(static_cast< int >(image_io::sniff_length));
   return _val;
 }
 
 
-SWIGINTERN VALUE
-_wrap_compute_image_hash(int argc, VALUE *argv, VALUE self) {
-  char *arg1 = (char *) 0 ;
-  uint16_t **arg2 = 0 ;
-  int arg3 ;
-  int arg4 ;
-  int arg5 ;
-  int res1 ;
-  char *buf1 = 0 ;
-  int alloc1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  int val4 ;
-  int ecode4 = 0 ;
-  int val5 ;
-  int ecode5 = 0 ;
-  int result;
-  VALUE vresult = Qnil;
-  
-  if ((argc < 5) || (argc > 5)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 5)",argc); SWIG_fail;
-  }
-  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","mwisd_fp::compute_image_hash", 1, argv[0] ));
-  }
-  arg1 = reinterpret_cast< char * >(buf1);
-  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_unsigned_short,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t *&","mwisd_fp::compute_image_hash", 2, argv[1] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "uint16_t *&","mwisd_fp::compute_image_hash", 2, argv[1])); 
-  }
-  arg2 = reinterpret_cast< uint16_t ** >(argp2);
-  ecode3 = SWIG_AsVal_int(argv[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hash", 3, argv[2] ));
-  } 
-  arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(argv[3], &val4);
-  if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hash", 4, argv[3] ));
-  } 
-  arg4 = static_cast< int >(val4);
-  ecode5 = SWIG_AsVal_int(argv[4], &val5);
-  if (!SWIG_IsOK(ecode5)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hash", 5, argv[4] ));
-  } 
-  arg5 = static_cast< int >(val5);
-  result = (int)mwisd_fp::compute_image_hash((char const *)arg1,*arg2,arg3,arg4,arg5);
-  vresult = SWIG_From_int(static_cast< int >(result));
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
-  return vresult;
-fail:
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
-  return Qnil;
-}
-
+swig_class SwigClassImageInfo;
 
 SWIGINTERN VALUE
-_wrap_fast_pow(int argc, VALUE *argv, VALUE self) {
-  int arg1 ;
-  int arg2 ;
-  int val1 ;
-  int ecode1 = 0 ;
+_wrap_ImageInfo_format_set(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
+  image_io::image_format arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
   int val2 ;
   int ecode2 = 0 ;
-  int result;
-  VALUE vresult = Qnil;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  ecode1 = SWIG_AsVal_int(argv[0], &val1);
-  if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","mwisd_fp::fast_pow", 1, argv[0] ));
-  } 
-  arg1 = static_cast< int >(val1);
-  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","format", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","mwisd_fp::fast_pow", 2, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "image_io::image_format","format", 2, argv[0] ));
   } 
-  arg2 = static_cast< int >(val2);
-  result = (int)mwisd_fp::fast_pow(arg1,arg2);
-  vresult = SWIG_From_int(static_cast< int >(result));
-  return vresult;
+  arg2 = static_cast< image_io::image_format >(val2);
+  if (arg1) (arg1)->format = arg2;
+  return Qnil;
 fail:
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_fast_popcount_64(int argc, VALUE *argv, VALUE self) {
-  uint64_t arg1 ;
-  unsigned long long val1 ;
-  int ecode1 = 0 ;
-  uint8_t result;
+_wrap_ImageInfo_format_get(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  image_io::image_format result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  ecode1 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val1);
-  if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint64_t","mwisd_fp::fast_popcount_64", 1, argv[0] ));
-  } 
-  arg1 = static_cast< uint64_t >(val1);
-  result = (uint8_t)mwisd_fp::fast_popcount_64(arg1);
-  vresult = SWIG_From_unsigned_SS_char(static_cast< unsigned char >(result));
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","format", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  result = (image_io::image_format) ((arg1)->format);
+  vresult = SWIG_From_int(static_cast< int >(result));
   return vresult;
 fail:
   return Qnil;
@@ -8056,148 +8123,134 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_hamming_distance(int argc, VALUE *argv, VALUE self) {
-  uint16_t *arg1 = (uint16_t *) 0 ;
-  uint16_t *arg2 = (uint16_t *) 0 ;
-  int arg3 ;
+_wrap_ImageInfo_width_set(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  double result;
-  VALUE vresult = Qnil;
+  int val2 ;
+  int ecode2 = 0 ;
   
-  if ((argc < 3) || (argc > 3)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(argv[0], &argp1,SWIGTYPE_p_unsigned_short, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "uint16_t *","mwisd_fp::hamming_distance", 1, argv[0] )); 
-  }
-  arg1 = reinterpret_cast< uint16_t * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[1], &argp2,SWIGTYPE_p_unsigned_short, 0 |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t *","mwisd_fp::hamming_distance", 2, argv[1] )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","width", 1, self )); 
   }
-  arg2 = reinterpret_cast< uint16_t * >(argp2);
-  ecode3 = SWIG_AsVal_int(argv[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","mwisd_fp::hamming_distance", 3, argv[2] ));
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","width", 2, argv[0] ));
   } 
-  arg3 = static_cast< int >(val3);
-  result = (double)mwisd_fp::hamming_distance(arg1,arg2,arg3);
-  vresult = SWIG_From_double(static_cast< double >(result));
-  return vresult;
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->width = arg2;
+  return Qnil;
 fail:
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_read_hash_from_text(int argc, VALUE *argv, VALUE self) {
-  char *arg1 = (char *) 0 ;
-  uint16_t **arg2 = 0 ;
-  int arg3 ;
-  int res1 ;
-  char *buf1 = 0 ;
-  int alloc1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
+_wrap_ImageInfo_width_get(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
   int result;
   VALUE vresult = Qnil;
   
-  if ((argc < 3) || (argc > 3)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char *","mwisd_fp::read_hash_from_text", 1, argv[0] ));
-  }
-  arg1 = reinterpret_cast< char * >(buf1);
-  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_unsigned_short,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t *&","mwisd_fp::read_hash_from_text", 2, argv[1] )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","width", 1, self )); 
   }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "uint16_t *&","mwisd_fp::read_hash_from_text", 2, argv[1])); 
-  }
-  arg2 = reinterpret_cast< uint16_t ** >(argp2);
-  ecode3 = SWIG_AsVal_int(argv[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","mwisd_fp::read_hash_from_text", 3, argv[2] ));
-  } 
-  arg3 = static_cast< int >(val3);
-  result = (int)mwisd_fp::read_hash_from_text(arg1,*arg2,arg3);
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  result = (int) ((arg1)->width);
   vresult = SWIG_From_int(static_cast< int >(result));
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return vresult;
 fail:
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_convert_to_mirror_flip(int argc, VALUE *argv, VALUE self) {
-  uint16_t **arg1 = 0 ;
+_wrap_ImageInfo_height_set(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
   int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int val2 ;
   int ecode2 = 0 ;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(argv[0], &argp1, SWIGTYPE_p_p_unsigned_short,  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "uint16_t *&","mwisd_fp::convert_to_mirror_flip", 1, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","height", 1, self )); 
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "uint16_t *&","mwisd_fp::convert_to_mirror_flip", 1, argv[0])); 
-  }
-  arg1 = reinterpret_cast< uint16_t ** >(argp1);
-  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","mwisd_fp::convert_to_mirror_flip", 2, argv[1] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","height", 2, argv[0] ));
   } 
   arg2 = static_cast< int >(val2);
-  mwisd_fp::convert_to_mirror_flip(*arg1,arg2);
+  if (arg1) (arg1)->height = arg2;
   return Qnil;
 fail:
   return Qnil;
 }
 
 
-swig_class SwigClassFingerprint;
+SWIGINTERN VALUE
+_wrap_ImageInfo_height_get(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","height", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  result = (int) ((arg1)->height);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_contents_set(int argc, VALUE *argv, VALUE self) {
-  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
-  uint16_t *arg2 = (uint16_t *) 0 ;
+_wrap_ImageInfo_channels_set(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
+  int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","contents", 1, self )); 
-  }
-  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_unsigned_short, SWIG_POINTER_DISOWN |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t *","contents", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","channels", 1, self )); 
   }
-  arg2 = reinterpret_cast< uint16_t * >(argp2);
-  if (arg1) (arg1)->contents = arg2;
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","channels", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->channels = arg2;
   return Qnil;
 fail:
   return Qnil;
@@ -8205,23 +8258,23 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_contents_get(int argc, VALUE *argv, VALUE self) {
-  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+_wrap_ImageInfo_channels_get(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  uint16_t *result = 0 ;
+  int result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","contents", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","channels", 1, self )); 
   }
-  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
-  result = (uint16_t *) ((arg1)->contents);
-  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_unsigned_short, 0 |  0 );
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  result = (int) ((arg1)->channels);
+  vresult = SWIG_From_int(static_cast< int >(result));
   return vresult;
 fail:
   return Qnil;
@@ -8229,8 +8282,8 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_size_in_bytes_set(int argc, VALUE *argv, VALUE self) {
-  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+_wrap_ImageInfo_bit_depth_set(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
   int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -8240,17 +8293,17 @@ _wrap_Fingerprint_size_in_bytes_set(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","size_in_bytes", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","bit_depth", 1, self )); 
   }
-  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
   ecode2 = SWIG_AsVal_int(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","size_in_bytes", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","bit_depth", 2, argv[0] ));
   } 
   arg2 = static_cast< int >(val2);
-  if (arg1) (arg1)->size_in_bytes = arg2;
+  if (arg1) (arg1)->bit_depth = arg2;
   return Qnil;
 fail:
   return Qnil;
@@ -8258,8 +8311,8 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_size_in_bytes_get(int argc, VALUE *argv, VALUE self) {
-  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+_wrap_ImageInfo_bit_depth_get(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int result;
@@ -8268,12 +8321,12 @@ _wrap_Fingerprint_size_in_bytes_get(int argc, VALUE *argv, VALUE self) {
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","size_in_bytes", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","bit_depth", 1, self )); 
   }
-  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
-  result = (int) ((arg1)->size_in_bytes);
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  result = (int) ((arg1)->bit_depth);
   vresult = SWIG_From_int(static_cast< int >(result));
   return vresult;
 fail:
@@ -8282,23 +8335,53 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_new_Fingerprint__SWIG_0(int argc, VALUE *argv, VALUE self) {
-  int arg1 ;
-  int val1 ;
-  int ecode1 = 0 ;
-  mwisd_fp::Fingerprint *result = 0 ;
+_wrap_ImageInfo_progressive_set(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
+  bool arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
   
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  ecode1 = SWIG_AsVal_int(argv[0], &val1);
-  if (!SWIG_IsOK(ecode1)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","mwisd_fp::Fingerprint", 1, argv[0] ));
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","progressive", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  ecode2 = SWIG_AsVal_bool(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "bool","progressive", 2, argv[0] ));
   } 
-  arg1 = static_cast< int >(val1);
-  result = (mwisd_fp::Fingerprint *)new mwisd_fp::Fingerprint(arg1);
-  DATA_PTR(self) = result;
-  return self;
+  arg2 = static_cast< bool >(val2);
+  if (arg1) (arg1)->progressive = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_ImageInfo_progressive_get(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = (image_io::ImageInfo *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  bool result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo *","progressive", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  result = (bool) ((arg1)->progressive);
+  vresult = SWIG_From_bool(static_cast< bool >(result));
+  return vresult;
 fail:
   return Qnil;
 }
@@ -8306,14 +8389,14 @@ fail:
 
 #ifdef HAVE_RB_DEFINE_ALLOC_FUNC
 SWIGINTERN VALUE
-_wrap_Fingerprint_allocate(VALUE self) {
+_wrap_ImageInfo_allocate(VALUE self) {
 #else
   SWIGINTERN VALUE
-  _wrap_Fingerprint_allocate(int argc, VALUE *argv, VALUE self) {
+  _wrap_ImageInfo_allocate(int argc, VALUE *argv, VALUE self) {
 #endif
     
     
-    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_mwisd_fp__Fingerprint);
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_image_io__ImageInfo);
 #ifndef HAVE_RB_DEFINE_ALLOC_FUNC
     rb_obj_call_init(vresult, argc, argv);
 #endif
@@ -8322,13 +8405,13 @@ _wrap_Fingerprint_allocate(VALUE self) {
   
 
 SWIGINTERN VALUE
-_wrap_new_Fingerprint__SWIG_1(int argc, VALUE *argv, VALUE self) {
-  mwisd_fp::Fingerprint *result = 0 ;
+_wrap_new_ImageInfo(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *result = 0 ;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  result = (mwisd_fp::Fingerprint *)new mwisd_fp::Fingerprint();
+  result = (image_io::ImageInfo *)new image_io::ImageInfo();
   DATA_PTR(self) = result;
   return self;
 fail:
@@ -8336,128 +8419,3293 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_new_Fingerprint(int nargs, VALUE *args, VALUE self) {
-  int argc;
-  VALUE argv[1];
-  int ii;
+SWIGINTERN void
+free_image_io_ImageInfo(image_io::ImageInfo *arg1) {
+    delete arg1;
+}
+
+swig_class SwigClassDecodeOptions;
+
+SWIGINTERN VALUE
+_wrap_DecodeOptions_max_pixels_set(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  uint64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned long long val2 ;
+  int ecode2 = 0 ;
   
-  argc = nargs;
-  if (argc > 1) SWIG_fail;
-  for (ii = 0; (ii < argc); ++ii) {
-    argv[ii] = args[ii];
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  if (argc == 0) {
-    return _wrap_new_Fingerprint__SWIG_1(nargs, args, self);
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","max_pixels", 1, self )); 
   }
-  if (argc == 1) {
-    int _v;
-    {
-      int res = SWIG_AsVal_int(argv[0], NULL);
-      _v = SWIG_CheckState(res);
-    }
-    if (_v) {
-      return _wrap_new_Fingerprint__SWIG_0(nargs, args, self);
-    }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","max_pixels", 2, argv[0] ));
+  } 
+  arg2 = static_cast< uint64_t >(val2);
+  if (arg1) (arg1)->max_pixels = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_DecodeOptions_max_pixels_get(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","max_pixels", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  result = (uint64_t) ((arg1)->max_pixels);
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_DecodeOptions_min_dim_set(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
   
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","min_dim", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","min_dim", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->min_dim = arg2;
+  return Qnil;
 fail:
-  Ruby_Format_OverloadedError( argc, 1, "Fingerprint.new", 
-    "    Fingerprint.new(int hash_size_in_bytes)\n"
-    "    Fingerprint.new()\n");
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_DecodeOptions_min_dim_get(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
   
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","min_dim", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  result = (int) ((arg1)->min_dim);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
   return Qnil;
 }
 
 
-SWIGINTERN void
-free_mwisd_fp_Fingerprint(mwisd_fp::Fingerprint *arg1) {
-    delete arg1;
+SWIGINTERN VALUE
+_wrap_DecodeOptions_memory_cap_set(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  uint64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned long long val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","memory_cap", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","memory_cap", 2, argv[0] ));
+  } 
+  arg2 = static_cast< uint64_t >(val2);
+  if (arg1) (arg1)->memory_cap = arg2;
+  return Qnil;
+fail:
+  return Qnil;
 }
 
+
 SWIGINTERN VALUE
-_wrap_Fingerprint_as_char_array(int argc, VALUE *argv, VALUE self) {
-  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+_wrap_DecodeOptions_memory_cap_get(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  char *result = 0 ;
+  uint64_t result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","as_char_array", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","memory_cap", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  result = (uint64_t) ((arg1)->memory_cap);
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_DecodeOptions_preview_min_dim_set(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","preview_min_dim", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","preview_min_dim", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->preview_min_dim = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_DecodeOptions_preview_min_dim_get(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *arg1 = (image_io::DecodeOptions *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","preview_min_dim", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::DecodeOptions * >(argp1);
+  result = (int) ((arg1)->preview_min_dim);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+SWIGINTERN VALUE
+_wrap_DecodeOptions_allocate(VALUE self) {
+#else
+  SWIGINTERN VALUE
+  _wrap_DecodeOptions_allocate(int argc, VALUE *argv, VALUE self) {
+#endif
+    
+    
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_image_io__DecodeOptions);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+    rb_obj_call_init(vresult, argc, argv);
+#endif
+    return vresult;
+  }
+  
+
+SWIGINTERN VALUE
+_wrap_new_DecodeOptions(int argc, VALUE *argv, VALUE self) {
+  image_io::DecodeOptions *result = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  result = (image_io::DecodeOptions *)new image_io::DecodeOptions();
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_image_io_DecodeOptions(image_io::DecodeOptions *arg1) {
+    delete arg1;
+}
+
+swig_class SwigClassEmbeddedPreview;
+
+SWIGINTERN VALUE
+_wrap_EmbeddedPreview_offset_set(int argc, VALUE *argv, VALUE self) {
+  image_io::EmbeddedPreview *arg1 = (image_io::EmbeddedPreview *) 0 ;
+  uint64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned long long val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__EmbeddedPreview, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::EmbeddedPreview *","offset", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::EmbeddedPreview * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","offset", 2, argv[0] ));
+  } 
+  arg2 = static_cast< uint64_t >(val2);
+  if (arg1) (arg1)->offset = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_EmbeddedPreview_offset_get(int argc, VALUE *argv, VALUE self) {
+  image_io::EmbeddedPreview *arg1 = (image_io::EmbeddedPreview *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__EmbeddedPreview, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::EmbeddedPreview *","offset", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::EmbeddedPreview * >(argp1);
+  result = (uint64_t) ((arg1)->offset);
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_EmbeddedPreview_length_set(int argc, VALUE *argv, VALUE self) {
+  image_io::EmbeddedPreview *arg1 = (image_io::EmbeddedPreview *) 0 ;
+  uint64_t arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned long long val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__EmbeddedPreview, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::EmbeddedPreview *","length", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::EmbeddedPreview * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "uint64_t","length", 2, argv[0] ));
+  } 
+  arg2 = static_cast< uint64_t >(val2);
+  if (arg1) (arg1)->length = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_EmbeddedPreview_length_get(int argc, VALUE *argv, VALUE self) {
+  image_io::EmbeddedPreview *arg1 = (image_io::EmbeddedPreview *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint64_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__EmbeddedPreview, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::EmbeddedPreview *","length", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::EmbeddedPreview * >(argp1);
+  result = (uint64_t) ((arg1)->length);
+  vresult = SWIG_From_unsigned_SS_long_SS_long(static_cast< unsigned long long >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_EmbeddedPreview_info_set(int argc, VALUE *argv, VALUE self) {
+  image_io::EmbeddedPreview *arg1 = (image_io::EmbeddedPreview *) 0 ;
+  image_io::ImageInfo *arg2 = (image_io::ImageInfo *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__EmbeddedPreview, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::EmbeddedPreview *","info", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::EmbeddedPreview * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "image_io::ImageInfo *","info", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< image_io::ImageInfo * >(argp2);
+  if (arg1) (arg1)->info = *arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_EmbeddedPreview_info_get(int argc, VALUE *argv, VALUE self) {
+  image_io::EmbeddedPreview *arg1 = (image_io::EmbeddedPreview *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  image_io::ImageInfo *result = 0 ;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_image_io__EmbeddedPreview, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::EmbeddedPreview *","info", 1, self )); 
+  }
+  arg1 = reinterpret_cast< image_io::EmbeddedPreview * >(argp1);
+  result = (image_io::ImageInfo *)& ((arg1)->info);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_image_io__ImageInfo, 0 |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+SWIGINTERN VALUE
+_wrap_EmbeddedPreview_allocate(VALUE self) {
+#else
+  SWIGINTERN VALUE
+  _wrap_EmbeddedPreview_allocate(int argc, VALUE *argv, VALUE self) {
+#endif
+    
+    
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_image_io__EmbeddedPreview);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+    rb_obj_call_init(vresult, argc, argv);
+#endif
+    return vresult;
+  }
+  
+
+SWIGINTERN VALUE
+_wrap_new_EmbeddedPreview(int argc, VALUE *argv, VALUE self) {
+  image_io::EmbeddedPreview *result = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  result = (image_io::EmbeddedPreview *)new image_io::EmbeddedPreview();
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_image_io_EmbeddedPreview(image_io::EmbeddedPreview *arg1) {
+    delete arg1;
+}
+
+SWIGINTERN VALUE
+_wrap_load_ok_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::load_ok));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_arguments_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_arguments));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_open_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_open));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_unknown_format_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_unknown_format));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_decode_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_decode));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_too_large_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_too_large));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_not_streamable_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_not_streamable));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_error_needs_file_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(image_io::error_needs_file));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_sniff_file_format(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  image_io::image_format *arg2 = 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","image_io::sniff_file_format", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_image_io__image_format,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "image_io::image_format &","image_io::sniff_file_format", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::image_format &","image_io::sniff_file_format", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< image_io::image_format * >(argp2);
+  result = (int)image_io::sniff_file_format((char const *)arg1,*arg2);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_probe_image(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  image_io::ImageInfo *arg2 = 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","image_io::probe_image", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_image_io__ImageInfo,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "image_io::ImageInfo &","image_io::probe_image", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::ImageInfo &","image_io::probe_image", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< image_io::ImageInfo * >(argp2);
+  result = (int)image_io::probe_image((char const *)arg1,*arg2);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_probe_image_data(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  image_io::ImageInfo *arg3 = 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","image_io::probe_image", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_image_io__ImageInfo,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "image_io::ImageInfo &","image_io::probe_image", 3, argv[1] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::ImageInfo &","image_io::probe_image", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< image_io::ImageInfo * >(argp3);
+  result = (int)image_io::probe_image((char const *)arg1,arg2,*arg3);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_find_preview(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  int arg2 ;
+  image_io::EmbeddedPreview *arg3 = 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","image_io::find_preview", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","image_io::find_preview", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  res3 = SWIG_ConvertPtr(argv[2], &argp3, SWIGTYPE_p_image_io__EmbeddedPreview,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "image_io::EmbeddedPreview &","image_io::find_preview", 3, argv[2] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::EmbeddedPreview &","image_io::find_preview", 3, argv[2])); 
+  }
+  arg3 = reinterpret_cast< image_io::EmbeddedPreview * >(argp3);
+  result = (int)image_io::find_preview((char const *)arg1,arg2,*arg3);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_jpeg_scale_denom(int argc, VALUE *argv, VALUE self) {
+  image_io::ImageInfo *arg1 = 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1, SWIGTYPE_p_image_io__ImageInfo,  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "image_io::ImageInfo const &","image_io::jpeg_scale_denom", 1, argv[0] )); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::ImageInfo const &","image_io::jpeg_scale_denom", 1, argv[0])); 
+  }
+  arg1 = reinterpret_cast< image_io::ImageInfo * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","image_io::jpeg_scale_denom", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  result = (int)image_io::jpeg_scale_denom((image_io::ImageInfo const &)*arg1,arg2);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_default_hash_size_in_bytes_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(mwisd_fp::default_hash_size_in_bytes));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_default_heat_map_dim_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(mwisd_fp::default_heat_map_dim));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_default_block_dim_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(mwisd_fp::default_block_dim));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_heat_map_blob_version_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(mwisd_fp::heat_map_blob_version));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_heat_map_blob_header_size_get(VALUE self) {
+  VALUE _val;
+  
+  _val = SWIG_From_int(static_cast< int >(mwisd_fp::heat_map_blob_header_size));
+  return _val;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_hash__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  uint16_t **arg2 = 0 ;
+  int arg3 ;
+  int arg4 ;
+  int arg5 ;
+  image_io::DecodeOptions *arg6 = 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  void *argp6 = 0 ;
+  int res6 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 6) || (argc > 6)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","mwisd_fp::compute_image_hash", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_unsigned_short,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t *&","mwisd_fp::compute_image_hash", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "uint16_t *&","mwisd_fp::compute_image_hash", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< uint16_t ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hash", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hash", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  ecode5 = SWIG_AsVal_int(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hash", 5, argv[4] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_image_io__DecodeOptions,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "image_io::DecodeOptions const &","mwisd_fp::compute_image_hash", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::DecodeOptions const &","mwisd_fp::compute_image_hash", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< image_io::DecodeOptions * >(argp6);
+  result = (int)mwisd_fp::compute_image_hash((char const *)arg1,*arg2,arg3,arg4,arg5,(image_io::DecodeOptions const &)*arg6);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_hash__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  uint16_t **arg2 = 0 ;
+  int arg3 ;
+  int arg4 ;
+  int arg5 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 5) || (argc > 5)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 5)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","mwisd_fp::compute_image_hash", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_unsigned_short,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t *&","mwisd_fp::compute_image_hash", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "uint16_t *&","mwisd_fp::compute_image_hash", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< uint16_t ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hash", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hash", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  ecode5 = SWIG_AsVal_int(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hash", 5, argv[4] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  result = (int)mwisd_fp::compute_image_hash((char const *)arg1,*arg2,arg3,arg4,arg5);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_compute_image_hash(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[6];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 6) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 5) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_unsigned_short, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_compute_image_hash__SWIG_1(nargs, args, self);
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 6) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_unsigned_short, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              void *vptr = 0;
+              int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_image_io__DecodeOptions, 0);
+              _v = SWIG_CheckState(res);
+              if (_v) {
+                return _wrap_compute_image_hash__SWIG_0(nargs, args, self);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 6, "compute_image_hash", 
+    "    int compute_image_hash(char const *filename, uint16_t *&hash, int hash_size_in_bytes, int wavelet_scale_base, int wavelet_scale_exponent, image_io::DecodeOptions const &options)\n"
+    "    int compute_image_hash(char const *filename, uint16_t *&hash, int hash_size_in_bytes, int wavelet_scale_base, int wavelet_scale_exponent)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_hashes__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  uint16_t **arg2 = (uint16_t **) 0 ;
+  int *arg3 = (int *) 0 ;
+  int arg4 ;
+  int arg5 ;
+  int arg6 ;
+  image_io::DecodeOptions *arg7 = 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  int val6 ;
+  int ecode6 = 0 ;
+  void *argp7 = 0 ;
+  int res7 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 7) || (argc > 7)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 7)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","mwisd_fp::compute_image_hashes", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2,SWIGTYPE_p_p_unsigned_short, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t **","mwisd_fp::compute_image_hashes", 2, argv[1] )); 
+  }
+  arg2 = reinterpret_cast< uint16_t ** >(argp2);
+  res3 = SWIG_ConvertPtr(argv[2], &argp3,SWIGTYPE_p_int, 0 |  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "int const *","mwisd_fp::compute_image_hashes", 3, argv[2] )); 
+  }
+  arg3 = reinterpret_cast< int * >(argp3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hashes", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  ecode5 = SWIG_AsVal_int(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hashes", 5, argv[4] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  ecode6 = SWIG_AsVal_int(argv[5], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hashes", 6, argv[5] ));
+  } 
+  arg6 = static_cast< int >(val6);
+  res7 = SWIG_ConvertPtr(argv[6], &argp7, SWIGTYPE_p_image_io__DecodeOptions,  0 );
+  if (!SWIG_IsOK(res7)) {
+    SWIG_exception_fail(SWIG_ArgError(res7), Ruby_Format_TypeError( "", "image_io::DecodeOptions const &","mwisd_fp::compute_image_hashes", 7, argv[6] )); 
+  }
+  if (!argp7) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::DecodeOptions const &","mwisd_fp::compute_image_hashes", 7, argv[6])); 
+  }
+  arg7 = reinterpret_cast< image_io::DecodeOptions * >(argp7);
+  result = (int)mwisd_fp::compute_image_hashes((char const *)arg1,arg2,(int const *)arg3,arg4,arg5,arg6,(image_io::DecodeOptions const &)*arg7);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_hashes__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  uint16_t **arg2 = (uint16_t **) 0 ;
+  int *arg3 = (int *) 0 ;
+  int arg4 ;
+  int arg5 ;
+  int arg6 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  int val6 ;
+  int ecode6 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 6) || (argc > 6)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","mwisd_fp::compute_image_hashes", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2,SWIGTYPE_p_p_unsigned_short, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t **","mwisd_fp::compute_image_hashes", 2, argv[1] )); 
+  }
+  arg2 = reinterpret_cast< uint16_t ** >(argp2);
+  res3 = SWIG_ConvertPtr(argv[2], &argp3,SWIGTYPE_p_int, 0 |  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "int const *","mwisd_fp::compute_image_hashes", 3, argv[2] )); 
+  }
+  arg3 = reinterpret_cast< int * >(argp3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hashes", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  ecode5 = SWIG_AsVal_int(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hashes", 5, argv[4] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  ecode6 = SWIG_AsVal_int(argv[5], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_hashes", 6, argv[5] ));
+  } 
+  arg6 = static_cast< int >(val6);
+  result = (int)mwisd_fp::compute_image_hashes((char const *)arg1,arg2,(int const *)arg3,arg4,arg5,arg6);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_compute_image_hashes(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[7];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 7) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 6) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_unsigned_short, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_int, 0);
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                int res = SWIG_AsVal_int(argv[5], NULL);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                return _wrap_compute_image_hashes__SWIG_1(nargs, args, self);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 7) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_unsigned_short, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_int, 0);
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                int res = SWIG_AsVal_int(argv[5], NULL);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                void *vptr = 0;
+                int res = SWIG_ConvertPtr(argv[6], &vptr, SWIGTYPE_p_image_io__DecodeOptions, 0);
+                _v = SWIG_CheckState(res);
+                if (_v) {
+                  return _wrap_compute_image_hashes__SWIG_0(nargs, args, self);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 7, "compute_image_hashes", 
+    "    int compute_image_hashes(char const *filename, uint16_t **hashes, int const *hash_sizes_in_bytes, int count, int wavelet_scale_base, int wavelet_scale_exponent, image_io::DecodeOptions const &options)\n"
+    "    int compute_image_hashes(char const *filename, uint16_t **hashes, int const *hash_sizes_in_bytes, int count, int wavelet_scale_base, int wavelet_scale_exponent)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_hash_layout(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int *arg2 = 0 ;
+  int *arg3 = 0 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","mwisd_fp::hash_layout", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_int,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "int &","mwisd_fp::hash_layout", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "int &","mwisd_fp::hash_layout", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< int * >(argp2);
+  res3 = SWIG_ConvertPtr(argv[2], &argp3, SWIGTYPE_p_int,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "int &","mwisd_fp::hash_layout", 3, argv[2] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "int &","mwisd_fp::hash_layout", 3, argv[2])); 
+  }
+  arg3 = reinterpret_cast< int * >(argp3);
+  result = (int)mwisd_fp::hash_layout(arg1,*arg2,*arg3);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_heat_map__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  float **arg2 = 0 ;
+  int arg3 ;
+  int arg4 ;
+  int arg5 ;
+  image_io::DecodeOptions *arg6 = 0 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  void *argp6 = 0 ;
+  int res6 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 6) || (argc > 6)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","mwisd_fp::compute_image_heat_map", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_float,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *&","mwisd_fp::compute_image_heat_map", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "float *&","mwisd_fp::compute_image_heat_map", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< float ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_heat_map", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_heat_map", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  ecode5 = SWIG_AsVal_int(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_heat_map", 5, argv[4] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  res6 = SWIG_ConvertPtr(argv[5], &argp6, SWIGTYPE_p_image_io__DecodeOptions,  0 );
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), Ruby_Format_TypeError( "", "image_io::DecodeOptions const &","mwisd_fp::compute_image_heat_map", 6, argv[5] )); 
+  }
+  if (!argp6) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "image_io::DecodeOptions const &","mwisd_fp::compute_image_heat_map", 6, argv[5])); 
+  }
+  arg6 = reinterpret_cast< image_io::DecodeOptions * >(argp6);
+  result = (int)mwisd_fp::compute_image_heat_map((char const *)arg1,*arg2,arg3,arg4,arg5,(image_io::DecodeOptions const &)*arg6);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compute_image_heat_map__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  float **arg2 = 0 ;
+  int arg3 ;
+  int arg4 ;
+  int arg5 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 5) || (argc > 5)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 5)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","mwisd_fp::compute_image_heat_map", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_float,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "float *&","mwisd_fp::compute_image_heat_map", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "float *&","mwisd_fp::compute_image_heat_map", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< float ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_heat_map", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_heat_map", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  ecode5 = SWIG_AsVal_int(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","mwisd_fp::compute_image_heat_map", 5, argv[4] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  result = (int)mwisd_fp::compute_image_heat_map((char const *)arg1,*arg2,arg3,arg4,arg5);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_compute_image_heat_map(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[6];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 6) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 5) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_float, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_compute_image_heat_map__SWIG_1(nargs, args, self);
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 6) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_p_float, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              void *vptr = 0;
+              int res = SWIG_ConvertPtr(argv[5], &vptr, SWIGTYPE_p_image_io__DecodeOptions, 0);
+              _v = SWIG_CheckState(res);
+              if (_v) {
+                return _wrap_compute_image_heat_map__SWIG_0(nargs, args, self);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 6, "compute_image_heat_map", 
+    "    int compute_image_heat_map(char const *filename, float *&heat_map, int heat_map_dim, int wavelet_scale_base, int wavelet_scale_exponent, image_io::DecodeOptions const &options)\n"
+    "    int compute_image_heat_map(char const *filename, float *&heat_map, int heat_map_dim, int wavelet_scale_base, int wavelet_scale_exponent)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_hash_from_heat_map__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  float *arg1 = (float *) 0 ;
+  int arg2 ;
+  uint16_t **arg3 = 0 ;
+  int arg4 ;
+  int arg5 ;
+  int arg6 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  int val6 ;
+  int ecode6 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 6) || (argc > 6)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 6)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1,SWIGTYPE_p_float, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "float const *","mwisd_fp::hash_from_heat_map", 1, argv[0] )); 
+  }
+  arg1 = reinterpret_cast< float * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","mwisd_fp::hash_from_heat_map", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  res3 = SWIG_ConvertPtr(argv[2], &argp3, SWIGTYPE_p_p_unsigned_short,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "uint16_t *&","mwisd_fp::hash_from_heat_map", 3, argv[2] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "uint16_t *&","mwisd_fp::hash_from_heat_map", 3, argv[2])); 
+  }
+  arg3 = reinterpret_cast< uint16_t ** >(argp3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","mwisd_fp::hash_from_heat_map", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  ecode5 = SWIG_AsVal_int(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","mwisd_fp::hash_from_heat_map", 5, argv[4] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  ecode6 = SWIG_AsVal_int(argv[5], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "int","mwisd_fp::hash_from_heat_map", 6, argv[5] ));
+  } 
+  arg6 = static_cast< int >(val6);
+  result = (int)mwisd_fp::hash_from_heat_map((float const *)arg1,arg2,*arg3,arg4,arg5,arg6);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_hash_from_heat_map__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  float *arg1 = (float *) 0 ;
+  int arg2 ;
+  uint16_t **arg3 = 0 ;
+  int arg4 ;
+  int arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 5) || (argc > 5)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 5)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1,SWIGTYPE_p_float, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "float const *","mwisd_fp::hash_from_heat_map", 1, argv[0] )); 
+  }
+  arg1 = reinterpret_cast< float * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","mwisd_fp::hash_from_heat_map", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  res3 = SWIG_ConvertPtr(argv[2], &argp3, SWIGTYPE_p_p_unsigned_short,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "uint16_t *&","mwisd_fp::hash_from_heat_map", 3, argv[2] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "uint16_t *&","mwisd_fp::hash_from_heat_map", 3, argv[2])); 
+  }
+  arg3 = reinterpret_cast< uint16_t ** >(argp3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","mwisd_fp::hash_from_heat_map", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  ecode5 = SWIG_AsVal_int(argv[4], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "int","mwisd_fp::hash_from_heat_map", 5, argv[4] ));
+  } 
+  arg5 = static_cast< int >(val5);
+  result = (int)mwisd_fp::hash_from_heat_map((float const *)arg1,arg2,*arg3,arg4,arg5);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_hash_from_heat_map__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  float *arg1 = (float *) 0 ;
+  int arg2 ;
+  uint16_t **arg3 = 0 ;
+  int arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1,SWIGTYPE_p_float, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "float const *","mwisd_fp::hash_from_heat_map", 1, argv[0] )); 
+  }
+  arg1 = reinterpret_cast< float * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","mwisd_fp::hash_from_heat_map", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  res3 = SWIG_ConvertPtr(argv[2], &argp3, SWIGTYPE_p_p_unsigned_short,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "uint16_t *&","mwisd_fp::hash_from_heat_map", 3, argv[2] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "uint16_t *&","mwisd_fp::hash_from_heat_map", 3, argv[2])); 
+  }
+  arg3 = reinterpret_cast< uint16_t ** >(argp3);
+  ecode4 = SWIG_AsVal_int(argv[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","mwisd_fp::hash_from_heat_map", 4, argv[3] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  result = (int)mwisd_fp::hash_from_heat_map((float const *)arg1,arg2,*arg3,arg4);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_hash_from_heat_map(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[6];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 6) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_float, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_p_unsigned_short, 0);
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_hash_from_heat_map__SWIG_2(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_float, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_p_unsigned_short, 0);
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_hash_from_heat_map__SWIG_1(nargs, args, self);
+            }
+          }
+        }
+      }
+    }
+  }
+  if (argc == 6) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_float, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_p_unsigned_short, 0);
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              {
+                int res = SWIG_AsVal_int(argv[5], NULL);
+                _v = SWIG_CheckState(res);
+              }
+              if (_v) {
+                return _wrap_hash_from_heat_map__SWIG_0(nargs, args, self);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 6, "hash_from_heat_map", 
+    "    int hash_from_heat_map(float const *heat_map, int heat_map_dim, uint16_t *&hash, int hash_size_in_bytes, int block_dim, int rule)\n"
+    "    int hash_from_heat_map(float const *heat_map, int heat_map_dim, uint16_t *&hash, int hash_size_in_bytes, int block_dim)\n"
+    "    int hash_from_heat_map(float const *heat_map, int heat_map_dim, uint16_t *&hash, int hash_size_in_bytes)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_pack_heat_map(int argc, VALUE *argv, VALUE self) {
+  float *arg1 = (float *) 0 ;
+  int arg2 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1,SWIGTYPE_p_float, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "float const *","mwisd_fp::pack_heat_map", 1, argv[0] )); 
+  }
+  arg1 = reinterpret_cast< float * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","mwisd_fp::pack_heat_map", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  res3 = SWIG_ConvertPtr(argv[2], &argp3, SWIGTYPE_p_std__string,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "std::string &","mwisd_fp::pack_heat_map", 3, argv[2] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string &","mwisd_fp::pack_heat_map", 3, argv[2])); 
+  }
+  arg3 = reinterpret_cast< std::string * >(argp3);
+  result = (int)mwisd_fp::pack_heat_map((float const *)arg1,arg2,*arg3);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_unpack_heat_map(int argc, VALUE *argv, VALUE self) {
+  std::string *arg1 = 0 ;
+  std::vector< float,std::allocator< float > > *arg2 = 0 ;
+  int *arg3 = 0 ;
+  int res1 = SWIG_OLDOBJ ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res1 = SWIG_AsPtr_std_string(argv[0], &ptr);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "std::string const &","mwisd_fp::unpack_heat_map", 1, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","mwisd_fp::unpack_heat_map", 1, argv[0])); 
+    }
+    arg1 = ptr;
+  }
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_std__vectorT_float_std__allocatorT_float_t_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< float,std::allocator< float > > &","mwisd_fp::unpack_heat_map", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< float,std::allocator< float > > &","mwisd_fp::unpack_heat_map", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< std::vector< float,std::allocator< float > > * >(argp2);
+  res3 = SWIG_ConvertPtr(argv[2], &argp3, SWIGTYPE_p_int,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "int &","mwisd_fp::unpack_heat_map", 3, argv[2] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "int &","mwisd_fp::unpack_heat_map", 3, argv[2])); 
+  }
+  arg3 = reinterpret_cast< int * >(argp3);
+  result = (int)mwisd_fp::unpack_heat_map((std::string const &)*arg1,*arg2,*arg3);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  return vresult;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_fast_pow(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int arg2 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","mwisd_fp::fast_pow", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","mwisd_fp::fast_pow", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  result = (int)mwisd_fp::fast_pow(arg1,arg2);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_fast_popcount_64(int argc, VALUE *argv, VALUE self) {
+  uint64_t arg1 ;
+  unsigned long long val1 ;
+  int ecode1 = 0 ;
+  uint8_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_long_SS_long(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "uint64_t","mwisd_fp::fast_popcount_64", 1, argv[0] ));
+  } 
+  arg1 = static_cast< uint64_t >(val1);
+  result = (uint8_t)mwisd_fp::fast_popcount_64(arg1);
+  vresult = SWIG_From_unsigned_SS_char(static_cast< unsigned char >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_hamming_distance(int argc, VALUE *argv, VALUE self) {
+  uint16_t *arg1 = (uint16_t *) 0 ;
+  uint16_t *arg2 = (uint16_t *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  double result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1,SWIGTYPE_p_unsigned_short, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "uint16_t *","mwisd_fp::hamming_distance", 1, argv[0] )); 
+  }
+  arg1 = reinterpret_cast< uint16_t * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2,SWIGTYPE_p_unsigned_short, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t *","mwisd_fp::hamming_distance", 2, argv[1] )); 
+  }
+  arg2 = reinterpret_cast< uint16_t * >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","mwisd_fp::hamming_distance", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  result = (double)mwisd_fp::hamming_distance(arg1,arg2,arg3);
+  vresult = SWIG_From_double(static_cast< double >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compare_bytes(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  double result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","mwisd_fp::compare_bytes", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","mwisd_fp::compare_bytes", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  {
+    try {
+      result = (double)mwisd_fp::compare_bytes((char const *)arg1,arg2,(char const *)arg3,arg4);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_double(static_cast< double >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_compare_many(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  std::string result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","mwisd_fp::compare_many", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","mwisd_fp::compare_many", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  {
+    try {
+      result = mwisd_fp::compare_many((char const *)arg1,arg2,(char const *)arg3,arg4);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_match_many__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  double arg5 ;
+  int arg6 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  double val5 ;
+  int ecode5 = 0 ;
+  int val6 ;
+  int ecode6 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","mwisd_fp::match_many", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","mwisd_fp::match_many", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  ecode5 = SWIG_AsVal_double(argv[2], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "double","mwisd_fp::match_many", 5, argv[2] ));
+  } 
+  arg5 = static_cast< double >(val5);
+  ecode6 = SWIG_AsVal_int(argv[3], &val6);
+  if (!SWIG_IsOK(ecode6)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode6), Ruby_Format_TypeError( "", "int","mwisd_fp::match_many", 6, argv[3] ));
+  } 
+  arg6 = static_cast< int >(val6);
+  {
+    try {
+      result = mwisd_fp::match_many((char const *)arg1,arg2,(char const *)arg3,arg4,arg5,arg6);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_match_many__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  double arg5 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  double val5 ;
+  int ecode5 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","mwisd_fp::match_many", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","mwisd_fp::match_many", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  ecode5 = SWIG_AsVal_double(argv[2], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "double","mwisd_fp::match_many", 5, argv[2] ));
+  } 
+  arg5 = static_cast< double >(val5);
+  {
+    try {
+      result = mwisd_fp::match_many((char const *)arg1,arg2,(char const *)arg3,arg4,arg5);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_match_many__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  size_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  size_t arg4 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  size_t size1 = 0 ;
+  int alloc1 = 0 ;
+  int res3 ;
+  char *buf3 = 0 ;
+  size_t size3 = 0 ;
+  int alloc3 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, &size1, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","mwisd_fp::match_many", 1, argv[0] ));
+  }  
+  arg1 = (char *) buf1;
+  arg2 = (size_t) size1 - 1;
+  res3 = SWIG_AsCharPtrAndSize(argv[1], &buf3, &size3, &alloc3);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","mwisd_fp::match_many", 3, argv[1] ));
+  }  
+  arg3 = (char *) buf3;
+  arg4 = (size_t) size3 - 1;
+  {
+    try {
+      result = mwisd_fp::match_many((char const *)arg1,arg2,(char const *)arg3,arg4);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  if (alloc3 == SWIG_NEWOBJ) delete[] buf3;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_match_many(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[4];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 4) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 2) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_match_many__SWIG_2(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_match_many__SWIG_1(nargs, args, self);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    int res = SWIG_AsCharPtrAndSize(argv[0], 0, NULL, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_match_many__SWIG_0(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 4, "match_many", 
+    "    std::vector< int,std::allocator< int > > match_many(char const *bytes_1, size_t length_1, char const *bytes_2, size_t length_2, double threshold, int limit)\n"
+    "    std::vector< int,std::allocator< int > > match_many(char const *bytes_1, size_t length_1, char const *bytes_2, size_t length_2, double threshold)\n"
+    "    std::vector< int,std::allocator< int > > match_many(char const *bytes_1, size_t length_1, char const *bytes_2, size_t length_2)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_read_hash_from_text(int argc, VALUE *argv, VALUE self) {
+  char *arg1 = (char *) 0 ;
+  uint16_t **arg2 = 0 ;
+  int arg3 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char *","mwisd_fp::read_hash_from_text", 1, argv[0] ));
+  }
+  arg1 = reinterpret_cast< char * >(buf1);
+  res2 = SWIG_ConvertPtr(argv[1], &argp2, SWIGTYPE_p_p_unsigned_short,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t *&","mwisd_fp::read_hash_from_text", 2, argv[1] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "uint16_t *&","mwisd_fp::read_hash_from_text", 2, argv[1])); 
+  }
+  arg2 = reinterpret_cast< uint16_t ** >(argp2);
+  ecode3 = SWIG_AsVal_int(argv[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","mwisd_fp::read_hash_from_text", 3, argv[2] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  result = (int)mwisd_fp::read_hash_from_text(arg1,*arg2,arg3);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return vresult;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_convert_to_mirror_flip(int argc, VALUE *argv, VALUE self) {
+  uint16_t **arg1 = 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1, SWIGTYPE_p_p_unsigned_short,  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "uint16_t *&","mwisd_fp::convert_to_mirror_flip", 1, argv[0] )); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "uint16_t *&","mwisd_fp::convert_to_mirror_flip", 1, argv[0])); 
+  }
+  arg1 = reinterpret_cast< uint16_t ** >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","mwisd_fp::convert_to_mirror_flip", 2, argv[1] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  mwisd_fp::convert_to_mirror_flip(*arg1,arg2);
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+swig_class SwigClassFingerprint;
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_contents_set(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  uint16_t *arg2 = (uint16_t *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","contents", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_unsigned_short, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "uint16_t *","contents", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< uint16_t * >(argp2);
+  if (arg1) (arg1)->contents = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_contents_get(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  uint16_t *result = 0 ;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","contents", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  result = (uint16_t *) ((arg1)->contents);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_unsigned_short, 0 |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_size_in_bytes_set(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","size_in_bytes", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  ecode2 = SWIG_AsVal_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","size_in_bytes", 2, argv[0] ));
+  } 
+  arg2 = static_cast< int >(val2);
+  if (arg1) (arg1)->size_in_bytes = arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_size_in_bytes_get(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","size_in_bytes", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  result = (int) ((arg1)->size_in_bytes);
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_heat_map_blob_set(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","heat_map_blob", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::string const &","heat_map_blob", 2, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","heat_map_blob", 2, argv[0])); 
+    }
+    arg2 = ptr;
+  }
+  if (arg1) (arg1)->heat_map_blob = *arg2;
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_heat_map_blob_get(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::string *result = 0 ;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","heat_map_blob", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  result = (std::string *) & ((arg1)->heat_map_blob);
+  vresult = SWIG_From_std_string(static_cast< std::string >(*result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_decode_options_set(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  image_io::DecodeOptions *arg2 = (image_io::DecodeOptions *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","decode_options", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2,SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "image_io::DecodeOptions *","decode_options", 2, argv[0] )); 
+  }
+  arg2 = reinterpret_cast< image_io::DecodeOptions * >(argp2);
+  if (arg1) (arg1)->decode_options = *arg2;
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_decode_options_get(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  image_io::DecodeOptions *result = 0 ;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","decode_options", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  result = (image_io::DecodeOptions *)& ((arg1)->decode_options);
+  vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_image_io__DecodeOptions, 0 |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_Fingerprint__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  int arg1 ;
+  int val1 ;
+  int ecode1 = 0 ;
+  mwisd_fp::Fingerprint *result = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "int","mwisd_fp::Fingerprint", 1, argv[0] ));
+  } 
+  arg1 = static_cast< int >(val1);
+  result = (mwisd_fp::Fingerprint *)new mwisd_fp::Fingerprint(arg1);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_new_Fingerprint__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *result = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  result = (mwisd_fp::Fingerprint *)new mwisd_fp::Fingerprint();
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+#ifdef HAVE_RB_DEFINE_ALLOC_FUNC
+SWIGINTERN VALUE
+_wrap_Fingerprint_allocate(VALUE self) {
+#else
+  SWIGINTERN VALUE
+  _wrap_Fingerprint_allocate(int argc, VALUE *argv, VALUE self) {
+#endif
+    
+    
+    VALUE vresult = SWIG_NewClassInstance(self, SWIGTYPE_p_mwisd_fp__Fingerprint);
+#ifndef HAVE_RB_DEFINE_ALLOC_FUNC
+    rb_obj_call_init(vresult, argc, argv);
+#endif
+    return vresult;
+  }
+  
+
+SWIGINTERN VALUE
+_wrap_new_Fingerprint__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  mwisd_fp::Fingerprint *result = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(argv[0], &argp1, SWIGTYPE_p_mwisd_fp__Fingerprint,  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint const &","mwisd_fp::Fingerprint", 1, argv[0] )); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "mwisd_fp::Fingerprint const &","mwisd_fp::Fingerprint", 1, argv[0])); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  result = (mwisd_fp::Fingerprint *)new mwisd_fp::Fingerprint((mwisd_fp::Fingerprint const &)*arg1);
+  DATA_PTR(self) = result;
+  return self;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_new_Fingerprint(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[1];
+  int ii;
+  
+  argc = nargs;
+  if (argc > 1) SWIG_fail;
+  for (ii = 0; (ii < argc); ++ii) {
+    argv[ii] = args[ii];
+  }
+  if (argc == 0) {
+    return _wrap_new_Fingerprint__SWIG_1(nargs, args, self);
+  }
+  if (argc == 1) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_mwisd_fp__Fingerprint, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_new_Fingerprint__SWIG_2(nargs, args, self);
+    }
+  }
+  if (argc == 1) {
+    int _v;
+    {
+      int res = SWIG_AsVal_int(argv[0], NULL);
+      _v = SWIG_CheckState(res);
+    }
+    if (_v) {
+      return _wrap_new_Fingerprint__SWIG_0(nargs, args, self);
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 1, "Fingerprint.new", 
+    "    Fingerprint.new(int hash_size_in_bytes)\n"
+    "    Fingerprint.new()\n"
+    "    Fingerprint.new(mwisd_fp::Fingerprint const &other)\n");
+  
+  return Qnil;
+}
+
+
+SWIGINTERN void
+free_mwisd_fp_Fingerprint(mwisd_fp::Fingerprint *arg1) {
+    delete arg1;
+}
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_as_char_array(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  char *result = 0 ;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","as_char_array", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  result = (char *)(arg1)->as_char_array();
+  vresult = SWIG_FromCharPtr((const char *)result);
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_set_from_char_array(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  char *arg2 = (char *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","set_from_char_array", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","set_from_char_array", 2, argv[0] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  (arg1)->set_from_char_array((char const *)arg2);
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_as_int_array(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","as_int_array", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  result = (arg1)->as_int_array();
+  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_set_from_int_array(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  std::vector< int,std::allocator< int > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","set_from_int_array", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  {
+    std::vector<int,std::allocator< int > > *ptr = (std::vector<int,std::allocator< int > > *)0;
+    res2 = swig::asptr(argv[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< int,std::allocator< int > > const &","set_from_int_array", 2, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< int,std::allocator< int > > const &","set_from_int_array", 2, argv[0])); 
+    }
+    arg2 = ptr;
+  }
+  (arg1)->set_from_int_array((std::vector< int,std::allocator< int > > const &)*arg2);
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_to_bytes(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  std::string result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","to_bytes", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  result = (arg1)->to_bytes();
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_from_bytes(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","from_bytes", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::string const &","from_bytes", 2, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","from_bytes", 2, argv[0])); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->from_bytes((std::string const &)*arg2);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_compute_from_image_file__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int arg3 ;
+  int arg4 ;
+  bool arg5 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  bool val5 ;
+  int ecode5 = 0 ;
+  
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","compute_from_image_file", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","compute_from_image_file", 2, argv[0] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","compute_from_image_file", 3, argv[1] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","compute_from_image_file", 4, argv[2] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  ecode5 = SWIG_AsVal_bool(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "bool","compute_from_image_file", 5, argv[3] ));
+  } 
+  arg5 = static_cast< bool >(val5);
+  {
+    try {
+      (arg1)->compute_from_image_file((char const *)arg2,arg3,arg4,arg5);
+    }
+    catch(cimg_library::CImgIOException &cioe) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, cioe.what());
+    }
+    catch(cimg_library::CImgInstanceException &cie) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, cie.what());
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Fingerprint_compute_from_image_file__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int arg3 ;
+  int arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","compute_from_image_file", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","compute_from_image_file", 2, argv[0] ));
+  }
+  arg2 = reinterpret_cast< char * >(buf2);
+  ecode3 = SWIG_AsVal_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","compute_from_image_file", 3, argv[1] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","compute_from_image_file", 4, argv[2] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  {
+    try {
+      (arg1)->compute_from_image_file((char const *)arg2,arg3,arg4);
+    }
+    catch(cimg_library::CImgIOException &cioe) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, cioe.what());
+    }
+    catch(cimg_library::CImgInstanceException &cie) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, cie.what());
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_Fingerprint_compute_from_image_file(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[6];
+  int ii;
+  
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 6) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
+  }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_mwisd_fp__Fingerprint, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_Fingerprint_compute_from_image_file__SWIG_1(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_mwisd_fp__Fingerprint, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsCharPtrAndSize(argv[1], 0, NULL, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_bool(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_Fingerprint_compute_from_image_file__SWIG_0(nargs, args, self);
+            }
+          }
+        }
+      }
+    }
   }
-  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
-  result = (char *)(arg1)->as_char_array();
-  vresult = SWIG_FromCharPtr((const char *)result);
-  return vresult;
+  
 fail:
+  Ruby_Format_OverloadedError( argc, 6, "Fingerprint.compute_from_image_file", 
+    "    void Fingerprint.compute_from_image_file(char const *filename, int wavelet_scale_base, int wavelet_scale_exponent, bool keep_heat_map)\n"
+    "    void Fingerprint.compute_from_image_file(char const *filename, int wavelet_scale_base, int wavelet_scale_exponent)\n");
+  
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_set_from_char_array(int argc, VALUE *argv, VALUE self) {
+_wrap_Fingerprint_set_from_heat_map_blob__SWIG_0(int argc, VALUE *argv, VALUE self) {
   mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
-  char *arg2 = (char *) 0 ;
+  std::string *arg2 = 0 ;
+  int arg3 ;
+  int arg4 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int val3 ;
+  int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","set_from_char_array", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","set_from_heat_map_blob", 1, self )); 
   }
   arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","set_from_char_array", 2, argv[0] ));
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::string const &","set_from_heat_map_blob", 2, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","set_from_heat_map_blob", 2, argv[0])); 
+    }
+    arg2 = ptr;
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  (arg1)->set_from_char_array((char const *)arg2);
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  ecode3 = SWIG_AsVal_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","set_from_heat_map_blob", 3, argv[1] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  ecode4 = SWIG_AsVal_int(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","set_from_heat_map_blob", 4, argv[2] ));
+  } 
+  arg4 = static_cast< int >(val4);
+  {
+    try {
+      (arg1)->set_from_heat_map_blob((std::string const &)*arg2,arg3,arg4);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_as_int_array(int argc, VALUE *argv, VALUE self) {
+_wrap_Fingerprint_set_from_heat_map_blob__SWIG_1(int argc, VALUE *argv, VALUE self) {
   mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  std::string *arg2 = 0 ;
+  int arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::vector< int,std::allocator< int > > result;
-  VALUE vresult = Qnil;
+  int res2 = SWIG_OLDOBJ ;
+  int val3 ;
+  int ecode3 = 0 ;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","as_int_array", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","set_from_heat_map_blob", 1, self )); 
   }
   arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
-  result = (arg1)->as_int_array();
-  vresult = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
-  return vresult;
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::string const &","set_from_heat_map_blob", 2, argv[0] )); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","set_from_heat_map_blob", 2, argv[0])); 
+    }
+    arg2 = ptr;
+  }
+  ecode3 = SWIG_AsVal_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","set_from_heat_map_blob", 3, argv[1] ));
+  } 
+  arg3 = static_cast< int >(val3);
+  {
+    try {
+      (arg1)->set_from_heat_map_blob((std::string const &)*arg2,arg3);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return Qnil;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 }
 
 
 SWIGINTERN VALUE
-_wrap_Fingerprint_set_from_int_array(int argc, VALUE *argv, VALUE self) {
+_wrap_Fingerprint_set_from_heat_map_blob__SWIG_2(int argc, VALUE *argv, VALUE self) {
   mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
-  std::vector< int,std::allocator< int > > *arg2 = 0 ;
+  std::string *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int res2 = SWIG_OLDOBJ ;
@@ -8467,21 +11715,29 @@ _wrap_Fingerprint_set_from_int_array(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","set_from_int_array", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","set_from_heat_map_blob", 1, self )); 
   }
   arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
   {
-    std::vector<int,std::allocator< int > > *ptr = (std::vector<int,std::allocator< int > > *)0;
-    res2 = swig::asptr(argv[0], &ptr);
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(argv[0], &ptr);
     if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::vector< int,std::allocator< int > > const &","set_from_int_array", 2, argv[0] )); 
+      SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "std::string const &","set_from_heat_map_blob", 2, argv[0] )); 
     }
     if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::vector< int,std::allocator< int > > const &","set_from_int_array", 2, argv[0])); 
+      SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "std::string const &","set_from_heat_map_blob", 2, argv[0])); 
     }
     arg2 = ptr;
   }
-  (arg1)->set_from_int_array((std::vector< int,std::allocator< int > > const &)*arg2);
+  {
+    try {
+      (arg1)->set_from_heat_map_blob((std::string const &)*arg2);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
   if (SWIG_IsNewObj(res2)) delete arg2;
   return Qnil;
 fail:
@@ -8490,66 +11746,81 @@ fail:
 }
 
 
-SWIGINTERN VALUE
-_wrap_Fingerprint_compute_from_image_file(int argc, VALUE *argv, VALUE self) {
-  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
-  char *arg2 = (char *) 0 ;
-  int arg3 ;
-  int arg4 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
-  int val3 ;
-  int ecode3 = 0 ;
-  int val4 ;
-  int ecode4 = 0 ;
+SWIGINTERN VALUE _wrap_Fingerprint_set_from_heat_map_blob(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[5];
+  int ii;
   
-  if ((argc < 3) || (argc > 3)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","compute_from_image_file", 1, self )); 
-  }
-  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","compute_from_image_file", 2, argv[0] ));
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 5) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  ecode3 = SWIG_AsVal_int(argv[1], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "int","compute_from_image_file", 3, argv[1] ));
-  } 
-  arg3 = static_cast< int >(val3);
-  ecode4 = SWIG_AsVal_int(argv[2], &val4);
-  if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "int","compute_from_image_file", 4, argv[2] ));
-  } 
-  arg4 = static_cast< int >(val4);
-  {
-    try {
-      (arg1)->compute_from_image_file((char const *)arg2,arg3,arg4);
-    }
-    catch(cimg_library::CImgIOException &cioe) {
-      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
-      rb_raise(cimgerror, cioe.what());
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_mwisd_fp__Fingerprint, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsPtr_std_string(argv[1], (std::string**)(0));
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Fingerprint_set_from_heat_map_blob__SWIG_2(nargs, args, self);
+      }
     }
-    catch(cimg_library::CImgInstanceException &cie) {
-      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
-      rb_raise(cimgerror, cie.what());
+  }
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_mwisd_fp__Fingerprint, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsPtr_std_string(argv[1], (std::string**)(0));
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_Fingerprint_set_from_heat_map_blob__SWIG_1(nargs, args, self);
+        }
+      }
     }
-    catch(cimg_library::CImgException &ce) {
-      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
-      rb_raise(cimgerror, ce.what());
+  }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_mwisd_fp__Fingerprint, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      int res = SWIG_AsPtr_std_string(argv[1], (std::string**)(0));
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_Fingerprint_set_from_heat_map_blob__SWIG_0(nargs, args, self);
+          }
+        }
+      }
     }
   }
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
-  return Qnil;
+  
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  Ruby_Format_OverloadedError( argc, 5, "Fingerprint.set_from_heat_map_blob", 
+    "    void Fingerprint.set_from_heat_map_blob(std::string const &blob, int block_dim, int rule)\n"
+    "    void Fingerprint.set_from_heat_map_blob(std::string const &blob, int block_dim)\n"
+    "    void Fingerprint.set_from_heat_map_blob(std::string const &blob)\n");
+  
   return Qnil;
 }
 
@@ -8586,6 +11857,52 @@ fail:
 }
 
 
+SWIGINTERN VALUE
+_wrap_Fingerprint_compare_bytes(int argc, VALUE *argv, VALUE self) {
+  mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
+  char *arg2 = (char *) 0 ;
+  size_t arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  size_t size2 = 0 ;
+  int alloc2 = 0 ;
+  double result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_mwisd_fp__Fingerprint, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "mwisd_fp::Fingerprint *","compare_bytes", 1, self )); 
+  }
+  arg1 = reinterpret_cast< mwisd_fp::Fingerprint * >(argp1);
+  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, &size2, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "(char *STRING, size_t LENGTH)","compare_bytes", 2, argv[0] ));
+  }  
+  arg2 = (char *) buf2;
+  arg3 = (size_t) size2 - 1;
+  {
+    try {
+      result = (double)(arg1)->compare_bytes((char const *)arg2,arg3);
+    }
+    catch(cimg_library::CImgException &ce) {
+      static VALUE cimgerror = rb_define_class("Mwisd_fpError", rb_eStandardError);
+      rb_raise(cimgerror, ce.what());
+    }
+  }
+  vresult = SWIG_From_double(static_cast< double >(result));
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return vresult;
+fail:
+  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Fingerprint_compare_compressed_hash(int argc, VALUE *argv, VALUE self) {
   mwisd_fp::Fingerprint *arg1 = (mwisd_fp::Fingerprint *) 0 ;
@@ -8672,15 +11989,23 @@ static void *_p_swig__IteratorTo_p_swig__ConstIterator(void *x, int *SWIGUNUSEDP
 static swig_type_info _swigt__p_allocator_type = {"_p_allocator_type", "allocator_type *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_char = {"_p_char", "char *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_difference_type = {"_p_difference_type", "difference_type *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_float = {"_p_float", "float *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_image_io__DecodeOptions = {"_p_image_io__DecodeOptions", "image_io::DecodeOptions *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_image_io__EmbeddedPreview = {"_p_image_io__EmbeddedPreview", "image_io::EmbeddedPreview *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_image_io__ImageInfo = {"_p_image_io__ImageInfo", "image_io::ImageInfo *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_image_io__image_format = {"_p_image_io__image_format", "enum image_io::image_format *|image_io::image_format *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_int = {"_p_int", "intptr_t *|int *|int_least32_t *|int_fast32_t *|int32_t *|int_fast16_t *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_long_long = {"_p_long_long", "int_least64_t *|int_fast64_t *|int64_t *|long long *|intmax_t *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_mwisd_fp__Fingerprint = {"_p_mwisd_fp__Fingerprint", "mwisd_fp::Fingerprint *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_p_float = {"_p_p_float", "float **", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_p_unsigned_short = {"_p_p_unsigned_short", "unsigned short **|uint16_t **", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_p_void = {"_p_p_void", "void **|VALUE *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_short = {"_p_short", "short *|int_least16_t *|int16_t *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_signed_char = {"_p_signed_char", "signed char *|int_least8_t *|int_fast8_t *|int8_t *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_size_type = {"_p_size_type", "size_type *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__allocatorT_int_t = {"_p_std__allocatorT_int_t", "std::vector< int >::allocator_type *|std::allocator< int > *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_std__string = {"_p_std__string", "std::string *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_std__vectorT_float_std__allocatorT_float_t_t = {"_p_std__vectorT_float_std__allocatorT_float_t_t", "std::vector< float,std::allocator< float > > *|std::vector< float > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_std__vectorT_int_std__allocatorT_int_t_t = {"_p_std__vectorT_int_std__allocatorT_int_t_t", "std::vector< int,std::allocator< int > > *|std::vector< int > *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_swig__ConstIterator = {"_p_swig__ConstIterator", "swig::ConstIterator *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_swig__GC_VALUE = {"_p_swig__GC_VALUE", "swig::GC_VALUE *", 0, 0, (void*)0, 0};
@@ -8696,15 +12021,23 @@ static swig_type_info *swig_type_initial[] = {
   &_swigt__p_allocator_type,
   &_swigt__p_char,
   &_swigt__p_difference_type,
+  &_swigt__p_float,
+  &_swigt__p_image_io__DecodeOptions,
+  &_swigt__p_image_io__EmbeddedPreview,
+  &_swigt__p_image_io__ImageInfo,
+  &_swigt__p_image_io__image_format,
   &_swigt__p_int,
   &_swigt__p_long_long,
   &_swigt__p_mwisd_fp__Fingerprint,
+  &_swigt__p_p_float,
   &_swigt__p_p_unsigned_short,
   &_swigt__p_p_void,
   &_swigt__p_short,
   &_swigt__p_signed_char,
   &_swigt__p_size_type,
   &_swigt__p_std__allocatorT_int_t,
+  &_swigt__p_std__string,
+  &_swigt__p_std__vectorT_float_std__allocatorT_float_t_t,
   &_swigt__p_std__vectorT_int_std__allocatorT_int_t_t,
   &_swigt__p_swig__ConstIterator,
   &_swigt__p_swig__GC_VALUE,
@@ -8720,15 +12053,23 @@ static swig_type_info *swig_type_initial[] = {
 static swig_cast_info _swigc__p_allocator_type[] = {  {&_swigt__p_allocator_type, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_char[] = {  {&_swigt__p_char, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_difference_type[] = {  {&_swigt__p_difference_type, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_float[] = {  {&_swigt__p_float, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_image_io__DecodeOptions[] = {  {&_swigt__p_image_io__DecodeOptions, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_image_io__EmbeddedPreview[] = {  {&_swigt__p_image_io__EmbeddedPreview, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_image_io__ImageInfo[] = {  {&_swigt__p_image_io__ImageInfo, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_image_io__image_format[] = {  {&_swigt__p_image_io__image_format, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_int[] = {  {&_swigt__p_int, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_long_long[] = {  {&_swigt__p_long_long, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_mwisd_fp__Fingerprint[] = {  {&_swigt__p_mwisd_fp__Fingerprint, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_p_float[] = {  {&_swigt__p_p_float, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_p_unsigned_short[] = {  {&_swigt__p_p_unsigned_short, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_p_void[] = {  {&_swigt__p_p_void, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_short[] = {  {&_swigt__p_short, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_signed_char[] = {  {&_swigt__p_signed_char, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_size_type[] = {  {&_swigt__p_size_type, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__allocatorT_int_t[] = {  {&_swigt__p_std__allocatorT_int_t, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_std__string[] = {  {&_swigt__p_std__string, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_std__vectorT_float_std__allocatorT_float_t_t[] = {  {&_swigt__p_std__vectorT_float_std__allocatorT_float_t_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_std__vectorT_int_std__allocatorT_int_t_t[] = {  {&_swigt__p_std__vectorT_int_std__allocatorT_int_t_t, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_swig__ConstIterator[] = {  {&_swigt__p_swig__ConstIterator, 0, 0, 0},  {&_swigt__p_swig__Iterator, _p_swig__IteratorTo_p_swig__ConstIterator, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_swig__GC_VALUE[] = {  {&_swigt__p_swig__GC_VALUE, 0, 0, 0},{0, 0, 0, 0}};
@@ -8744,15 +12085,23 @@ static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_allocator_type,
   _swigc__p_char,
   _swigc__p_difference_type,
+  _swigc__p_float,
+  _swigc__p_image_io__DecodeOptions,
+  _swigc__p_image_io__EmbeddedPreview,
+  _swigc__p_image_io__ImageInfo,
+  _swigc__p_image_io__image_format,
   _swigc__p_int,
   _swigc__p_long_long,
   _swigc__p_mwisd_fp__Fingerprint,
+  _swigc__p_p_float,
   _swigc__p_p_unsigned_short,
   _swigc__p_p_void,
   _swigc__p_short,
   _swigc__p_signed_char,
   _swigc__p_size_type,
   _swigc__p_std__allocatorT_int_t,
+  _swigc__p_std__string,
+  _swigc__p_std__vectorT_float_std__allocatorT_float_t_t,
   _swigc__p_std__vectorT_int_std__allocatorT_int_t_t,
   _swigc__p_swig__ConstIterator,
   _swigc__p_swig__GC_VALUE,
@@ -9024,6 +12373,11 @@ SWIGEXPORT void Init_mwisd_fp(void) {
   
   SWIG_RubyInitializeTrackings();
   
+#if defined(HAVE_RB_THREAD_CALL_WITHOUT_GVL) || defined(HAVE_RB_THREAD_BLOCKING_REGION)
+  image_io::set_blocking_runner(run_without_gvl);
+#endif
+  rb_define_class("Mwisd_fpError", rb_eStandardError);
+  
   SwigClassGC_VALUE.klass = rb_define_class_under(mMwisd_fp, "GC_VALUE", rb_cObject);
   SWIG_TypeClientData(SWIGTYPE_p_swig__GC_VALUE, (void *) &SwigClassGC_VALUE);
   rb_undef_alloc_func(SwigClassGC_VALUE.klass);
@@ -9117,11 +12471,94 @@ SWIGEXPORT void Init_mwisd_fp(void) {
   rb_define_const(mMwisd_fp, "Cimg_debug", SWIG_From_int(static_cast< int >(0)));
   rb_define_const(mMwisd_fp, "Cimg_display", SWIG_From_int(static_cast< int >(0)));
   rb_define_const(mMwisd_fp, "Cimg_verbosity", SWIG_From_int(static_cast< int >(1)));
+  rb_define_singleton_method(mMwisd_fp, "sniff_length", VALUEFUNC(_wrap_sniff_length_get), 0);
+  rb_define_const(mMwisd_fp, "Format_unknown", SWIG_From_int(static_cast< int >(image_io::format_unknown)));
+  rb_define_const(mMwisd_fp, "Format_jpeg", SWIG_From_int(static_cast< int >(image_io::format_jpeg)));
+  rb_define_const(mMwisd_fp, "Format_png", SWIG_From_int(static_cast< int >(image_io::format_png)));
+  rb_define_const(mMwisd_fp, "Format_tiff", SWIG_From_int(static_cast< int >(image_io::format_tiff)));
+  
+  SwigClassImageInfo.klass = rb_define_class_under(mMwisd_fp, "ImageInfo", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_image_io__ImageInfo, (void *) &SwigClassImageInfo);
+  rb_define_alloc_func(SwigClassImageInfo.klass, _wrap_ImageInfo_allocate);
+  rb_define_method(SwigClassImageInfo.klass, "initialize", VALUEFUNC(_wrap_new_ImageInfo), -1);
+  rb_define_method(SwigClassImageInfo.klass, "format=", VALUEFUNC(_wrap_ImageInfo_format_set), -1);
+  rb_define_method(SwigClassImageInfo.klass, "format", VALUEFUNC(_wrap_ImageInfo_format_get), -1);
+  rb_define_method(SwigClassImageInfo.klass, "width=", VALUEFUNC(_wrap_ImageInfo_width_set), -1);
+  rb_define_method(SwigClassImageInfo.klass, "width", VALUEFUNC(_wrap_ImageInfo_width_get), -1);
+  rb_define_method(SwigClassImageInfo.klass, "height=", VALUEFUNC(_wrap_ImageInfo_height_set), -1);
+  rb_define_method(SwigClassImageInfo.klass, "height", VALUEFUNC(_wrap_ImageInfo_height_get), -1);
+  rb_define_method(SwigClassImageInfo.klass, "channels=", VALUEFUNC(_wrap_ImageInfo_channels_set), -1);
+  rb_define_method(SwigClassImageInfo.klass, "channels", VALUEFUNC(_wrap_ImageInfo_channels_get), -1);
+  rb_define_method(SwigClassImageInfo.klass, "bit_depth=", VALUEFUNC(_wrap_ImageInfo_bit_depth_set), -1);
+  rb_define_method(SwigClassImageInfo.klass, "bit_depth", VALUEFUNC(_wrap_ImageInfo_bit_depth_get), -1);
+  rb_define_method(SwigClassImageInfo.klass, "progressive=", VALUEFUNC(_wrap_ImageInfo_progressive_set), -1);
+  rb_define_method(SwigClassImageInfo.klass, "progressive", VALUEFUNC(_wrap_ImageInfo_progressive_get), -1);
+  SwigClassImageInfo.mark = 0;
+  SwigClassImageInfo.destroy = (void (*)(void *)) free_image_io_ImageInfo;
+  SwigClassImageInfo.trackObjects = 0;
+  
+  SwigClassDecodeOptions.klass = rb_define_class_under(mMwisd_fp, "DecodeOptions", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_image_io__DecodeOptions, (void *) &SwigClassDecodeOptions);
+  rb_define_alloc_func(SwigClassDecodeOptions.klass, _wrap_DecodeOptions_allocate);
+  rb_define_method(SwigClassDecodeOptions.klass, "initialize", VALUEFUNC(_wrap_new_DecodeOptions), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "max_pixels=", VALUEFUNC(_wrap_DecodeOptions_max_pixels_set), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "max_pixels", VALUEFUNC(_wrap_DecodeOptions_max_pixels_get), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "min_dim=", VALUEFUNC(_wrap_DecodeOptions_min_dim_set), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "min_dim", VALUEFUNC(_wrap_DecodeOptions_min_dim_get), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "memory_cap=", VALUEFUNC(_wrap_DecodeOptions_memory_cap_set), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "memory_cap", VALUEFUNC(_wrap_DecodeOptions_memory_cap_get), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "preview_min_dim=", VALUEFUNC(_wrap_DecodeOptions_preview_min_dim_set), -1);
+  rb_define_method(SwigClassDecodeOptions.klass, "preview_min_dim", VALUEFUNC(_wrap_DecodeOptions_preview_min_dim_get), -1);
+  SwigClassDecodeOptions.mark = 0;
+  SwigClassDecodeOptions.destroy = (void (*)(void *)) free_image_io_DecodeOptions;
+  SwigClassDecodeOptions.trackObjects = 0;
+  
+  SwigClassEmbeddedPreview.klass = rb_define_class_under(mMwisd_fp, "EmbeddedPreview", rb_cObject);
+  SWIG_TypeClientData(SWIGTYPE_p_image_io__EmbeddedPreview, (void *) &SwigClassEmbeddedPreview);
+  rb_define_alloc_func(SwigClassEmbeddedPreview.klass, _wrap_EmbeddedPreview_allocate);
+  rb_define_method(SwigClassEmbeddedPreview.klass, "initialize", VALUEFUNC(_wrap_new_EmbeddedPreview), -1);
+  rb_define_method(SwigClassEmbeddedPreview.klass, "offset=", VALUEFUNC(_wrap_EmbeddedPreview_offset_set), -1);
+  rb_define_method(SwigClassEmbeddedPreview.klass, "offset", VALUEFUNC(_wrap_EmbeddedPreview_offset_get), -1);
+  rb_define_method(SwigClassEmbeddedPreview.klass, "length=", VALUEFUNC(_wrap_EmbeddedPreview_length_set), -1);
+  rb_define_method(SwigClassEmbeddedPreview.klass, "length", VALUEFUNC(_wrap_EmbeddedPreview_length_get), -1);
+  rb_define_method(SwigClassEmbeddedPreview.klass, "info=", VALUEFUNC(_wrap_EmbeddedPreview_info_set), -1);
+  rb_define_method(SwigClassEmbeddedPreview.klass, "info", VALUEFUNC(_wrap_EmbeddedPreview_info_get), -1);
+  SwigClassEmbeddedPreview.mark = 0;
+  SwigClassEmbeddedPreview.destroy = (void (*)(void *)) free_image_io_EmbeddedPreview;
+  SwigClassEmbeddedPreview.trackObjects = 0;
+  rb_define_singleton_method(mMwisd_fp, "load_ok", VALUEFUNC(_wrap_load_ok_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "error_arguments", VALUEFUNC(_wrap_error_arguments_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "error_open", VALUEFUNC(_wrap_error_open_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "error_unknown_format", VALUEFUNC(_wrap_error_unknown_format_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "error_decode", VALUEFUNC(_wrap_error_decode_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "error_too_large", VALUEFUNC(_wrap_error_too_large_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "error_not_streamable", VALUEFUNC(_wrap_error_not_streamable_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "error_needs_file", VALUEFUNC(_wrap_error_needs_file_get), 0);
+  rb_define_module_function(mMwisd_fp, "sniff_file_format", VALUEFUNC(_wrap_sniff_file_format), -1);
+  rb_define_module_function(mMwisd_fp, "probe_image", VALUEFUNC(_wrap_probe_image), -1);
+  rb_define_module_function(mMwisd_fp, "probe_image_data", VALUEFUNC(_wrap_probe_image_data), -1);
+  rb_define_module_function(mMwisd_fp, "find_preview", VALUEFUNC(_wrap_find_preview), -1);
+  rb_define_module_function(mMwisd_fp, "jpeg_scale_denom", VALUEFUNC(_wrap_jpeg_scale_denom), -1);
   rb_define_singleton_method(mMwisd_fp, "default_hash_size_in_bytes", VALUEFUNC(_wrap_default_hash_size_in_bytes_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "default_heat_map_dim", VALUEFUNC(_wrap_default_heat_map_dim_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "default_block_dim", VALUEFUNC(_wrap_default_block_dim_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "heat_map_blob_version", VALUEFUNC(_wrap_heat_map_blob_version_get), 0);
+  rb_define_singleton_method(mMwisd_fp, "heat_map_blob_header_size", VALUEFUNC(_wrap_heat_map_blob_header_size_get), 0);
+  rb_define_const(mMwisd_fp, "Threshold_mean", SWIG_From_int(static_cast< int >(mwisd_fp::threshold_mean)));
+  rb_define_const(mMwisd_fp, "Threshold_median", SWIG_From_int(static_cast< int >(mwisd_fp::threshold_median)));
   rb_define_module_function(mMwisd_fp, "compute_image_hash", VALUEFUNC(_wrap_compute_image_hash), -1);
+  rb_define_module_function(mMwisd_fp, "compute_image_hashes", VALUEFUNC(_wrap_compute_image_hashes), -1);
+  rb_define_module_function(mMwisd_fp, "hash_layout", VALUEFUNC(_wrap_hash_layout), -1);
+  rb_define_module_function(mMwisd_fp, "compute_image_heat_map", VALUEFUNC(_wrap_compute_image_heat_map), -1);
+  rb_define_module_function(mMwisd_fp, "hash_from_heat_map", VALUEFUNC(_wrap_hash_from_heat_map), -1);
+  rb_define_module_function(mMwisd_fp, "pack_heat_map", VALUEFUNC(_wrap_pack_heat_map), -1);
+  rb_define_module_function(mMwisd_fp, "unpack_heat_map", VALUEFUNC(_wrap_unpack_heat_map), -1);
   rb_define_module_function(mMwisd_fp, "fast_pow", VALUEFUNC(_wrap_fast_pow), -1);
   rb_define_module_function(mMwisd_fp, "fast_popcount_64", VALUEFUNC(_wrap_fast_popcount_64), -1);
   rb_define_module_function(mMwisd_fp, "hamming_distance", VALUEFUNC(_wrap_hamming_distance), -1);
+  rb_define_module_function(mMwisd_fp, "compare_bytes", VALUEFUNC(_wrap_compare_bytes), -1);
+  rb_define_module_function(mMwisd_fp, "compare_many", VALUEFUNC(_wrap_compare_many), -1);
+  rb_define_module_function(mMwisd_fp, "match_many", VALUEFUNC(_wrap_match_many), -1);
   rb_define_module_function(mMwisd_fp, "read_hash_from_text", VALUEFUNC(_wrap_read_hash_from_text), -1);
   rb_define_module_function(mMwisd_fp, "convert_to_mirror_flip", VALUEFUNC(_wrap_convert_to_mirror_flip), -1);
   
@@ -9133,12 +12570,20 @@ SWIGEXPORT void Init_mwisd_fp(void) {
   rb_define_method(SwigClassFingerprint.klass, "contents", VALUEFUNC(_wrap_Fingerprint_contents_get), -1);
   rb_define_method(SwigClassFingerprint.klass, "size_in_bytes=", VALUEFUNC(_wrap_Fingerprint_size_in_bytes_set), -1);
   rb_define_method(SwigClassFingerprint.klass, "size_in_bytes", VALUEFUNC(_wrap_Fingerprint_size_in_bytes_get), -1);
+  rb_define_method(SwigClassFingerprint.klass, "heat_map_blob=", VALUEFUNC(_wrap_Fingerprint_heat_map_blob_set), -1);
+  rb_define_method(SwigClassFingerprint.klass, "heat_map_blob", VALUEFUNC(_wrap_Fingerprint_heat_map_blob_get), -1);
+  rb_define_method(SwigClassFingerprint.klass, "decode_options=", VALUEFUNC(_wrap_Fingerprint_decode_options_set), -1);
+  rb_define_method(SwigClassFingerprint.klass, "decode_options", VALUEFUNC(_wrap_Fingerprint_decode_options_get), -1);
   rb_define_method(SwigClassFingerprint.klass, "as_char_array", VALUEFUNC(_wrap_Fingerprint_as_char_array), -1);
   rb_define_method(SwigClassFingerprint.klass, "set_from_char_array", VALUEFUNC(_wrap_Fingerprint_set_from_char_array), -1);
   rb_define_method(SwigClassFingerprint.klass, "as_int_array", VALUEFUNC(_wrap_Fingerprint_as_int_array), -1);
   rb_define_method(SwigClassFingerprint.klass, "set_from_int_array", VALUEFUNC(_wrap_Fingerprint_set_from_int_array), -1);
+  rb_define_method(SwigClassFingerprint.klass, "to_bytes", VALUEFUNC(_wrap_Fingerprint_to_bytes), -1);
+  rb_define_method(SwigClassFingerprint.klass, "from_bytes", VALUEFUNC(_wrap_Fingerprint_from_bytes), -1);
   rb_define_method(SwigClassFingerprint.klass, "compute_from_image_file", VALUEFUNC(_wrap_Fingerprint_compute_from_image_file), -1);
+  rb_define_method(SwigClassFingerprint.klass, "set_from_heat_map_blob", VALUEFUNC(_wrap_Fingerprint_set_from_heat_map_blob), -1);
   rb_define_method(SwigClassFingerprint.klass, "compare", VALUEFUNC(_wrap_Fingerprint_compare), -1);
+  rb_define_method(SwigClassFingerprint.klass, "compare_bytes", VALUEFUNC(_wrap_Fingerprint_compare_bytes), -1);
   rb_define_method(SwigClassFingerprint.klass, "compare_compressed_hash", VALUEFUNC(_wrap_Fingerprint_compare_compressed_hash), -1);
   rb_define_method(SwigClassFingerprint.klass, "compressed_hash", VALUEFUNC(_wrap_Fingerprint_compressed_hash), -1);
   rb_define_method(SwigClassFingerprint.klass, "transform_to_mirror", VALUEFUNC(_wrap_Fingerprint_transform_to_mirror), -1);
@@ -1,6 +1,27 @@
 # histogroup_spec.rb
 
 require 'histogroup'
+require 'mwisd_fp'
+require 'fileutils'
+require 'tmpdir'
+
+# The fixtures the index and grouping specs add, in order.
+FILES = ["grandpa_0401.jpg", "grandpa_0401a.jpg", "grandpa_0402.png", "flag.jpg", "small1.jpg"]
+
+# A Histogroup::Fingerprint of a fixture.
+def fingerprint(name)
+  fp = Histogroup::Fingerprint.new
+  fp.compute_from_image_file("./spec/fixtures/" + name)
+  fp
+end
+
+# A fixture's Histogroup::Fingerprint and Mwisd_fp values, as
+# Histogroup::SceneIndex takes them.
+def fingerprints(name)
+  mfp = Mwisd_fp::Fingerprint.new
+  mfp.compute_from_image_file("./spec/fixtures/" + name, 2, 1)
+  [fingerprint(name), mfp.as_int_array]
+end
 
 describe Histogroup::Fingerprint do
   B = [0.155793190002441, 0.00297799543477595, 0.00152363756205887, 0.0, 0.00691009126603603, 0.000161423406098038, 0.00360495108179748, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.71909917412449e-07, 0.0, 0.0164792854338884, 0.000140450400067493, 5.15729766448203e-07, 0.0, 0.0138886021450162, 0.00571548892185092, 0.00101650331635028, 3.26628833136056e-06, 0.000120508855616208, 5.86212809139397e-05, 0.0003106412186753, 6.87639658281114e-06, 0.0, 0.0, 7.32336266082712e-05, 2.23482902583783e-06, 0.171916797757149, 0.000105552688182797, 0.0, 0.0, 0.0107051739469171, 0.0381208509206772, 0.000212652565096505, 0.0, 0.000614577962551266, 0.0346831679344177, 0.027154890820384, 0.00897060334682465, 0.0, 0.0, 8.25167589937337e-05, 0.000449716346338391, 0.153405025601387, 0.000951865222305059, 0.0, 0.0, 8.50954093039036e-05, 0.00203180336393416, 8.35482205729932e-05, 0.0, 0.000314423232339323, 0.124773077666759, 0.0600300841033459, 0.00452656019479036, 3.43819834824899e-07, 0.00595392799004912, 0.0589379407465458, 0.0871021151542664]
@@ -56,6 +77,94 @@ describe Histogroup::Fingerprint do
     end
   end
 
+  describe "#as_quantized and #set_from_quantized" do
+    it "describes Fingerprint as one byte per bin, or two at 16 bits" do
+      fp = Histogroup::Fingerprint.new
+      fp.set_from_float_array(B)
+      fp.as_quantized.bytesize.should == 64
+      fp.as_quantized(16).bytesize.should == 128
+      lambda{ fp.as_quantized(12) }.should raise_error
+    end
+    it "round-trips Fingerprint closely, and compares quantized Fingerprints directly" do
+      fp1 = Histogroup::Fingerprint.new
+      fp1.set_from_float_array(B)
+      fp2 = Histogroup::Fingerprint.new
+      fp2.set_from_quantized(fp1.as_quantized)
+      fp1.compare(fp2).should < 1.0e-3
+      fp2.set_from_quantized(fp1.as_quantized(16))
+      fp1.compare(fp2).should < 1.0e-6
+      fp2.compute_from_image_file("./spec/fixtures/grandpa_0402.png")
+      (Histogroup.compare_quantized(fp1.as_quantized, fp2.as_quantized, 4) - fp1.compare(fp2)).abs.should < 1.0e-2
+      lambda{ fp2.set_from_quantized("blah") }.should raise_error
+    end
+  end
+
+  describe ".compare_many and .match_many" do
+    it "compares a quantized Fingerprint with many packed in one String" do
+      fp1 = Histogroup::Fingerprint.new
+      fp1.compute_from_image_file("./spec/fixtures/grandpa_0403.png")
+      fp2 = Histogroup::Fingerprint.new
+      packed = ["grandpa_0402.png", "grandpa_0403.png", "large1.jpg"].map do |name|
+        fp2.compute_from_image_file("./spec/fixtures/#{name}")
+        fp2.as_quantized
+      end
+      distances = Histogroup.compare_many(fp1.as_quantized, packed.join, 4).unpack("e*")
+      distances.length.should == 3
+      distances.zip(packed).each do |distance, blob|
+        distance.should be_within(1.0e-6).of(Histogroup.compare_quantized(fp1.as_quantized, blob, 4))
+      end
+      order = (0...3).sort_by { |i| [distances[i], i] }
+      Histogroup.match_many(fp1.as_quantized, packed.join, 4).to_a.should == order
+      Histogroup.match_many(fp1.as_quantized, packed.join, 4, distances[order[1]], 1).to_a.should == [order[0]]
+      lambda{ Histogroup.compare_many(fp1.as_quantized, packed.join[0, 100], 4) }.should raise_error(HistogroupError)
+    end
+  end
+
+  describe ".compare_chisquare_many" do
+    # One Fingerprint and twenty more packed as float32s, with their distances
+    # from it by #compare.
+    def packed_fingerprints
+      fp1 = fingerprint("grandpa_0403.png")
+      exact = []
+      packed = (1..10).map { |i| ["large#{i}.jpg", "small#{i}.jpg"] }.flatten.map do |name|
+        fp2 = fingerprint(name)
+        exact << fp1.compare(fp2)
+        fp2.as_float_array.pack("e*")
+      end
+      [fp1.as_float_array.pack("e*"), packed, exact]
+    end
+
+    it "compares a Fingerprint with many packed in one String as #compare does, whatever their count" do
+      query, packed, exact = packed_fingerprints
+      # Counts on both sides of whole blocks of comparisons.
+      [1, 7, 8, 9, 16, 17, 20].each do |count|
+        distances = Histogroup.compare_chisquare_many(query, packed[0, count].join, 4).unpack("E*")
+        distances.should == exact[0, count]
+      end
+      Histogroup.compare_chisquare_many(query, "", 4).should == ""
+      lambda{ Histogroup.compare_chisquare_many(query, packed.join[0, 100], 4) }.should raise_error(HistogroupError)
+      lambda{ Histogroup.compare_chisquare_many(query, packed.join, 3) }.should raise_error(HistogroupError)
+    end
+    it "gives distances above the cutoff only as lower bounds, still above it" do
+      query, packed, exact = packed_fingerprints
+      [exact.min / 2, exact.sort[exact.length / 2]].each do |cutoff|
+        distances = Histogroup.compare_chisquare_many(query, packed.join, 4, cutoff).unpack("E*")
+        distances.zip(exact).each do |distance, full|
+          if full <= cutoff
+            distance.should == full
+          else
+            distance.should > cutoff
+            distance.should <= full
+          end
+        end
+      end
+      # Once every comparison of a block is over the cutoff, the rest of its
+      # bins are skipped.
+      distances = Histogroup.compare_chisquare_many(query, packed.join, 4, exact.min / 2).unpack("E*")
+      distances.zip(exact).any? { |distance, full| distance < full }.should == true
+    end
+  end
+
   describe "#compare" do
     it "compares two instances of Fingerprint" do
       fp1 = Histogroup::Fingerprint.new
@@ -113,6 +222,61 @@ describe Histogroup::Fingerprint do
       fp1.compare(fp2).should > 1.4166666
       (fp2.compare(fp1) - fp1.compare(fp2)).should < 1.0e-12
     end
+    it "detects the image format from file content rather than its name" do
+      fp1 = Histogroup::Fingerprint.new
+      fp1.compute_from_image_file("./spec/fixtures/grandpa_0401.jpg")
+      Dir.mktmpdir do |dir|
+        FileUtils.cp("./spec/fixtures/grandpa_0401.jpg", "#{dir}/grandpa_0401.png")
+        fp2 = Histogroup::Fingerprint.new
+        fp2.compute_from_image_file("#{dir}/grandpa_0401.png")
+        fp1.compare(fp2).should <= 1.0e-12
+      end
+    end
+    it "streams images larger than decode_options.memory_cap without changing the result" do
+      fp1 = Histogroup::Fingerprint.new
+      fp1.compute_from_image_file("./spec/fixtures/grandpa_0402.png")
+      fp2 = Histogroup::Fingerprint.new
+      fp2.decode_options.memory_cap = 64 * 1024
+      fp2.compute_from_image_file("./spec/fixtures/grandpa_0402.png")
+      fp2.as_float_array.should == fp1.as_float_array
+    end
+    it "samples images larger than sample_budget, staying within the reported drift bound" do
+      fp1 = Histogroup::Fingerprint.new
+      fp1.compute_from_image_file("./spec/fixtures/grandpa_0402.png")
+      fp2 = Histogroup::Fingerprint.new
+      fp2.sample_budget = 10000
+      fp2.compute_from_image_file("./spec/fixtures/grandpa_0402.png")
+      fp2.drift_bound.should > 0.0
+      fp2.compare(fp1).should <= fp2.drift_bound
+    end
+    it "histograms large images on several threads when asked, without changing the result" do
+      fp1 = Histogroup::Fingerprint.new
+      fp1.threads.should == 1
+      fp1.compute_from_image_file("./spec/fixtures/gradient_2mp.png")
+      fp2 = Histogroup::Fingerprint.new
+      fp2.threads = 4
+      fp2.compute_from_image_file("./spec/fixtures/gradient_2mp.png")
+      fp2.as_float_array.should == fp1.as_float_array
+      fp2.threads = 0
+      fp2.compute_from_image_file("./spec/fixtures/gradient_2mp.png")
+      fp2.as_float_array.should == fp1.as_float_array
+    end
+    it "computes the same fingerprints from several Ruby threads at once" do
+      names = ["grandpa_0401.jpg", "grandpa_0402.png", "flag.jpg", "small1.jpg"]
+      expected = names.map do |name|
+        fp = Histogroup::Fingerprint.new
+        fp.compute_from_image_file("./spec/fixtures/" + name)
+        fp.as_float_array.to_a
+      end
+      threads = names.map do |name|
+        Thread.new do
+          fp = Histogroup::Fingerprint.new
+          fp.compute_from_image_file("./spec/fixtures/" + name)
+          fp.as_float_array.to_a
+        end
+      end
+      threads.map(&:value).should == expected
+    end
     it "raises an error if asked to read non-existent or non-image-data files" do
       fp = Histogroup::Fingerprint.new
       lambda{ fp.compute_from_image_file("README") }.should raise_error
@@ -129,3 +293,95 @@ describe Histogroup::Fingerprint do
   end
 
 end
+
+describe "Histogroup::Index" do
+  describe "#search" do
+    it "finds the fingerprints within a cutoff, the same with or without coarse screening" do
+      screened = Histogroup::Index.new
+      unscreened = Histogroup::Index.new(4, false)
+      FILES.each { |name| screened.add(fingerprint(name)); unscreened.add(fingerprint(name)) }
+      screened.size.should == 5
+      screened.coarse_bins_per_band.should == 2
+      unscreened.coarse_bins_per_band.should == 0
+      query = fingerprint("grandpa_0401.jpg")
+      screened.search(query, 0.02).to_a.should == [0, 1]
+      unscreened.search(query, 0.02).to_a.should == [0, 1]
+      screened.verified.should < 5
+    end
+    it "finds the same fingerprints using pivots" do
+      index = Histogroup::Index.new(4, true, 2)
+      FILES.each { |name| index.add(fingerprint(name)) }
+      index.pivots.should == 2
+      index.search(fingerprint("grandpa_0401.jpg"), 0.02).to_a.should == [0, 1]
+      index.add(fingerprint("grandpa_0401a.jpg"))
+      index.search(fingerprint("grandpa_0401.jpg"), 0.02).to_a.should == [0, 1, 5]
+    end
+    it "raises an error if passed a Fingerprint of another size" do
+      index = Histogroup::Index.new
+      lambda{ index.add(Histogroup::Fingerprint.new(3)) }.should raise_error
+    end
+  end
+end
+
+describe "Histogroup::Groups" do
+  describe "#cluster" do
+    it "groups fingerprints within radius of one another, leaving the rest ungrouped" do
+      groups = Histogroup::Groups.new(4, 0.02)
+      FILES.each { |name| groups.add(fingerprint(name)) }
+      groups.threads = 2
+      groups.cluster.should == 1
+      groups.labels.to_a.should == [0, 0, -1, -1, -1]
+      groups.radius = 0.05
+      groups.cluster.should == 1
+      groups.labels.to_a.should == [0, 0, 0, -1, -1]
+    end
+  end
+
+  describe "#assign" do
+    it "adds a fingerprint to the group of its nearest neighbor without re-grouping" do
+      groups = Histogroup::Groups.new(4, 0.02)
+      FILES.each { |name| groups.add(fingerprint(name)) }
+      groups.cluster
+      groups.assign(fingerprint("grandpa_0401a.jpg")).should == 0
+      groups.assign(fingerprint("grandpa_0403.png")).should == -1
+      groups.size.should == 7
+      groups.labels.to_a.should == [0, 0, -1, -1, -1, 0, -1]
+      lambda{ groups.assign(Histogroup::Fingerprint.new(3)) }.should raise_error
+    end
+  end
+end
+
+describe "Histogroup::PartitionedIndex" do
+  describe "#search" do
+    it "searches only the partitions and times asked for" do
+      index = Histogroup::PartitionedIndex.new
+      FILES.each_with_index { |name, i| index.add(fingerprint(name), i < 3 ? 1 : 2, 100 + i) }
+      index.keys.to_a.should == [1, 2]
+      index.statistics(1).count.should == 3
+      index.statistics(1).first_time.should == 100
+      index.statistics(1).last_time.should == 102
+      index.statistics(3).count.should == 0
+      query = fingerprint("grandpa_0401.jpg")
+      index.search(query, 0.02, [1]).to_a.should == [0, 1]
+      index.search(query, 0.02, [1], 101, 200).to_a.should == [1]
+      index.search(query, 0.02, [2]).to_a.should == []
+      index.search(query, 0.02, [2], 200, 300).to_a.should == []
+      index.partitions_searched.should == 0
+    end
+  end
+end
+
+describe "Histogroup::SceneIndex" do
+  describe "#search" do
+    it "finds re-uploads among the images of the same scene, probing only nearby cells" do
+      index = Histogroup::SceneIndex.new
+      FILES.each { |name| index.add(*fingerprints(name)) }
+      index.size.should == 5
+      index.search(*fingerprints("large1.jpg"), 0.02, 0.9).to_a.should == [4]
+      index.verified.should < 5
+      index.search(*fingerprints("grandpa_0401.jpg"), 0.02, 0.9).to_a.should == [0, 1]
+      index.search(*fingerprints("grandpa_0403.png"), 0.02, 0.9).to_a.should == []
+      lambda{ index.add(Histogroup::Fingerprint.new, [1, 2, 3]) }.should raise_error
+    end
+  end
+end
@@ -1,4 +1,6 @@
 require 'mwisd_fp'
+require 'fileutils'
+require 'tmpdir'
 
 # NOTE: If you're not seeing changes make in the code reflected in these specs, run 'rake compile:mwisd_fp' and try again.
 
@@ -23,6 +25,16 @@ describe Mwisd_fp::Fingerprint do
       fp.class.should eq(Mwisd_fp::Fingerprint)
     end
     
+    it "returns a copy of another Fingerprint, independent of it" do
+      fp1 = Mwisd_fp::Fingerprint.new
+      fp1.set_from_int_array(A)
+      fp2 = Mwisd_fp::Fingerprint.new(fp1)
+      fp2.as_int_array.should == A
+      fp1.transform_to_mirror
+      fp2.as_int_array.should == A
+      Mwisd_fp::Fingerprint.new(Mwisd_fp::Fingerprint.new(256)).as_int_array.length.should == 128
+    end
+
     it "raises an error if passed an non-integer argument (e.g. String, Arrays)" do
       lambda{ Mwisd_fp::Fingerprint.new("alpha") }.should raise_error
       lambda{ Mwisd_fp::Fingerprint.new(["alpha"]) }.should raise_error
@@ -73,6 +85,56 @@ describe Mwisd_fp::Fingerprint do
     end
   end
       
+  describe "#to_bytes and #from_bytes" do
+    it "packs a Fingerprint into a little-endian binary String and back" do
+      fp1 = Mwisd_fp::Fingerprint.new
+      fp1.set_from_int_array(A)
+      bytes = fp1.to_bytes
+      bytes.bytesize.should == 128
+      bytes.unpack("v*").should == A
+      fp2 = Mwisd_fp::Fingerprint.new
+      fp2.from_bytes(bytes)
+      fp2.as_int_array.should == A
+    end
+
+    it "raises an error if passed a String of another size" do
+      fp = Mwisd_fp::Fingerprint.new
+      lambda{ fp.from_bytes("\0" * 127) }.should raise_error(Mwisd_fpError)
+    end
+  end
+
+  describe "#compare_bytes" do
+    it "compares with a packed fingerprint as #compare would" do
+      fp1 = Mwisd_fp::Fingerprint.new
+      fp1.compute_from_image_file("#{@fixtures}/large1.jpg", 2, 1)
+      fp2 = Mwisd_fp::Fingerprint.new
+      fp2.compute_from_image_file("#{@fixtures}/small1.jpg", 2, 1)
+      fp1.compare_bytes(fp2.to_bytes).should == fp1.compare(fp2)
+      Mwisd_fp.compare_bytes(fp1.to_bytes, fp2.to_bytes).should == fp1.compare(fp2)
+      lambda{ fp1.compare_bytes("\0" * 64) }.should raise_error(Mwisd_fpError)
+    end
+  end
+
+  describe ".compare_many and .match_many" do
+    it "compares a packed fingerprint with many packed in one String" do
+      fp1 = Mwisd_fp::Fingerprint.new
+      fp1.compute_from_image_file("#{@fixtures}/large1.jpg", 2, 1)
+      fp2 = Mwisd_fp::Fingerprint.new
+      packed = (1..4).map do |i|
+        fp2.compute_from_image_file("#{@fixtures}/small#{i}.jpg", 2, 1)
+        fp2.to_bytes
+      end
+      similarities = Mwisd_fp.compare_many(fp1.to_bytes, packed.join).unpack("e*")
+      similarities.length.should == 4
+      similarities.zip(packed).each do |similarity, bytes|
+        similarity.should == fp1.compare_bytes(bytes)
+      end
+      Mwisd_fp.match_many(fp1.to_bytes, packed.join, 0.9).to_a.should == [0]
+      Mwisd_fp.match_many(fp1.to_bytes, packed.join, 0.0, 2).to_a.length.should == 2
+      lambda{ Mwisd_fp.compare_many(fp1.to_bytes, packed.join[0, 200]) }.should raise_error(Mwisd_fpError)
+    end
+  end
+
   describe "#compare" do
     it "compares two instances of Fingerprint" do
       fp1 = Mwisd_fp::Fingerprint.new
@@ -123,12 +185,80 @@ describe Mwisd_fp::Fingerprint do
       fp2.as_int_array.should == [255, 28750, 58912, 51347, 12563, 13107, 14182, 61132, 4509, 37137, 4371, 4479, 58952, 63872, 2231, 13073, 52974, 60620, 52360, 36040, 36232, 36403, 5118, 60620, 13107, 14183, 14320, 819, 15553, 191, 65152, 887, 13111, 62259, 32624, 239, 58976, 61132, 63232, 6143, 39321, 64904, 35020, 32819, 13119, 65288, 3952, 1647, 254, 61043, 13107, 30600, 39313, 13107, 3327, 29456, 6553, 4543, 35515, 62208, 36046, 52428, 52431, 65160]
     end
     
+    it "computes the same fingerprint again after other images on the same thread" do
+      fp1 = Mwisd_fp::Fingerprint.new
+      fp1.compute_from_image_file("#{@fixtures}/grandpa_0402.png", 2, 1)
+      fp2 = Mwisd_fp::Fingerprint.new
+      ["large1.jpg", "flag.jpg", "unflattened.png", "grandpa_0402.png"].each do |name|
+        fp2.compute_from_image_file("#{@fixtures}/#{name}", 2, 1)
+      end
+      fp2.as_int_array.should == fp1.as_int_array
+    end
+
+    it "computes fingerprints of other power-of-two sizes" do
+      [32, 64, 256].each do |bytes|
+        fp1 = Mwisd_fp::Fingerprint.new(bytes)
+        fp1.compute_from_image_file("#{@fixtures}/grandpa_0401.jpg", 2, 1)
+        fp2 = Mwisd_fp::Fingerprint.new(bytes)
+        fp2.compute_from_image_file("#{@fixtures}/grandpa_0401a.jpg", 2, 1)
+        fp1.as_int_array.length.should == bytes/2
+        fp1.compare(fp2).should > 0.90
+      end
+    end
+
+    it "raises an error if asked to compute a fingerprint of unsupported size" do
+      fp = Mwisd_fp::Fingerprint.new(129)
+      lambda{ fp.compute_from_image_file("#{@fixtures}/grandpa_0401.jpg", 2, 1) }.should raise_error
+    end
+
     it "raises an error if asked to read non-existent or non-image-data files" do
       fp = Mwisd_fp::Fingerprint.new
       lambda{ fp.compute_from_image_file("README", 2, 1) }.should raise_error
       lambda{ fp.compute_from_image_file("R", 2, 1) }.should raise_error
     end
+
+    it "raises an error for images with no grayscale conversion (gray with alpha)" do
+      fp = Mwisd_fp::Fingerprint.new
+      lambda{ fp.compute_from_image_file("#{@fixtures}/gray_alpha.png", 2, 1) }.should raise_error(Mwisd_fpError)
+      lambda{ fp.compute_from_image_file("#{@fixtures}/gray_alpha.png", 2, 1, true) }.should raise_error(Mwisd_fpError)
+    end
     
+    it "detects the image format from file content rather than its name" do
+      fp1 = Mwisd_fp::Fingerprint.new
+      fp1.compute_from_image_file("#{@fixtures}/grandpa_0402.png", 2, 1)
+      Dir.mktmpdir do |dir|
+        FileUtils.cp("#{@fixtures}/grandpa_0402.png", "#{dir}/grandpa_0402.jpg")
+        FileUtils.cp("#{@fixtures}/grandpa_0402.png", "#{dir}/grandpa_0402")
+        fp2 = Mwisd_fp::Fingerprint.new
+        fp2.compute_from_image_file("#{dir}/grandpa_0402.jpg", 2, 1)
+        fp2.as_int_array.should == fp1.as_int_array
+        fp2.compute_from_image_file("#{dir}/grandpa_0402", 2, 1)
+        fp2.as_int_array.should == fp1.as_int_array
+      end
+    end
+
+    it "streams images larger than decode_options.memory_cap" do
+      fp1 = Mwisd_fp::Fingerprint.new
+      fp1.compute_from_image_file("#{@fixtures}/grandpa_0402.png", 2, 1)
+      fp2 = Mwisd_fp::Fingerprint.new
+      fp2.decode_options.memory_cap = 64 * 1024
+      fp2.compute_from_image_file("#{@fixtures}/grandpa_0402.png", 2, 1)
+      fp1.compare(fp2).should > 0.95
+    end
+
+    it "fingerprints an embedded preview when decode_options.preview_min_dim allows" do
+      fp1 = Mwisd_fp::Fingerprint.new
+      fp1.compute_from_image_file("#{@fixtures}/flag_thumbnail.jpg", 2, 1)
+      fp2 = Mwisd_fp::Fingerprint.new
+      fp2.decode_options.preview_min_dim = 100    # 160x114 EXIF thumbnail
+      fp2.compute_from_image_file("#{@fixtures}/flag_thumbnail.jpg", 2, 1)
+      fp1.compare(fp2).should > 0.85
+      fp1.compare(fp2).should < 1.0
+      fp2.decode_options.preview_min_dim = 200
+      fp2.compute_from_image_file("#{@fixtures}/flag_thumbnail.jpg", 2, 1)
+      fp2.as_int_array.should == fp1.as_int_array
+    end
+
     it "handles pngs with an alpha channel" do
       f = Mwisd_fp::Fingerprint.new
       lambda {
@@ -137,6 +267,24 @@ describe Mwisd_fp::Fingerprint do
     end
   end
 
+  describe "#set_from_heat_map_blob" do
+    it "re-derives a fingerprint from a kept heat map without decoding the image" do
+      fp1 = Mwisd_fp::Fingerprint.new
+      fp1.compute_from_image_file("#{@fixtures}/grandpa_0402.png", 2, 1, true)
+      fp1.heat_map_blob.bytesize.should == 8 + 2*32*32
+      fp2 = Mwisd_fp::Fingerprint.new
+      fp2.set_from_heat_map_blob(fp1.heat_map_blob)
+      fp1.compare(fp2).should > 0.99
+      fp2.set_from_heat_map_blob(fp1.heat_map_blob, 4, Mwisd_fp::Threshold_median)
+      fp1.compare(fp2).should > 0.80
+    end
+
+    it "raises an error if passed a malformed heat map blob" do
+      fp = Mwisd_fp::Fingerprint.new
+      lambda{ fp.set_from_heat_map_blob("blah") }.should raise_error
+    end
+  end
+
   describe "#transform_to_mirror" do
     it "transforms a fingerprint to represent the mirror of the original image" do
       fp = Mwisd_fp::Fingerprint.new
@@ -181,3 +329,25 @@ describe Mwisd_fp::Fingerprint do
     end
   end
 end
+
+describe "Mwisd_fp.probe_image" do
+  before :each do
+    @fixtures = File.expand_path("fixtures", File.dirname(__FILE__))
+  end
+
+  it "reports dimensions, channels, bit depth, and format from headers alone" do
+    info = Mwisd_fp::ImageInfo.new
+    Mwisd_fp.probe_image("#{@fixtures}/flag.jpg", info).should == 1
+    [info.format, info.width, info.height, info.channels, info.bit_depth].should == [Mwisd_fp::Format_jpeg, 815, 579, 3, 8]
+    Mwisd_fp.probe_image("#{@fixtures}/unflattened.png", info).should == 1
+    [info.format, info.width, info.height, info.channels, info.bit_depth].should == [Mwisd_fp::Format_png, 1280, 905, 4, 8]
+  end
+
+  it "probes an image held in memory" do
+    info = Mwisd_fp::ImageInfo.new
+    data = File.open("#{@fixtures}/example1_16bit.png", "rb") { |f| f.read(4096) }
+    Mwisd_fp.probe_image_data(data, info).should == 1
+    [info.width, info.height, info.bit_depth].should == [4, 4, 16]
+    Mwisd_fp.probe_image_data("blah", info).should < 0
+  end
+end